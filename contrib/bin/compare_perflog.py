@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+
+"""Compares the performance log summaries of two sets of runs.
+
+Each directory holds the files written by --perflog-json, named
+<run>.<processor id>.json, e.g. by examples/run_benchmarks.sh.  Over
+the processors of each run we take the largest active time, peak
+memory, and time and peak memory growth of each event, then report
+those which grew past the tolerances since the baseline run.
+
+Exits with status 1 if anything regressed, so this can gate a
+continuous integration job.
+"""
+
+import argparse
+import glob
+import json
+import os
+import sys
+
+
+def load_runs(directory):
+    """Returns a dict from run name to its summary over processors."""
+    runs = {}
+    for filename in glob.glob(os.path.join(directory, '*.json')):
+        run, _, _ = os.path.basename(filename)[:-len('.json')].rpartition('.')
+        with open(filename) as f:
+            data = json.load(f)
+
+        summary = runs.setdefault(run, {'active_time': 0., 'peak_memory': 0,
+                                        'n_procs': 0, 'events': {}})
+        summary['n_procs'] += 1
+        summary['active_time'] = max(summary['active_time'], data['active_time'])
+        summary['peak_memory'] = max(summary['peak_memory'], data['peak_memory'])
+
+        for event in data['events']:
+            key = (event['header'], event['label'])
+            stats = summary['events'].setdefault(key, {'time': 0.,
+                                                       'peak_memory_growth': 0})
+            time = event['time'] + event.get('thread_time', 0.)
+            stats['time'] = max(stats['time'], time)
+            stats['peak_memory_growth'] = max(stats['peak_memory_growth'],
+                                              event['peak_memory_growth'])
+    return runs
+
+
+def check(what, old, new, tolerance, floor, regressions):
+    """Records a regression if new exceeds old by more than tolerance,
+    ignoring values which stay below floor."""
+    if max(old, new) < floor:
+        return
+    if new > old * (1. + tolerance):
+        change = 'new' if old == 0 else '%+.1f%%' % (100. * (new - old) / old)
+        regressions.append('%s: %g -> %g (%s)' % (what, old, new, change))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('baseline', help='directory of baseline results')
+    parser.add_argument('results', help='directory of results to check')
+    parser.add_argument('--time-tolerance', type=float, default=0.1,
+                        help='relative time growth allowed (default 0.1)')
+    parser.add_argument('--min-time', type=float, default=0.05,
+                        help='ignore times below this many seconds (default 0.05)')
+    parser.add_argument('--memory-tolerance', type=float, default=0.1,
+                        help='relative memory growth allowed (default 0.1)')
+    parser.add_argument('--min-memory', type=float, default=1.e6,
+                        help='ignore memory below this many bytes (default 1e6)')
+    args = parser.parse_args()
+
+    baseline = load_runs(args.baseline)
+    results = load_runs(args.results)
+
+    if not results:
+        sys.exit('No results found in ' + args.results)
+
+    regressions = []
+    for run in sorted(results):
+        if run not in baseline:
+            print('%s: no baseline, skipping' % run)
+            continue
+
+        old = baseline[run]
+        new = results[run]
+        if old['n_procs'] != new['n_procs']:
+            print('%s: baseline ran on %d processors, results on %d, skipping'
+                  % (run, old['n_procs'], new['n_procs']))
+            continue
+
+        found = []
+        check('active time', old['active_time'], new['active_time'],
+              args.time_tolerance, args.min_time, found)
+        check('peak memory', old['peak_memory'], new['peak_memory'],
+              args.memory_tolerance, args.min_memory, found)
+
+        for key in sorted(new['events']):
+            event = '%s: %s' % key
+            old_stats = old['events'].get(key, {'time': 0., 'peak_memory_growth': 0})
+            new_stats = new['events'][key]
+            check(event + ' time', old_stats['time'], new_stats['time'],
+                  args.time_tolerance, args.min_time, found)
+            check(event + ' peak memory growth', old_stats['peak_memory_growth'],
+                  new_stats['peak_memory_growth'],
+                  args.memory_tolerance, args.min_memory, found)
+
+        print('%s: active time %g -> %g s, peak memory %g -> %g MB, %d regression(s)'
+              % (run, old['active_time'], new['active_time'],
+                 old['peak_memory'] / 1.e6, new['peak_memory'] / 1.e6, len(found)))
+        for regression in found:
+            print('  ' + regression)
+        regressions.extend(found)
+
+    for run in sorted(set(baseline) - set(results)):
+        print('%s: missing from results' % run)
+
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == '__main__':
+    main()
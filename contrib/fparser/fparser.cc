@@ -9,9 +9,15 @@
 \***************************************************************************/
 
 #include "libmesh_config.h"
-// Communicate to fparser that threads are being utilized
+// Communicate to fparser that threads are being utilized, and have
+// each Eval() put its stack on the hardware stack rather than the
+// heap where alloca() is known to be available
 #ifdef LIBMESH_USING_THREADS
 #  define FP_USE_THREAD_SAFE_EVAL
+#  ifdef __GNUC__
+#    define FP_USE_THREAD_SAFE_EVAL_WITH_ALLOCA
+#    include <alloca.h>
+#  endif
 #endif
 
 #include "fpconfig.hh"
@@ -3032,7 +3038,9 @@ Value_t FunctionParserBase<Value_t>::Eval(const Value_t* Vars)
         }
     }
 
-    mData->mEvalErrorType=0;
+    // Only write to the shared error flag when it needs clearing, so
+    // that concurrent error-free evaluations don't race on it
+    if(mData->mEvalErrorType) mData->mEvalErrorType=0;
     return Stack[SP];
 }
 
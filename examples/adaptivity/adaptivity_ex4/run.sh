@@ -11,6 +11,5 @@ run_example "$example_name" approx_type=HERMITE
 # HERMITE elements can p refine in 1D
 run_example "$example_name" dimension=1 approx_type=HERMITE approx_order=FOURTH
 
-# CLOUGH elements don't currently support threads
-run_example_no_extra_options "$example_name" approx_type=CLOUGH $LIBMESH_OPTIONS --n_threads=1
+run_example "$example_name" approx_type=CLOUGH
 #run_example "$example_name" approx_type=SECOND  # Broken?
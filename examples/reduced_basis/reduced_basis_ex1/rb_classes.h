@@ -60,6 +60,18 @@ public:
    */
   virtual Real get_stability_lower_bound() { return 0.05; }
 
+  /**
+   * The theta expansion and stability bound are pure functions of the
+   * parameters, so the training set can be evaluated in parallel.
+   */
+  virtual std::unique_ptr<RBEvaluation> build_thread_copy() const
+  {
+    std::unique_ptr<SimpleRBEvaluation> rb_eval =
+      libmesh_make_unique<SimpleRBEvaluation>(this->comm());
+    rb_eval->copy_online_data(*this);
+    return std::move(rb_eval);
+  }
+
   /**
    * The object that stores the "theta" expansion of the parameter dependent PDE,
    * i.e. the set of parameter-dependent functions in the affine expansion of the PDE.
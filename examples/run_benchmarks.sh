@@ -0,0 +1,77 @@
+#!/bin/bash
+
+# Runs a few representative examples as performance benchmarks,
+# writing a JSON summary of each run's performance log, one file per
+# processor, to $LIBMESH_BENCHMARK_DIR.  Run this from the examples
+# directory of a build tree, after "make check" has built the examples.
+#
+# The problem sizes grow with $LIBMESH_BENCHMARK_SCALE (default 1).
+# Runs use $LIBMESH_BENCHMARK_THREADS threads each (default 1), and
+# $LIBMESH_RUN as usual to run under MPI, e.g.
+#
+#   LIBMESH_RUN="mpirun -np 4" LIBMESH_BENCHMARK_SCALE=2 \
+#     LIBMESH_BENCHMARK_DIR=$HOME/bench/new ./run_benchmarks.sh
+#
+# Results are compared against those of an earlier run, e.g. of the
+# previous version of the library on the same machine, with
+#
+#   contrib/bin/compare_perflog.py $HOME/bench/old $HOME/bench/new
+
+if (test "x${LIBMESH_DIR}" = "x"); then
+    LIBMESH_DIR=$(cd "$(dirname "$0")/.." && pwd)
+fi
+
+source $LIBMESH_DIR/examples/run_common.sh
+
+LIBMESH_BENCHMARK_DIR=${LIBMESH_BENCHMARK_DIR:-$(pwd)/benchmarks}
+LIBMESH_BENCHMARK_SCALE=${LIBMESH_BENCHMARK_SCALE:-1}
+LIBMESH_BENCHMARK_THREADS=${LIBMESH_BENCHMARK_THREADS:-1}
+
+mkdir -p "$LIBMESH_BENCHMARK_DIR" || exit 1
+LIBMESH_BENCHMARK_DIR=$(cd "$LIBMESH_BENCHMARK_DIR" && pwd)
+export LIBMESH_BENCHMARK_DIR
+
+# Peak memory growth per event is part of what we compare
+LIBMESH_OPTIONS="$LIBMESH_OPTIONS --n-threads=$LIBMESH_BENCHMARK_THREADS --perflog-memory"
+
+scale=$LIBMESH_BENCHMARK_SCALE
+
+# Runs the example in directory $1 named $2 with the remaining options
+run_benchmark() {
+    dir=$1
+    shift
+    name=$1
+    shift
+
+    if (test ! -d "$dir"); then
+        echo "Skipping $name: no $dir directory here"
+        return
+    fi
+
+    # Each example runs in its own directory, next to its input files.
+    # We don't use a subshell, so run_example keeps counting runs.
+    top_dir=$(pwd)
+    cd "$dir" || exit 1
+    run_example "$name" "$@"
+    cd "$top_dir"
+}
+
+run_benchmark introduction/introduction_ex4 introduction_ex4 \
+    -d 3 -n $((8*scale))
+
+run_benchmark adaptivity/adaptivity_ex3 adaptivity_ex3 \
+    refinement_type=h max_r_steps=$((4+2*scale)) output_intermediate=false
+
+run_benchmark fem_system/fem_system_ex1 fem_system_ex1 \
+    coarsegridsize=$((8*scale)) n_timesteps=5 write_interval=10
+
+run_benchmark reduced_basis/reduced_basis_ex1 reduced_basis_ex1 \
+    -online_mode 0
+run_benchmark reduced_basis/reduced_basis_ex1 reduced_basis_ex1 \
+    -online_mode 1
+
+run_benchmark transient/transient_ex1 transient_ex1
+
+run_benchmark solution_transfer/solution_transfer_ex1 solution_transfer_ex1
+
+echo "Benchmark results written to $LIBMESH_BENCHMARK_DIR"
@@ -59,6 +59,18 @@ run_example() {
         done
     done
 
+    # Benchmarks only need one run, with the least debugging enabled,
+    # and a JSON summary of its performance log
+    benchmark_options=""
+    if (test "x${LIBMESH_BENCHMARK_DIR}" != "x"); then
+        for method in ${MY_METHODS}; do
+            benchmark_method=$method
+        done
+        MY_METHODS=$benchmark_method
+        benchmark_run=$((${benchmark_run:-0} + 1))
+        benchmark_options="--perflog-json ${LIBMESH_BENCHMARK_DIR}/${example_name}.${benchmark_run}"
+    fi
+
     for method in ${MY_METHODS}; do
 	
 	case "${method}" in
@@ -75,16 +87,16 @@ run_example() {
 	    exit 1
 	fi
 	
-	message_running $example_name $executable $options
+	message_running $example_name $executable $options $benchmark_options
 
-	$LIBMESH_RUN ./$executable $options $LIBMESH_OPTIONS
+	$LIBMESH_RUN ./$executable $options $LIBMESH_OPTIONS $benchmark_options
         RETVAL=$?
         # If we don't return 'success' or 'skip', quit
         if [ $RETVAL -ne 0 -a $RETVAL -ne 77 ]; then
           exit $RETVAL
         fi
 	
-	message_done_running $example_name $executable $options
+	message_done_running $example_name $executable $options $benchmark_options
     done
 }
 
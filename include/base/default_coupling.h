@@ -22,12 +22,17 @@
 
 // Local Includes
 #include "libmesh/ghosting_functor.h"
+#include "libmesh/threads.h"
+
+// C++ Includes
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward declarations
 class PeriodicBoundaries;
+class PointLocatorBase;
 
 
 /**
@@ -63,12 +68,12 @@ public:
 
   // Change number of levels of neighbors to couple.
   void set_n_levels(unsigned int n_levels)
-  { _n_levels = n_levels; }
+  { _n_levels = n_levels; this->clear_cache(); }
 
 #ifdef LIBMESH_ENABLE_PERIODIC
   // Set PeriodicBoundaries to couple
   void set_periodic_boundaries(const PeriodicBoundaries * periodic_bcs)
-  { _periodic_bcs = periodic_bcs; }
+  { _periodic_bcs = periodic_bcs; this->clear_cache(); }
 #endif
 
   // Set MeshBase for use in checking for periodic boundary ids
@@ -78,9 +83,13 @@ public:
   /**
    * If we have periodic boundaries, then we'll need the mesh to have
    * an updated point locator whenever we're about to query them.
+   * Either way, any coupled elements we remember are forgotten.
    */
   virtual void mesh_reinit () override;
 
+  virtual void dofmap_reinit () override
+  { this->clear_cache(); }
+
   virtual void redistribute () override
   { this->mesh_reinit(); }
 
@@ -102,8 +111,37 @@ public:
                            processor_id_type p,
                            map_type & coupled_elements) override;
 
+  /**
+   * Forgets the coupled elements found so far.  This is done whenever
+   * the mesh is reinitialized, redistributed or has remote elements
+   * deleted, and whenever the DofMap is reinitialized, but users who
+   * modify a mesh's elements between those times must call it
+   * themselves.
+   */
+  void clear_cache ();
+
 private:
 
+  /**
+   * \returns The active elements within _n_levels neighbors of
+   * \p elem, including \p elem itself, from the cache if they have
+   * been found before.  \p point_locator is built if it is needed but
+   * is still null.
+   */
+  const std::vector<const Elem *> &
+  _coupled_neighborhood (const Elem * elem,
+                         std::unique_ptr<PointLocatorBase> & point_locator);
+
+  /**
+   * The neighborhood of each element asked about since the cache was
+   * last cleared.  Sparsity pattern construction asks about each
+   * element separately, from several threads at once, after the
+   * send list construction asked about all the local elements, so
+   * we guard and reuse these.
+   */
+  std::unordered_map<const Elem *, std::vector<const Elem *>> _neighborhoods;
+  Threads::spin_mutex _neighborhoods_mutex;
+
   const CouplingMatrix * _dof_coupling;
 #ifdef LIBMESH_ENABLE_PERIODIC
   const PeriodicBoundaries * _periodic_bcs;
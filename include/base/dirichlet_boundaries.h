@@ -26,11 +26,14 @@
 
 // Local Includes
 #include "libmesh/id_types.h"
+#include "libmesh/point.h"
 #include "libmesh/vector_value.h"
 
 // C++ Includes
 #include <cstddef>
+#include <map>
 #include <set>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -61,6 +64,32 @@ template <typename Output> class FunctionBase;
 enum VariableIndexing { SYSTEM_VARIABLE_ORDER = 0,
                         LOCAL_VARIABLE_ORDER };
 
+/**
+ * The linear map, cached by a DirichletBoundary with \p
+ * cache_projections set, from boundary function values to the
+ * Dirichlet constrained dof values of one variable on one element.
+ */
+struct DirichletProjection
+{
+  // The element geometry, dof indices and boundary flags the map was
+  // built for, so that a stale map can be recognized
+  std::vector<Point> nodes;
+  std::vector<dof_id_type> dof_indices;
+  std::vector<bool> boundary_flags;
+
+  // The points at which the boundary function needs evaluating; each
+  // point has n_vec_dim columns of the map, one per component
+  std::vector<Point> points;
+  unsigned int n_vec_dim;
+
+  // The element-local dofs the map constrains, and the map itself,
+  // stored row-major with one row per constrained dof
+  std::vector<unsigned int> fixed_dofs;
+  std::vector<Real> map;
+};
+
+
+
 /**
  * This class allows one to associate Dirichlet boundary values with
  * a given set of mesh boundary ids and system variable ids.
@@ -201,6 +230,28 @@ public:
    * negative value makes this possible in practice.
    */
   Real jacobian_tolerance;
+
+  /**
+   * Defaults to false, but can be set to true to cache, per boundary
+   * element and variable, the linear map from values of \p f to
+   * constrained dof values.  The projections behind that map depend
+   * only on the mesh, so when constraints are recomputed for a
+   * time-dependent \p f only \p f itself is reevaluated, at all of
+   * an element's points in one FunctionBase::evaluate() call.
+   *
+   * Caching applies to C0 variables with a FunctionBase \p f; other
+   * variables and FEMFunctionBase boundaries are projected from
+   * scratch each time.  Cached maps are checked against the element
+   * geometry and dofs, and rebuilt if those have changed.
+   */
+  bool cache_projections;
+
+  /**
+   * The cached maps, by element id and variable number, when
+   * \p cache_projections is set.  These are built and used by the
+   * DofMap while computing constraints.
+   */
+  mutable std::map<std::pair<dof_id_type, unsigned int>, DirichletProjection> projection_cache;
 };
 
 
@@ -48,6 +48,7 @@ enum Order : int;
 #include <iterator>
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -244,6 +245,31 @@ public:
    */
   void distribute_dofs (MeshBase &);
 
+  /**
+   * Tells this \p DofMap to take its dof numbering from \p source,
+   * the \p DofMap of another system on the same mesh with the same
+   * variable groups, instead of computing its own.  \p
+   * distribute_dofs() then copies the source's dof indices on every
+   * \p DofObject, its dof counts and its send list without any
+   * numbering passes or communication, and \p compute_sparsity()
+   * copies the source's nonzero counts when the two systems have the
+   * same constraints and coupling.  Constraints themselves are still
+   * computed separately for each system.
+   *
+   * The source system must have a lower system number, so that its
+   * dofs are distributed first.  Passing \p nullptr returns this \p
+   * DofMap to numbering its own dofs.
+   */
+  void share_layout_with (const DofMap * source)
+  { _layout_source = source; }
+
+  /**
+   * \returns The \p DofMap whose layout this one copies, or \p
+   * nullptr if it numbers its own dofs.
+   */
+  const DofMap * layout_source () const
+  { return _layout_source; }
+
   /**
    * Computes the sparsity pattern for the matrices corresponding to
    * \p proc_id and sends that data to Linear Algebra packages for
@@ -256,6 +282,21 @@ public:
    */
   void clear_sparsity();
 
+  /**
+   * Sets whether compute_sparsity() builds a compressed sparse row
+   * pattern (see \p SparsityPattern::CSRBuild) rather than a
+   * per-row one.  The CSR pattern is only used when no attached
+   * matrix needs the full \p SparsityPattern::Graph and no extra
+   * sparsity function or object has been attached.  Off by default.
+   */
+  void set_csr_sparsity (bool use_csr) { _use_csr_sparsity = use_csr; }
+
+  /**
+   * \returns The compressed sparse row pattern built by the last
+   * compute_sparsity(), or nullptr if none was built.
+   */
+  const SparsityPattern::CSRBuild * get_csr_sparsity() const { return _csr_sp.get(); }
+
   /**
    * Remove any default ghosting functor(s).  User-added ghosting
    * functors will be unaffected.
@@ -470,6 +511,8 @@ public:
   void clear_send_list ()
   {
     _send_list.clear();
+    _send_list_dofs.clear();
+    _send_list_offsets.clear();
   }
 
   /**
@@ -495,6 +538,23 @@ public:
    */
   const std::vector<dof_id_type> & get_send_list() const { return _send_list; }
 
+  /**
+   * \returns The offsets of each processor's dofs in the prepared \p
+   * _send_list: the entries owned by processor \p p are those from
+   * \p send_list_offsets()[p] up to \p send_list_offsets()[p+1].
+   * This is only filled in by \p prepare_send_list().
+   */
+  const std::vector<std::size_t> & send_list_offsets() const
+  { return _send_list_offsets; }
+
+  /**
+   * \returns The number of nonzeros in this processor's rows of a
+   * matrix with the sparsity pattern last computed.  This is kept
+   * after the pattern itself is cleared.
+   */
+  std::size_t n_local_nonzeros() const
+  { return _n_local_nonzeros; }
+
   /**
    * \returns A constant reference to the \p _n_nz list for this processor.
    *
@@ -542,6 +602,9 @@ public:
    * \note We previously referred to these types of constraints as
    * "cyclic" but that has now been deprecated, and these will now
    * instead be referred to as "constraint loops" in libMesh.
+   *
+   * \note process_constraints() now finds constraint loops in every
+   * method, so they are an error regardless of this setting.
    */
   void set_error_on_cyclic_constraint(bool error_on_cyclic_constraint);
   void set_error_on_constraint_loop(bool error_on_constraint_loop);
@@ -720,6 +783,34 @@ public:
 
 #endif //LIBMESH_ENABLE_AMR
 
+  /**
+   * Sets whether \p distribute_dofs() caches the degree of freedom
+   * indices of every active local and ghost element, in one flat
+   * array with per-variable offsets, so that later \p dof_indices()
+   * calls on those elements are a copy rather than a walk over their
+   * nodes.  Off by default, since the cache costs memory comparable
+   * to the sparsity pattern's.  Turning it off discards any cache.
+   */
+  void set_cache_dof_indices (bool cache);
+
+  /**
+   * \returns \p true if \p distribute_dofs() caches element dof indices.
+   */
+  bool cache_dof_indices () const { return _cache_dof_indices; }
+
+  /**
+   * Sets \p begin and \p end to the range of cached global degree of
+   * freedom indices for \p elem, for variable \p vn or for every
+   * variable if \p vn is \p invalid_uint, without copying them.
+   *
+   * \returns \p false, leaving \p begin and \p end unchanged, if \p
+   * elem is not in the cache.
+   */
+  bool cached_dof_indices (const Elem & elem,
+                           const dof_id_type * & begin,
+                           const dof_id_type * & end,
+                           unsigned int vn = libMesh::invalid_uint) const;
+
   /**
    * Fills the vector \p di with the global degree of freedom indices
    * for the element.
@@ -841,6 +932,168 @@ public:
    */
   bool use_coupled_neighbor_dofs(const MeshBase & mesh) const;
 
+  /**
+   * Tells the sparsity pattern computation that element-interior
+   * degrees of freedom (see \p interior_dof_indices()) will be
+   * statically condensed out of the system matrix, leaving only
+   * their diagonal entries.  This must be set before the sparsity
+   * pattern is computed, and is only correct if each element's
+   * interior dofs are coupled through that element alone.
+   */
+  void set_condense_interior_dofs(bool condense_interior_dofs)
+  { _condense_interior_dofs = condense_interior_dofs; }
+
+  /**
+   * \returns \p true if element-interior dofs are condensed out of
+   * the system matrix.
+   */
+  bool condense_interior_dofs() const
+  { return _condense_interior_dofs; }
+
+  /**
+   * Tells the sparsity pattern computation that the couplings
+   * between SCALAR and other degrees of freedom will be kept out of
+   * the system matrix (see \p ScalarBorder), leaving the SCALAR dofs
+   * only their couplings to each other.  This must be set before the
+   * sparsity pattern is computed.
+   */
+  void set_border_scalar_dofs(bool border_scalar_dofs)
+  { _border_scalar_dofs = border_scalar_dofs; }
+
+  /**
+   * \returns \p true if SCALAR dof couplings are kept out of the
+   * system matrix.
+   */
+  bool border_scalar_dofs() const
+  { return _border_scalar_dofs; }
+
+  /**
+   * Fills \p di with the sorted, unconstrained degrees of freedom
+   * which are interior to \p elem: those stored on \p elem itself or
+   * on nodes which lie on none of its sides.  In a conforming mesh no
+   * other element shares these.
+   */
+  void interior_dof_indices (const Elem & elem,
+                             std::vector<dof_id_type> & di) const;
+
+  /**
+   * Orderings which \p distribute_dofs() can give the degrees of
+   * freedom on each processor.  Reordering never moves dofs between
+   * processors, and the dofs of each variable group on a DofObject
+   * stay contiguous; only the order in which local DofObjects are
+   * numbered changes.
+   */
+  enum DofOrdering
+    {
+      /**
+       * Number DofObjects as they are encountered while iterating
+       * over the mesh.  This is the default.
+       */
+      MESH_ORDER = 0,
+
+      /**
+       * Number DofObjects in reverse Cuthill-McKee order of their
+       * local coupling graph, reducing the bandwidth of the local
+       * matrix block.  This typically improves the quality of
+       * incomplete factorization preconditioners.
+       */
+      REVERSE_CUTHILL_MCKEE,
+
+      /**
+       * Number DofObjects along a space-filling curve through their
+       * positions, which tends to improve cache reuse when
+       * traversing vectors and matrix rows.
+       */
+      SPACE_FILLING_CURVE,
+
+      /**
+       * Number DofObjects which had degrees of freedom before the
+       * mesh last changed in the order of those, and then new
+       * DofObjects in mesh order.  After local refinement the dofs
+       * on unchanged parts of the mesh keep their relative order, so
+       * the numbering only changes near refined or coarsened
+       * elements, apart from a shift between processors' ranges.
+       * Without AMR support there are no old dofs to keep, and this
+       * is \p MESH_ORDER.
+       */
+      KEEP_OLD_ORDER
+    };
+
+  /**
+   * Sets the ordering used by subsequent calls to \p
+   * distribute_dofs().  Since each \p System has its own \p DofMap,
+   * the ordering can differ from system to system.  Variable-major
+   * or node-major numbering (see the --node-major-dofs command line
+   * option) is still respected within the reordering.
+   */
+  void set_dof_ordering(DofOrdering ordering)
+  { _dof_ordering = ordering; }
+
+  /**
+   * \returns The ordering used by \p distribute_dofs().
+   */
+  DofOrdering dof_ordering() const
+  { return _dof_ordering; }
+
+  /**
+   * \returns A coloring of the active local elements of \p mesh:
+   * no two elements of the same color have a degree of freedom in
+   * common, counting the dofs their constraints connect them to.
+   * Contributions from elements of one color can therefore be added
+   * to global matrices and vectors concurrently, without locking.
+   *
+   * The coloring is computed greedily on first use and cached until
+   * the dofs or constraints next change.  It is not thread safe to
+   * compute it from within a threaded loop.
+   */
+  const std::vector<std::vector<const Elem *>> &
+  element_colors (const MeshBase & mesh) const;
+
+  /**
+   * \returns, for each color of \p element_colors(), the position of
+   * its first element for which \p is_interface_element() is \p
+   * true.  Each color lists its interior elements first, so that
+   * either kind can be looped over without copying the color.
+   */
+  const std::vector<std::size_t> &
+  element_color_interface_starts (const MeshBase & mesh) const;
+
+  /**
+   * \returns \p true if assembling \p elem needs solution values
+   * this processor doesn't own: if any of its dofs is ghosted, or
+   * constrained (in which case its constraint may involve ghosted
+   * dofs).  Elements which don't can be assembled while ghosted
+   * values are still being communicated.
+   */
+  bool is_interface_element (const Elem * elem) const;
+
+  /**
+   * \returns The active local elements of \p mesh for which \p
+   * is_interface_element() is \p false.
+   *
+   * Like \p element_colors(), this is cached until the dofs or
+   * constraints next change, and is not thread safe to compute from
+   * within a threaded loop.
+   */
+  const std::vector<const Elem *> &
+  local_interior_elements (const MeshBase & mesh) const;
+
+  /**
+   * \returns The active local elements of \p mesh for which \p
+   * is_interface_element() is \p true, cached as with \p
+   * local_interior_elements().
+   */
+  const std::vector<const Elem *> &
+  local_interface_elements (const MeshBase & mesh) const;
+
+  /**
+   * \returns The number of times \p distribute_dofs() has been
+   * called.  Anything built from the dof numbering, such as solver
+   * index sets, is stale once this changes.
+   */
+  unsigned int n_dof_distributions () const
+  { return _n_dof_distributions; }
+
   /**
    * Builds the local element vector \p Ue from the global vector \p Ug,
    * accounting for any constrained degrees of freedom.  For an element
@@ -928,6 +1181,12 @@ public:
    * unconstrained dofs to the send_list and prepares that for use.
    * This should be run after both system (create_dof_constraints) and
    * user constraints have all been added.
+   *
+   * Constraint rows are sorted by their depth in the graph of
+   * constraint dependencies, then each depth is expanded, in
+   * parallel across threads, in terms of the already expanded rows
+   * before it.  Constraint loops are detected, and are an error,
+   * along the way.
    */
   void process_constraints (MeshBase &);
 
@@ -999,12 +1258,14 @@ public:
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compact_constraints_valid = false;
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compact_constraints_valid = false;
   }
 
   /**
@@ -1022,6 +1283,7 @@ public:
   void swap_dof_constraints()
   {
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compact_constraints_valid = false;
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1268,6 +1530,55 @@ public:
   void enforce_constraints_on_jacobian (const NonlinearImplicitSystem & system,
                                         SparseMatrix<Number> * jac) const;
 
+#ifdef LIBMESH_ENABLE_CONSTRAINTS
+  /**
+   * Builds the global constraint projection: the matrix \p P, and
+   * optionally the vector \p g, for which u = P u + g holds for every
+   * u satisfying our processed constraints.  \p P is the identity on
+   * unconstrained dofs and holds the constraint row of each
+   * constrained dof, so no column of a constrained dof has a nonzero.
+   * Each constrained row also stores an explicit zero on its
+   * diagonal, so that P^T A P keeps a diagonal entry for each
+   * constrained dof.  \p g holds the primal constraint right hand
+   * sides, and is initialized here if it was not already.
+   *
+   * With P and g in hand, a matrix A and right hand side b assembled
+   * without any constraints can be constrained all at once, by
+   * project_constrained_matrix() and project_constrained_rhs(); if x
+   * solves the projected system then P x + g is the constrained
+   * solution.  P can be reused for as long as the constraints are
+   * unchanged.
+   */
+  void build_constraint_projection (SparseMatrix<Number> & P,
+                                    NumericVector<Number> * g = nullptr) const;
+
+  /**
+   * Computes P^T A P for a matrix \p A assembled without constraints
+   * and \p P from build_constraint_projection(), with a unit diagonal
+   * for each constrained dof, into \p PtAP.  If \p reuse is true,
+   * \p PtAP came from an earlier call with the same \p P and an \p A
+   * of the same sparsity pattern, and the solver package supports it,
+   * only the values of the product are recomputed.
+   */
+  void project_constrained_matrix (const SparseMatrix<Number> & A,
+                                   const SparseMatrix<Number> & P,
+                                   SparseMatrix<Number> & PtAP,
+                                   bool reuse = false) const;
+
+  /**
+   * Computes P^T (b - A g) for a right hand side \p b and matrix
+   * \p A assembled without constraints, with \p P and (if there are
+   * heterogeneous constraints) \p g from
+   * build_constraint_projection(), into \p projected_rhs, which is
+   * zero at every constrained dof.
+   */
+  void project_constrained_rhs (const SparseMatrix<Number> & A,
+                                const SparseMatrix<Number> & P,
+                                const NumericVector<Number> & b,
+                                const NumericVector<Number> * g,
+                                NumericVector<Number> & projected_rhs) const;
+#endif // LIBMESH_ENABLE_CONSTRAINTS
+
 #ifdef LIBMESH_ENABLE_PERIODIC
 
   //--------------------------------------------------------------------
@@ -1428,6 +1739,30 @@ public:
    */
   std::string get_info() const;
 
+  /**
+   * \returns An estimate of the heap memory, in bytes, this processor
+   * uses for the dof map: the sum of the three footprints below.
+   */
+  std::size_t memory_footprint() const;
+
+  /**
+   * \returns The heap memory, in bytes, this processor uses for dof
+   * index ranges and the send list.
+   */
+  std::size_t indexing_memory_footprint() const;
+
+  /**
+   * \returns An estimate of the heap memory, in bytes, this processor
+   * uses for dof and node constraints and their right hand sides.
+   */
+  std::size_t constraints_memory_footprint() const;
+
+  /**
+   * \returns An estimate of the heap memory, in bytes, this processor
+   * uses for the sparsity pattern and nonzero counts we have kept.
+   */
+  std::size_t sparsity_memory_footprint() const;
+
   /**
    * Degree of freedom coupling.  If left empty each DOF
    * couples to all others.  Can be used to reduce memory
@@ -1544,6 +1879,29 @@ private:
   void distribute_local_dofs_node_major (dof_id_type & next_free_dof,
                                          MeshBase & mesh);
 
+  /**
+   * Puts the DofObjects which this processor numbers (its active
+   * local elements and its local nodes) into \p objects, in the
+   * order requested by \p _dof_ordering.
+   */
+  void order_local_dof_objects (MeshBase & mesh,
+                                std::vector<DofObject *> & objects) const;
+
+  /**
+   * Distributes the global degrees of freedom for dofs on this
+   * processor, numbering the DofObjects in the order given by \p
+   * objects.  If \p node_major is \p true, all the degrees of freedom
+   * on each DofObject are numbered together, as in \p
+   * distribute_local_dofs_node_major; otherwise each variable group
+   * is numbered in a contiguous block, as in \p
+   * distribute_local_dofs_var_major.  Starts at index \p
+   * next_free_dof, and increments it to the post-final index.
+   */
+  void distribute_local_dofs_ordered (dof_id_type & next_free_dof,
+                                      MeshBase & mesh,
+                                      const std::vector<DofObject *> & objects,
+                                      bool node_major);
+
   /*
    * A utility method for obtaining a set of elements to ghost along
    * with merged coupling matrices.
@@ -1563,6 +1921,20 @@ private:
    */
   void add_neighbors_to_send_list(MeshBase & mesh);
 
+  /**
+   * Copies the dof indices on every \p DofObject, and the dof
+   * counts, from \p _layout_source, after checking that its
+   * variable groups match ours.
+   */
+  void copy_source_dofs (MeshBase & mesh);
+
+  /**
+   * \returns \p true iff our sparsity pattern would be identical to
+   * that of \p _layout_source, so that its nonzero counts can be
+   * copied.
+   */
+  bool can_copy_source_sparsity () const;
+
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
   /**
@@ -1600,6 +1972,26 @@ private:
                                            int qoi_index = -1,
                                            const bool called_recursively=false) const;
 
+  /**
+   * Copies the (fully expanded) \p _dof_constraints into the
+   * compressed row arrays used by \p compact_constrain_element().
+   */
+  void build_compact_constraints ();
+
+  /**
+   * Applies the compressed row constraints to the element \p matrix
+   * and/or \p rhs, whichever are non-null, exactly as the \p
+   * build_constraint_matrix() triple products would, but touching only
+   * constrained rows and columns.
+   *
+   * \returns \p false, leaving everything untouched, if the compressed
+   * constraints are out of date.
+   */
+  bool compact_constrain_element (DenseMatrix<Number> * matrix,
+                                  DenseVector<Number> * rhs,
+                                  std::vector<dof_id_type> & elem_dofs,
+                                  bool asymmetric_constraint_rows) const;
+
   /**
    * Finds all the DOFS associated with the element DOFs elem_dofs.
    * This will account for off-element couplings via hanging nodes.
@@ -1682,6 +2074,27 @@ private:
    */
   std::vector<dof_id_type> _send_list;
 
+  /**
+   * The dofs we have put on the \p _send_list ourselves since it was
+   * last prepared, so that we add each of those only once.
+   */
+  std::unordered_set<dof_id_type> _send_list_dofs;
+
+  /**
+   * The offset of each processor's dofs in the prepared \p _send_list,
+   * with one extra entry for its end.
+   */
+  std::vector<std::size_t> _send_list_offsets;
+
+  /**
+   * Adds \p dof to the \p _send_list if we haven't already.
+   */
+  void add_to_send_list (dof_id_type dof)
+  {
+    if (_send_list_dofs.insert(dof).second)
+      _send_list.push_back(dof);
+  }
+
   /**
    * Function object to call to add extra entries to the sparsity pattern
    */
@@ -1771,6 +2184,17 @@ private:
    */
   std::unique_ptr<SparsityPattern::Build> _sp;
 
+  /**
+   * Whether to build a compressed sparse row pattern when we can.
+   */
+  bool _use_csr_sparsity;
+
+  /**
+   * The compressed sparse row pattern of the global matrix, if one
+   * was built.
+   */
+  std::unique_ptr<SparsityPattern::CSRBuild> _csr_sp;
+
   /**
    * The number of on-processor nonzeros in my portion of the
    * global matrix.  If need_full_sparsity_pattern is true, this will
@@ -1785,6 +2209,11 @@ private:
    */
   std::vector<dof_id_type> * _n_oz;
 
+  /**
+   * The total of \p _n_nz and \p _n_oz when they were last computed.
+   */
+  std::size_t _n_local_nonzeros;
+
   /**
    * Total number of degrees of freedom.
    */
@@ -1828,6 +2257,19 @@ private:
    */
   DofConstraints _dof_constraints, _stashed_dof_constraints;
 
+  /**
+   * A compressed row copy of \p _dof_constraints, built by \p
+   * process_constraints() once every row is fully expanded: the
+   * sorted constrained dofs, where each one's row begins in the
+   * column and coefficient arrays, and those arrays.  Any change to
+   * the constraints leaves it invalid until they are processed again.
+   */
+  std::vector<dof_id_type> _compact_constrained_dofs;
+  std::vector<std::size_t> _compact_constraint_row_starts;
+  std::vector<dof_id_type> _compact_constraint_cols;
+  std::vector<Real> _compact_constraint_coefs;
+  bool _compact_constraints_valid;
+
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
@@ -1877,6 +2319,83 @@ private:
    */
   bool _implicit_neighbor_dofs_initialized;
   bool _implicit_neighbor_dofs;
+
+  /**
+   * Whether element-interior dofs are condensed out of the system
+   * matrix.
+   */
+  bool _condense_interior_dofs;
+
+  /**
+   * Whether SCALAR dof couplings are kept out of the system matrix.
+   */
+  bool _border_scalar_dofs;
+
+  /**
+   * The \p DofMap whose layout we copy, if any.
+   */
+  const DofMap * _layout_source;
+
+  /**
+   * The ordering \p distribute_dofs() gives local dofs.
+   */
+  DofOrdering _dof_ordering;
+
+  /**
+   * The cached result of \p element_colors(), and whether it is
+   * still up to date.
+   */
+  mutable std::vector<std::vector<const Elem *>> _element_colors;
+  mutable std::vector<std::size_t> _element_color_interface_starts;
+  mutable bool _element_colors_valid;
+
+  /**
+   * Builds the cached \p _interior_elements and \p _interface_elements
+   * if they aren't up to date.
+   */
+  void _split_interior_elements (const MeshBase & mesh) const;
+
+  /**
+   * The cached results of \p local_interior_elements() and \p
+   * local_interface_elements(), and whether they are still up to
+   * date.
+   */
+  mutable std::vector<const Elem *> _interior_elements;
+  mutable std::vector<const Elem *> _interface_elements;
+  mutable bool _interior_elements_valid;
+
+  /**
+   * The number of calls to \p distribute_dofs() so far.
+   */
+  unsigned int _n_dof_distributions;
+
+  /**
+   * Fills the element dof index cache from the current dof numbering.
+   */
+  void _build_dof_indices_cache (const MeshBase & mesh);
+
+  /**
+   * \returns The \p n_variables()+1 offsets into \p
+   * _cached_dof_indices of each variable's indices on \p elem, or
+   * nullptr if \p elem is not cached.
+   */
+  const std::size_t * _cached_dof_offsets (const Elem & elem) const;
+
+  /**
+   * Whether \p distribute_dofs() builds the element dof index cache.
+   */
+  bool _cache_dof_indices;
+
+  /**
+   * The element dof index cache: for each element id, the row of
+   * that element in the cache, or \p invalid_id; for each row, the
+   * element it was built for and its \p n_variables()+1 offsets into
+   * the flat array of every element's dof indices.
+   */
+  std::vector<dof_id_type> _cached_elem_rows;
+  std::vector<const Elem *> _cached_elems;
+  std::vector<std::size_t> _cached_var_offsets;
+  std::vector<dof_id_type> _cached_dof_indices;
 };
 
 
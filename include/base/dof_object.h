@@ -27,6 +27,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/small_vector.h"
 
 // C++ includes
 #include <cstddef>
@@ -72,6 +73,27 @@ protected:
 
 public:
 
+#ifdef LIBMESH_ENABLE_DOF_OBJECT_ARENA
+
+  /**
+   * Nodes, elements, and their old copies are allocated from a shared
+   * \p ObjectArena, with slabs for each object size, rather than
+   * individually from the heap.
+   */
+  static void * operator new (std::size_t size);
+
+  static void operator delete (void * p, std::size_t size);
+
+  /**
+   * Returns arena slabs which no longer hold any objects to the
+   * system.  Called by the meshes after they clear their objects.
+   *
+   * \returns The number of bytes freed.
+   */
+  static std::size_t release_arena_memory ();
+
+#endif
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -444,6 +466,13 @@ public:
    */
   unsigned int packed_indexing_size() const;
 
+  /**
+   * \returns The heap memory, in bytes, taken by the indexing of
+   * this object, and by its \p old_dof_object if it has one, beyond
+   * sizeof(*this).
+   */
+  std::size_t indexing_memory_footprint() const;
+
   /**
    * If we have indices packed into an buffer for communications, how
    * much of that buffer applies to this dof object?
@@ -614,9 +643,14 @@ private:
    * [-5 11 11 13 17 () (ncv_0 idx_0 ncv_1 idx_1 ncv_2 idx_2) () (ncv_0 idx_0) (ncv_0 idx_0 ncv_1 idx_1) (xtra1 xtra2)]
    * [0   1  2  3  4         5     6     7     8     9    10         11    12      13    14    15    16      17    18]
    * \endverbatim
+   *
+   * The buffer stores up to 6 entries inline, enough for one or two
+   * systems with a single variable group each, so in the common
+   * cases no heap allocation is needed and dof_number() lookups read
+   * from the object itself.
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  typedef small_vector<index_t, 6> index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -655,7 +689,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
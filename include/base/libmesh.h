@@ -227,8 +227,11 @@ extern const Number imaginary;
  * which solver packages  were available when the library was configured.
  * The command-line is also checked, allowing the user to override the
  * compiled default.  For example, \p --use-petsc will force the use of
- * PETSc solvers, and \p --use-laspack will force the use of LASPACK
- * solvers.
+ * PETSc solvers, \p --use-laspack will force the use of LASPACK
+ * solvers, and \p --use-tpetra will force the use of the Trilinos
+ * Tpetra/Belos solvers.  Without any solver package, or with
+ * \p --use-native-solvers, we use libMesh's own
+ * \p DistributedSparseMatrix and \p NativeLinearSolver.
  */
 SolverPackage default_solver_package ();
 
@@ -69,6 +69,7 @@ struct PerfItem
            PerfLog * my_perflog=&perflog) :
     _label(label),
     _header(header),
+    _event(nullptr),
     _enabled(enabled),
     _perflog(*my_perflog)
   {
@@ -76,15 +77,48 @@ struct PerfItem
       _perflog.fast_push(label, header);
   }
 
+  /**
+   * Logs \p event, the handle the \p LOG_SCOPE macros keep for
+   * this scope, if it was built with this \p label and \p header.
+   * Scopes whose label or header change from call to call fall back
+   * on logging them by name.
+   */
+  PerfItem(const PerfEvent & event,
+           const char * label,
+           const char * header,
+           bool enabled=true,
+           PerfLog * my_perflog=&perflog) :
+    _label(label),
+    _header(header),
+    _event((event.label == label && event.header == header) ?
+           &event : nullptr),
+    _enabled(enabled),
+    _perflog(*my_perflog)
+  {
+    if (_enabled)
+      {
+        if (_event)
+          _perflog.fast_push(*_event);
+        else
+          _perflog.fast_push(label, header);
+      }
+  }
+
   ~PerfItem()
   {
     if (_enabled)
-      _perflog.fast_pop(_label, _header);
+      {
+        if (_event)
+          _perflog.fast_pop(*_event);
+        else
+          _perflog.fast_pop(_label, _header);
+      }
   }
 
 private:
   const char * _label;
   const char * _header;
+  const PerfEvent * _event;
   bool _enabled;
   PerfLog & _perflog;
 };
@@ -107,9 +141,13 @@ private:
 #  define PALIBMESH_USE_LOG(a,b)   { libmesh_deprecated(); }
 #  define RESTART_LOG(a,b) { libmesh_deprecated(); }
 #endif
-#  define LOG_SCOPE(a,b)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b);
-#  define LOG_SCOPE_IF(a,b,enabled)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,enabled);
-#  define LOG_SCOPE_WITH(a,b,logger)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,true,&logger);
+// Each scope registers its event once, the first time through
+#  define LOG_SCOPE(a,b)   static const libMesh::PerfEvent TOKENPASTE2(perf_event_, __LINE__)(a,b); \
+  libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(TOKENPASTE2(perf_event_, __LINE__),a,b);
+#  define LOG_SCOPE_IF(a,b,enabled)   static const libMesh::PerfEvent TOKENPASTE2(perf_event_, __LINE__)(a,b); \
+  libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(TOKENPASTE2(perf_event_, __LINE__),a,b,enabled);
+#  define LOG_SCOPE_WITH(a,b,logger)   static const libMesh::PerfEvent TOKENPASTE2(perf_event_, __LINE__)(a,b); \
+  libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(TOKENPASTE2(perf_event_, __LINE__),a,b,true,&logger);
 
 #else
 
@@ -24,10 +24,13 @@
 #ifdef LIBMESH_ENABLE_PERIODIC
 
 // Local Includes
+#include "libmesh/hashing.h"
+#include "libmesh/threads.h"
 #include "libmesh/vector_value.h" // RealVectorValue
 
 // C++ Includes
 #include <map>
+#include <unordered_map>
 
 namespace libMesh
 {
@@ -60,11 +63,52 @@ public:
   ~PeriodicBoundaries();
 
   // The periodic neighbor of \p e in direction \p side, if it
-  // exists, nullptr otherwise.
+  // exists, nullptr otherwise.  Each neighbor is found with
+  // \p point_locator the first time it is asked for, and remembered
+  // until clear_neighbor_cache() is called.
   const Elem * neighbor(boundary_id_type boundary_id,
                         const PointLocatorBase & point_locator,
                         const Elem * e,
                         unsigned int side) const;
+
+  // Forgets the neighbors found so far.  This must be called whenever
+  // elements are added, deleted, moved or renumbered;
+  // \p MeshRefinement and \p DofMap::reinit() do so for the
+  // boundaries they are given.
+  void clear_neighbor_cache() const;
+
+private:
+  // The element id, side and boundary id of a periodic neighbor
+  // lookup
+  struct NeighborKey
+  {
+    dof_id_type elem_id;
+    unsigned int side;
+    boundary_id_type boundary_id;
+
+    bool operator== (const NeighborKey & other) const
+    {
+      return elem_id == other.elem_id && side == other.side &&
+        boundary_id == other.boundary_id;
+    }
+  };
+
+  struct NeighborKeyHash
+  {
+    std::size_t operator() (const NeighborKey & key) const
+    {
+      std::size_t seed = 0;
+      boostcopy::hash_combine(seed, key.elem_id);
+      boostcopy::hash_combine(seed, key.side);
+      boostcopy::hash_combine(seed, key.boundary_id);
+      return seed;
+    }
+  };
+
+  // The neighbors found so far, which threads may be adding to at
+  // once
+  mutable std::unordered_map<NeighborKey, const Elem *, NeighborKeyHash> _neighbor_cache;
+  mutable Threads::spin_mutex _neighbor_cache_mutex;
 };
 
 } // namespace libMesh
@@ -75,7 +75,7 @@ protected:
   {
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
-    increment_constructor_count(typeid(T).name());
+    increment_constructor_count(counter_slot());
 
 #endif
   }
@@ -88,7 +88,7 @@ protected:
   {
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
-    increment_constructor_count(typeid(T).name());
+    increment_constructor_count(counter_slot());
 
 #endif
   }
@@ -101,7 +101,7 @@ protected:
   {
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
-    increment_constructor_count(typeid(T).name());
+    increment_constructor_count(counter_slot());
 
 #endif
   }
@@ -118,6 +118,20 @@ protected:
     return *this;
   }
 
+#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+
+  /**
+   * \returns The slot holding the counts of \p T, which is looked up
+   * by name only the first time.
+   */
+  static unsigned int counter_slot ()
+  {
+    static const unsigned int slot = register_counter(typeid(T).name());
+    return slot;
+  }
+
+#endif
+
 
 public:
 
@@ -128,7 +142,7 @@ public:
   {
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
-    increment_destructor_count(typeid(T).name());
+    increment_destructor_count(counter_slot());
 
 #endif
   }
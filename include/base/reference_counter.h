@@ -26,9 +26,13 @@
 #include "libmesh/libmesh.h" // libMesh::on_command_line
 
 // C++ includes
+#include <atomic>
+#include <deque>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <map>
+#include <vector>
 
 namespace libMesh
 {
@@ -80,8 +84,7 @@ public:
    * Prints the number of outstanding (created, but not yet
    * destroyed) objects.
    */
-  static unsigned int n_objects ()
-  { return _n_objects; }
+  static unsigned int n_objects ();
 
   /**
    * Methods to enable/disable the reference counter output
@@ -96,41 +99,114 @@ protected:
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 
   /**
-   * Increments the construction counter. Should be called in
-   * the constructor of any derived class that will be
-   * reference counted.
+   * \returns The slot holding the counts of the class named \p name,
+   * giving it a new one the first time it is seen.  Derived classes
+   * should look theirs up once rather than on every construction.
    */
-  void increment_constructor_count (const std::string & name);
+  static unsigned int register_counter (const std::string & name);
 
   /**
-   * Increments the destruction counter. Should be called in
-   * the destructor of any derived class that will be
-   * reference counted.
+   * Increments the construction counter in \p slot. Should be called
+   * in the constructor of any derived class that will be reference
+   * counted.
    */
-  void increment_destructor_count (const std::string & name);
+  void increment_constructor_count (unsigned int slot);
 
   /**
-   * Data structure to log the information.  The log is
-   * identified by the class name.
+   * Increments the destruction counter in \p slot. Should be called
+   * in the destructor of any derived class that will be reference
+   * counted.
    */
-  typedef std::map<std::string, std::pair<unsigned int,
-                                          unsigned int>> Counts;
+  void increment_destructor_count (unsigned int slot);
+
+#endif
 
   /**
-   * Actually holds the data.
+   * The counts kept by a single thread.  Only that thread ever
+   * changes them, so it needs no locking to do so; the atomics only
+   * make it safe for \p get_info() and \p n_objects() to read them
+   * from elsewhere while they are summing up every thread's counts.
    */
-  static Counts _counts;
+  struct ThreadCounts
+  {
+    ThreadCounts () : n_objects(0) {}
+
+    /**
+     * Objects created minus objects destroyed on this thread, which
+     * may be negative if objects are destroyed by another thread than
+     * the one which created them.
+     */
+    std::atomic<long> n_objects;
+
+#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+
+    struct Counts
+    {
+      Counts () : creations(0), destructions(0) {}
+      std::atomic<unsigned int> creations;
+      std::atomic<unsigned int> destructions;
+    };
+
+    /**
+     * The creations and destructions on this thread of each class,
+     * indexed by its slot.  A deque, so that growing it doesn't move
+     * the counts.
+     */
+    std::deque<Counts> counts;
 
 #endif
+  };
+
+  /**
+   * \returns The counts of the calling thread.
+   */
+  static ThreadCounts & thread_counts ();
 
   /**
-   * The number of objects.  Print the reference count
-   * information when the number returns to 0.
+   * Adds \p change to a counter which only the calling thread changes.
    */
-  static Threads::atomic<unsigned int> _n_objects;
+  template <typename T>
+  static void bump (std::atomic<T> & counter, T change = 1)
+  { counter.store(counter.load(std::memory_order_relaxed) + change,
+                  std::memory_order_relaxed); }
+
+private:
 
   /**
-   * Mutual exclusion object to enable thread-safe reference counting.
+   * Creates the counts of the calling thread the first time it needs
+   * them.
+   */
+  static ThreadCounts & register_thread ();
+
+#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+
+  /**
+   * Makes room in the counts of the calling thread for \p slot.
+   */
+  static void grow_counts (ThreadCounts & counts, unsigned int slot);
+
+  /**
+   * The name of the class counted in each slot.
+   */
+  static std::vector<std::string> _counter_names;
+
+#endif
+
+  /**
+   * The counts of every thread which has created or destroyed an
+   * object.  They are kept after their threads finish, so that no
+   * creation or destruction is forgotten.
+   */
+  static std::vector<std::unique_ptr<ThreadCounts>> _all_thread_counts;
+
+  /**
+   * The counts of the calling thread, once it has some.
+   */
+  static thread_local ThreadCounts * _my_thread_counts;
+
+  /**
+   * Mutual exclusion object protecting the list of threads and the
+   * names of the counted classes.
    */
   static Threads::spin_mutex _mutex;
 
@@ -147,28 +223,37 @@ protected:
 // ReferenceCounter class inline methods
 inline ReferenceCounter::ReferenceCounter()
 {
-  ++_n_objects;
+  bump(thread_counts().n_objects, 1l);
 }
 
 
 
 inline ReferenceCounter::ReferenceCounter(const ReferenceCounter & /*other*/)
 {
-  ++_n_objects;
+  bump(thread_counts().n_objects, 1l);
 }
 
 
 
 inline ReferenceCounter::ReferenceCounter(ReferenceCounter && /*other*/) noexcept
 {
-  ++_n_objects;
+  bump(thread_counts().n_objects, 1l);
 }
 
 
 
 inline ReferenceCounter::~ReferenceCounter()
 {
-  --_n_objects;
+  bump(thread_counts().n_objects, -1l);
+}
+
+
+
+inline ReferenceCounter::ThreadCounts & ReferenceCounter::thread_counts()
+{
+  if (_my_thread_counts)
+    return *_my_thread_counts;
+  return register_thread();
 }
 
 
@@ -178,12 +263,13 @@ inline ReferenceCounter::~ReferenceCounter()
 
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 inline
-void ReferenceCounter::increment_constructor_count (const std::string & name)
+void ReferenceCounter::increment_constructor_count (unsigned int slot)
 {
-  Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-  std::pair<unsigned int, unsigned int> & p = _counts[name];
+  ThreadCounts & counts = thread_counts();
+  if (slot >= counts.counts.size())
+    grow_counts(counts, slot);
 
-  p.first++;
+  bump(counts.counts[slot].creations);
 }
 #endif
 
@@ -191,12 +277,13 @@ void ReferenceCounter::increment_constructor_count (const std::string & name)
 
 #if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
 inline
-void ReferenceCounter::increment_destructor_count (const std::string & name)
+void ReferenceCounter::increment_destructor_count (unsigned int slot)
 {
-  Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-  std::pair<unsigned int, unsigned int> & p = _counts[name];
+  ThreadCounts & counts = thread_counts();
+  if (slot >= counts.counts.size())
+    grow_counts(counts, slot);
 
-  p.second++;
+  bump(counts.counts[slot].destructions);
 }
 #endif
 
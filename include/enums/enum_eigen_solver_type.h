@@ -37,6 +37,7 @@ enum EigenSolverType : int {
                       ARNOLDI,
                       LANCZOS,
                       KRYLOVSCHUR,
+                      LOBPCG,
                       // Invalid
                       INVALID_EIGENSOLVER};
 
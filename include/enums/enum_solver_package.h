@@ -39,6 +39,8 @@ enum SolverPackage : int
     SLEPC_SOLVERS,
     EIGEN_SOLVERS,
     NLOPT_SOLVERS,
+    NATIVE_SOLVERS,
+    TPETRA_SOLVERS,
     // Invalid
     INVALID_SOLVER_PACKAGE
   };
@@ -103,6 +103,18 @@ public:
    */
   std::string error_plot_suffix;
 
+  /**
+   * If the dual subestimator is a \p JumpErrorEstimator and no
+   * per-variable weighting is requested, it estimates the error in
+   * every weighted adjoint solution in a single loop over the mesh,
+   * sharing the FE reinitialization on each side among them.
+   *
+   * Setting this flag (default: false) has the dual subestimator
+   * estimate the primal error in that same loop too, in which case
+   * the primal subestimator is not used.
+   */
+  bool use_dual_estimator_for_primal;
+
   /**
    * Compute the adjoint-weighted error on each element and place it
    * in the \p error_per_cell vector.
@@ -200,6 +200,14 @@ public:
   void compute_error(const std::string & sys_name,
                      const std::string & unknown_name);
 
+  /**
+   * Computes and stores the errors for every variable of the system
+   * \p sys_name, as compute_error() would, but in a single sweep
+   * over the mesh.  Element data shared by variables of the same
+   * FEType is only computed once per element.
+   */
+  void compute_errors(const std::string & sys_name);
+
   /**
    * \returns The integrated L2 error for the system \p sys_name for the
    * unknown \p unknown_name.
@@ -296,16 +304,21 @@ public:
                   const FEMNormType & norm);
 private:
 
+  /**
+   * Threaded element integrator used by _compute_errors().
+   */
+  class ErrorIntegrator;
+  friend class ErrorIntegrator;
+
   /**
    * This function computes the error (in the solution and its first
-   * derivative) for a single unknown in a single system.  It is a
-   * private function since it is used by the implementation when
-   * solving for several unknowns in several systems.
-   */
-  template<typename OutputShape>
-  void _compute_error(const std::string & sys_name,
-                      const std::string & unknown_name,
-                      std::vector<Real> & error_vals);
+   * derivative) for several unknowns in a single system, with one
+   * threaded sweep over the elements.  It is a private function since
+   * it is used by the implementation when solving for several
+   * unknowns in several systems.
+   */
+  void _compute_errors(const std::string & sys_name,
+                       const std::vector<std::string> & unknown_names);
 
   /**
    * This function is responsible for checking the validity of the \p
@@ -66,6 +66,18 @@ public:
   virtual ErrorEstimatorType type() const override;
 
 protected:
+  /**
+   * \returns \p true unless this is an object of a derived class,
+   * whose overrides clone() wouldn't copy.
+   */
+  virtual bool supports_threads() const override;
+
+  /**
+   * \returns A new estimator with the same settings as this one,
+   * for use on other threads.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
 
   /**
    * An initialization function, for requesting specific data from the FE
@@ -77,17 +77,13 @@ public:
   }
 
   /**
-   * This class cannot be (default) copy constructed/assigned because
-   * it has unique_ptr members. Explicitly deleting these functions is
-   * the best way to document this fact.
-   */
-  HPCoarsenTest (const HPCoarsenTest &) = delete;
-  HPCoarsenTest & operator= (const HPCoarsenTest &) = delete;
-
-  /**
-   * Defaulted move ctor, move assignment operator, and destructor.
+   * Copy/move ctor, copy/move assignment operator, and destructor are
+   * all explicitly defaulted; the finite element scratch data is
+   * built anew by each \p select_refinement().
    */
+  HPCoarsenTest (const HPCoarsenTest &) = default;
   HPCoarsenTest (HPCoarsenTest &&) = default;
+  HPCoarsenTest & operator= (const HPCoarsenTest &) = default;
   HPCoarsenTest & operator= (HPCoarsenTest &&) = default;
   virtual ~HPCoarsenTest() = default;
 
@@ -107,60 +103,91 @@ public:
 
 protected:
   /**
-   * The helper function which adds individual fine element data to
-   * the coarse element projection
-   */
-  void add_projection(const System &, const Elem *, unsigned int var);
-
-  /**
-   * The coarse element on which a solution projection is cached
-   */
-  Elem * coarse;
-
-  /**
-   * Global DOF indices for fine elements
-   */
-  std::vector<dof_id_type> dof_indices;
-
-  /**
-   * The finite element objects for fine and coarse elements
+   * The finite element objects, cached coarse projection and linear
+   * systems used to test one variable; each thread testing elements
+   * has its own.
    */
-  std::unique_ptr<FEBase> fe, fe_coarse;
-
-  /**
-   * The shape functions and their derivatives
-   */
-  const std::vector<std::vector<Real>> * phi, * phi_coarse;
-  const std::vector<std::vector<RealGradient>> * dphi, * dphi_coarse;
-  const std::vector<std::vector<RealTensor>> * d2phi, * d2phi_coarse;
-
-  /**
-   * Mapping jacobians
-   */
-  const std::vector<Real> * JxW;
+  struct ProjectionData
+  {
+    ProjectionData() :
+      coarse(nullptr),
+      coarse_p_level(0),
+      phi(nullptr), phi_coarse(nullptr),
+      dphi(nullptr), dphi_coarse(nullptr),
+      d2phi(nullptr), d2phi_coarse(nullptr),
+      JxW(nullptr),
+      xyz_values(nullptr)
+    {}
+
+    /**
+     * The coarse element on which a solution projection is cached,
+     * and the p level it was projected at
+     */
+    Elem * coarse;
+    unsigned int coarse_p_level;
+
+    /**
+     * Global DOF indices for fine elements
+     */
+    std::vector<dof_id_type> dof_indices;
+
+    /**
+     * The finite element objects for fine and coarse elements
+     */
+    std::unique_ptr<FEBase> fe, fe_coarse;
+
+    /**
+     * The shape functions and their derivatives
+     */
+    const std::vector<std::vector<Real>> * phi, * phi_coarse;
+    const std::vector<std::vector<RealGradient>> * dphi, * dphi_coarse;
+    const std::vector<std::vector<RealTensor>> * d2phi, * d2phi_coarse;
+
+    /**
+     * Mapping jacobians
+     */
+    const std::vector<Real> * JxW;
+
+    /**
+     * Quadrature locations
+     */
+    const std::vector<Point> * xyz_values;
+    std::vector<Point> coarse_qpoints;
+
+    /**
+     * The quadrature rule for the fine element
+     */
+    std::unique_ptr<QBase> qrule;
+
+    /**
+     * Linear system for projections
+     */
+    DenseMatrix<Number> Ke;
+    DenseVector<Number> Fe;
+
+    /**
+     * Coefficients for projected coarse and projected
+     * p-derefined solutions
+     */
+    DenseVector<Number> Uc;
+    DenseVector<Number> Up;
+  };
 
   /**
-   * Quadrature locations
+   * The helper function which adds individual fine element data to
+   * the coarse element projection
    */
-  const std::vector<Point> * xyz_values;
-  std::vector<Point> coarse_qpoints;
+  void add_projection(const System &, const Elem *, unsigned int var,
+                      ProjectionData & data) const;
 
-  /**
-   * The quadrature rule for the fine element
-   */
-  std::unique_ptr<QBase> qrule;
+private:
 
   /**
-   * Linear system for projections
-   */
-  DenseMatrix<Number> Ke;
-  DenseVector<Number> Fe;
-  /**
-   * Coefficients for projected coarse and projected
-   * p-derefined solutions
+   * The threaded body of \p select_refinement(), which computes the
+   * h and p coarsening errors of the flagged elements of whole
+   * element trees at a time.
    */
-  DenseVector<Number> Uc;
-  DenseVector<Number> Up;
+  class CoarseningErrors;
 };
 
 } // namespace libMesh
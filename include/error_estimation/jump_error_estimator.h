@@ -24,12 +24,14 @@
 #include "libmesh/dense_vector.h"
 #include "libmesh/error_estimator.h"
 #include "libmesh/fem_context.h"
+#include "libmesh/elem_range.h"
 
 // C++ includes
 #include <cstddef>
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace libMesh
 {
@@ -88,6 +90,21 @@ public:
                                const NumericVector<Number> * solution_vector = nullptr,
                                bool estimate_parent_error = false) override;
 
+  /**
+   * Estimates the error in each of \p solution_vectors, placing the
+   * estimate for the k-th in \p errors_per_cell[k], in a single loop
+   * over the mesh.  The FE data on each side is computed once and
+   * reused for every vector; only the element coefficients change.
+   * An entry of \p nullptr stands for \p system.solution.
+   *
+   * Each result matches what \p estimate_error() would give for that
+   * vector alone.
+   */
+  void estimate_solution_errors (const System & system,
+                                 const std::vector<const NumericVector<Number> *> & solution_vectors,
+                                 std::vector<ErrorVector> & errors_per_cell,
+                                 bool estimate_parent_error = false);
+
   /**
    * This boolean flag allows you to scale the error indicator
    * result for each element by the number of "flux faces" the element
@@ -130,6 +147,36 @@ protected:
    */
   virtual void init_context(FEMContext & c);
 
+  /**
+   * \returns \p true if clone() can build copies of this estimator
+   * for estimate_error() to integrate side jumps on separate threads.
+   *
+   * The default implementation returns \p false, in which case the
+   * side loop is executed serially.  Derived classes which override
+   * this to return \p true must also override clone(), and should
+   * return \p false for any further derived class clone() doesn't
+   * build.
+   */
+  virtual bool supports_threads() const;
+
+  /**
+   * Derived classes which can be evaluated concurrently should
+   * override this to return a new estimator of the same type, with
+   * the same settings but with its own (not yet initialized) FE
+   * contexts.  estimate_error() integrates side jumps on separate
+   * threads with one clone per task, if supports_threads().
+   *
+   * The default implementation returns \p nullptr.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const;
+
+  /**
+   * Copies the ErrorEstimator and JumpErrorEstimator settings of
+   * \p other into this object; intended for use by clone()
+   * implementations.
+   */
+  void copy_jump_settings (const JumpErrorEstimator & other);
+
   /**
    * The function, to be implemented by derived classes, which calculates an error
    * term on an internal side
@@ -166,6 +213,84 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+
+  /**
+   * The error and flux face contributions computed from the sides of
+   * a single active element, in the order they were computed.  These
+   * are accumulated into the global vectors afterwards, in element
+   * order, so threaded and serial runs give identical sums.  There is
+   * one list of error contributions per solution vector being
+   * estimated.
+   */
+  struct ElemContributions
+  {
+    std::vector<std::vector<std::pair<dof_id_type, ErrorVectorReal>>> error;
+    std::vector<std::pair<dof_id_type, float>> flux_faces;
+  };
+
+  /**
+   * Builds \p fine_context and \p coarse_context for \p system and
+   * requests the FE data needed by this estimator.
+   */
+  void init_side_contexts (const System & system);
+
+  /**
+   * Integrates the jumps across each side of the active element \p e
+   * (and, if \p compute_on_parent is true, across each side of its
+   * parent) and appends the results to \p contributions.
+   *
+   * The first solution is the one the contexts are reinitialized
+   * with; each further entry of \p local_solutions is a ghosted copy
+   * of another solution vector whose jumps are integrated too.
+   */
+  void compute_elem_contributions (const System & system,
+                                   const Elem & e,
+                                   bool compute_on_parent,
+                                   const std::vector<const NumericVector<Number> *> & local_solutions,
+                                   ElemContributions & contributions);
+
+  /**
+   * Sets the element coefficients of \p c to those of solution \p k:
+   * \p primary_solution for the first solution, or the values
+   * gathered from \p local_solutions[k] otherwise.
+   */
+  static void set_elem_solution (FEMContext & c,
+                                 unsigned int k,
+                                 const DenseVector<Number> & primary_solution,
+                                 const std::vector<const NumericVector<Number> *> & local_solutions);
+
+  /**
+   * Class to compute the error contributions for a range of
+   * elements.  May be executed in parallel on separate threads.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System & sys,
+                   const JumpErrorEstimator & ee,
+                   const std::vector<bool> & cop,
+                   const std::vector<const NumericVector<Number> *> & ls,
+                   std::vector<ElemContributions> & contribs) :
+      system(sys),
+      error_estimator(ee),
+      compute_on_parent(cop),
+      local_solutions(ls),
+      contributions(contribs)
+    {}
+
+    void operator()(const ConstElemRange & range) const;
+
+  private:
+    const System & system;
+    const JumpErrorEstimator & error_estimator;
+    const std::vector<bool> & compute_on_parent;
+    const std::vector<const NumericVector<Number> *> & local_solutions;
+    std::vector<ElemContributions> & contributions;
+  };
+
+  friend class EstimateError;
 };
 
 
@@ -83,6 +83,10 @@ public:
 
   /**
    * Register a user function to use in computing the flux BCs.
+   *
+   * With more than one thread, the side loop of estimate_error()
+   * calls \p fptr concurrently from several threads, so it must be
+   * thread safe.
    */
   void attach_flux_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                           const Point & p,
@@ -91,6 +95,18 @@ public:
   virtual ErrorEstimatorType type() const override;
 
 protected:
+  /**
+   * \returns \p true unless this is an object of a derived class,
+   * whose overrides clone() wouldn't copy.
+   */
+  virtual bool supports_threads() const override;
+
+  /**
+   * \returns A new estimator with the same settings as this one,
+   * for use on other threads.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
 
   /**
    * An initialization function, for requesting specific data from the FE
@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <set>
 #include <vector>
 
 #ifdef LIBMESH_ENABLE_AMR
@@ -120,6 +121,24 @@ public:
    */
   unsigned char number_p_refinements;
 
+  /**
+   * The ids of elements around which to refine.  If this is empty,
+   * the default, the whole mesh is refined.  Otherwise only patches
+   * of local elements built around these are refined before the
+   * solve, and only the elements in those patches get an error
+   * estimate, so the refined mesh only grows by the patch sizes.
+   *
+   * The same set must be given on every processor.
+   */
+  std::set<dof_id_type> patch_elements;
+
+  /**
+   * The number of elements each patch around an element of
+   * \p patch_elements should reach, if there are enough local
+   * neighbors.  Defaults to 1, refining only the elements themselves.
+   */
+  unsigned int target_patch_size;
+
 protected:
   /**
    * The code for estimate_error and both estimate_errors versions is very
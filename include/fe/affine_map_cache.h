@@ -0,0 +1,118 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_AFFINE_MAP_CACHE_H
+#define LIBMESH_AFFINE_MAP_CACHE_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class MeshBase;
+
+/**
+ * This class stores the constant Jacobian, its inverse and its
+ * determinant for every element of a mesh which has an affine map,
+ * in a side array indexed by element id.  An \p FEMap with a cache
+ * attached (see \p FEMap::set_affine_map_cache()) copies these
+ * values on cached elements instead of recomputing the map, which
+ * saves most of the geometry work of repeated assembly sweeps over
+ * meshes of mostly affine elements (\p TET4, parallelepiped \p HEX8,
+ * etc.)
+ *
+ * The cache knows nothing about mesh motion: after moving nodes or
+ * otherwise changing the mesh, call \p update() (or \p clear()) before
+ * the next reinit.  Debug builds check each cached entry against the
+ * element it is used on.
+ */
+class AffineMapCache
+{
+public:
+
+  /**
+   * The map data for one affine element, in the same shape as the
+   * corresponding \p FEMap quadrature point values.
+   */
+  struct Entry
+  {
+    RealGradient dxyzdxi, dxyzdeta, dxyzdzeta;
+    Real dxidx, dxidy, dxidz;
+    Real detadx, detady, detadz;
+    Real dzetadx, dzetady, dzetadz;
+    Real jac;
+  };
+
+  /**
+   * Constructor.  Computes the entries for every active element of
+   * \p mesh.
+   */
+  explicit
+  AffineMapCache (const MeshBase & mesh);
+
+  /**
+   * Recomputes the entries for every active element of the mesh,
+   * e.g. after the mesh has been moved or refined.
+   */
+  void update ();
+
+  /**
+   * Removes all entries, so that every element will have its map
+   * recomputed as usual.
+   */
+  void clear ();
+
+  /**
+   * \returns The cached map data for \p elem, or a null pointer if
+   * \p elem is not affine or not in the cache.
+   */
+  const Entry * find (const Elem & elem) const;
+
+  /**
+   * \returns The number of elements with cached map data.
+   */
+  dof_id_type n_cached () const;
+
+private:
+
+  const MeshBase & _mesh;
+
+  /**
+   * The cached map data, indexed by element id.
+   */
+  std::vector<Entry> _entries;
+
+  /**
+   * Whether each entry of \p _entries holds valid data.  A
+   * std::vector<bool> would not be safe to fill from several threads.
+   */
+  std::vector<unsigned char> _cached;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_AFFINE_MAP_CACHE_H
@@ -0,0 +1,134 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_COEFFICIENT_CACHE_H
+#define LIBMESH_ELEM_COEFFICIENT_CACHE_H
+
+// libMesh includes
+#include "libmesh/elem.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class template caches per-element data which depends only
+ * on an element's geometry, such as the transformations from
+ * reference to physical degrees of freedom of the \p CLOUGH and
+ * \p HERMITE families.  Entries are keyed by element and remember
+ * the node locations they were computed from; an entry whose element
+ * has since been moved (or deleted and its memory reused) is simply
+ * recomputed, so callers never need to invalidate the cache by hand.
+ *
+ * A cache is not itself thread-safe.  The shape function code keeps
+ * one per thread, which lets threaded assembly reuse coefficients
+ * without any locking, and lets elements be visited in any order
+ * (e.g. an element and its neighbors on a DG face) without the
+ * coefficients of one evicting those of another.
+ */
+template <typename Coefs>
+class ElemCoefficientCache
+{
+public:
+
+  /**
+   * \returns The coefficients for \p elem, computed by
+   * \p compute(elem, coefs) if they are not cached or are out of
+   * date.
+   */
+  template <typename Compute>
+  const Coefs & get (const Elem & elem, Compute compute)
+  {
+    auto it = _entries.find(&elem);
+    if (it != _entries.end() && it->second.matches(elem))
+      return it->second.coefs;
+
+    // Keep the memory use of long runs on large meshes bounded;
+    // starting over is no worse than never having cached at all.
+    if (it == _entries.end() && _entries.size() >= max_entries)
+      {
+        _entries.clear();
+        it = _entries.end();
+      }
+
+    if (it == _entries.end())
+      it = _entries.emplace(&elem, Entry()).first;
+
+    Entry & entry = it->second;
+    entry.store(elem);
+    compute(&elem, entry.coefs);
+    return entry.coefs;
+  }
+
+  /**
+   * Removes every entry from the cache.
+   */
+  void clear () { _entries.clear(); }
+
+  /**
+   * \returns The number of cached elements.
+   */
+  std::size_t size () const { return _entries.size(); }
+
+  /**
+   * The most elements a cache holds before it starts over.
+   */
+  static const std::size_t max_entries = 1 << 16;
+
+private:
+
+  struct Entry
+  {
+    Coefs coefs;
+    ElemType type;
+    ElemMappingType mapping_type;
+    std::vector<Point> points;
+
+    bool matches (const Elem & elem) const
+    {
+      if (elem.type() != type ||
+          elem.mapping_type() != mapping_type ||
+          elem.n_nodes() != points.size())
+        return false;
+      for (auto n : index_range(points))
+        if (elem.point(n) != points[n])
+          return false;
+      return true;
+    }
+
+    void store (const Elem & elem)
+    {
+      type = elem.type();
+      mapping_type = elem.mapping_type();
+      points.resize(elem.n_nodes());
+      for (auto n : index_range(points))
+        points[n] = elem.point(n);
+    }
+  };
+
+  std::unordered_map<const Elem *, Entry> _entries;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_COEFFICIENT_CACHE_H
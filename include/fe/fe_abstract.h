@@ -26,6 +26,7 @@
 #include "libmesh/vector_value.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/fe_map.h"
+#include "libmesh/elem_side_builder.h"
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
 #include "libmesh/tensor_value.h"
 #endif
@@ -595,9 +596,26 @@ protected:
    * Should we calculate shape function hessians?
    */
   mutable bool calculate_d2phi;
+
+  /**
+   * Should we map the hessians to physical space as full tensors
+   * (\p d2phi)?
+   */
+  mutable bool calculate_d2phi_tensor;
+
+  /**
+   * Should we map the hessians to physical space in symmetric packed
+   * form, i.e. just their independent components (\p d2phidx2,
+   * \p d2phidxdy, etc.)?  When neither this nor
+   * \p calculate_d2phi_tensor is set, only the reference space
+   * hessians are computed.
+   */
+  mutable bool calculate_d2phi_components;
 #else
   // Otherwise several interfaces need to be redone.
   const bool calculate_d2phi=false;
+  const bool calculate_d2phi_tensor=false;
+  const bool calculate_d2phi_components=false;
 
 #endif
 
@@ -647,6 +665,12 @@ protected:
    */
   bool shapes_on_quadrature;
 
+  /**
+   * Builds the sides and edges for side and edge reinit() without
+   * allocating a new one each time.
+   */
+  ElemSideBuilder _side_builder;
+
   /**
    * \returns \p true when the shape functions (for
    * this \p FEFamily) depend on the particular
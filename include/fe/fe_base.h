@@ -317,60 +317,67 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputTensor>> & get_d2phi() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phi; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_tensor);
+    calculate_d2phi = calculate_d2phi_tensor = calculate_dphiref = true; return d2phi; }
 
   const std::vector<std::vector<OutputTensor>> & get_dual_d2phi() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dual = calculate_dphiref = true; return dual_d2phi; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_tensor);
+    calculate_d2phi = calculate_d2phi_tensor = calculate_dual = calculate_dphiref = true; return dual_d2phi; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
    * points.
+   *
+   * \note This and the other independent components of the hessians
+   * (\p get_d2phidxdy(), etc.) are computed only if requested, and
+   * independently of the full tensors from \p get_d2phi().  Codes
+   * which only need a few physical second derivatives, or which want
+   * hessians in symmetric packed form, save the memory and the time
+   * to fill 9 entries per shape function and point by using these.
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidx2() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidx2; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_components);
+    calculate_d2phi = calculate_d2phi_components = calculate_dphiref = true; return d2phidx2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
    * points.
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidxdy() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidxdy; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_components);
+    calculate_d2phi = calculate_d2phi_components = calculate_dphiref = true; return d2phidxdy; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
    * points.
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidxdz() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidxdz; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_components);
+    calculate_d2phi = calculate_d2phi_components = calculate_dphiref = true; return d2phidxdz; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
    * points.
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidy2() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi =  calculate_dphiref = true; return d2phidy2; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_components);
+    calculate_d2phi = calculate_d2phi_components = calculate_dphiref = true; return d2phidy2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
    * points.
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidydz() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidydz; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_components);
+    calculate_d2phi = calculate_d2phi_components = calculate_dphiref = true; return d2phidydz; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
    * points.
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidz2() const
-  { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidz2; }
+  { libmesh_assert(!calculations_started || calculate_d2phi_components);
+    calculate_d2phi = calculate_d2phi_components = calculate_dphiref = true; return d2phidz2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -562,6 +569,13 @@ protected:
   std::vector<std::vector<OutputShape>>   phi;
   std::vector<std::vector<OutputShape>>   dual_phi;
 
+  /**
+   * Whether \p phi was copied from the \p FEShapeCache, in which case
+   * it already holds the (element independent) values that
+   * \p compute_shape_functions() would otherwise map again.
+   */
+  bool phi_from_shape_cache;
+
   /**
    * Shape function derivative values.
    */
@@ -778,6 +792,7 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   _fe_trans( FETransformationBase<OutputType>::build(fet) ),
   phi(),
   dual_phi(),
+  phi_from_shape_cache(false),
   dphi(),
   dual_dphi(),
   curl_phi(),
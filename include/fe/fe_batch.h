@@ -0,0 +1,185 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_BATCH_H
+#define LIBMESH_FE_BATCH_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_base.h"
+#include "libmesh/fe_type.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class QBase;
+
+/**
+ * This class evaluates a real-valued scalar finite element space on
+ * a batch of elements at once.  Unlike \p FE::reinit(), which works
+ * one element at a time, \p reinit() here fills arrays in a
+ * structure-of-arrays layout in which the element index varies
+ * fastest, so that element kernels can loop (and vectorize) across
+ * the elements of a batch rather than across the few quadrature
+ * points of a single element.
+ *
+ * All elements in a batch must have the same type, p level and
+ * dimension.  For Lagrange-mapped elements and families whose
+ * reference shape functions don't depend on the element (\p
+ * LAGRANGE, \p L2_LAGRANGE and \p MONOMIAL), the reference values
+ * are computed once per batch and the maps and gradients are then
+ * computed for all elements together.  Other elements and families
+ * fall back on one \p FE::reinit() per element, with the results
+ * copied into the same layout.
+ */
+class FEBatch
+{
+public:
+
+  /**
+   * Constructor.  Builds the underlying finite element object of
+   * dimension \p dim and type \p fe_type.
+   */
+  FEBatch (const unsigned int dim,
+           const FEType & fe_type);
+
+  /**
+   * Provides the quadrature rule to use on every element of a batch.
+   */
+  void attach_quadrature_rule (QBase * q);
+
+  /**
+   * Computes the shape functions, their gradients and the JxW values
+   * at the quadrature points of every element in \p elems.
+   */
+  void reinit (const std::vector<const Elem *> & elems);
+
+  /**
+   * \returns The number of elements in the current batch.
+   */
+  unsigned int n_elem() const { return _n_elem; }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_qp() const { return _n_qp; }
+
+  /**
+   * \returns The number of shape functions per element.
+   */
+  unsigned int n_shape_functions() const { return _n_shape; }
+
+  /**
+   * \returns The index of shape function \p i at quadrature point \p
+   * qp on batch element \p e in the shape function arrays.
+   */
+  std::size_t index (unsigned int i,
+                     unsigned int qp,
+                     unsigned int e) const
+  { return (std::size_t(i) * _n_qp + qp) * _n_elem + e; }
+
+  /**
+   * \returns The index of quadrature point \p qp on batch element \p
+   * e in the \p JxW array.
+   */
+  std::size_t qp_index (unsigned int qp,
+                        unsigned int e) const
+  { return std::size_t(qp) * _n_elem + e; }
+
+  /**
+   * \returns The shape function values, indexed by \p index().
+   */
+  const std::vector<Real> & get_phi() const { return _phi; }
+
+  /**
+   * \returns Component \p d of the shape function gradients, indexed
+   * by \p index().
+   */
+  const std::vector<Real> & get_dphi(unsigned int d) const
+  { libmesh_assert_less (d, LIBMESH_DIM); return _dphi[d]; }
+
+  /**
+   * \returns The element Jacobian times the quadrature weight,
+   * indexed by \p qp_index().
+   */
+  const std::vector<Real> & get_JxW() const { return _JxW; }
+
+private:
+
+  /**
+   * Computes everything on \p elems element by element.
+   */
+  void reinit_each (const std::vector<const Elem *> & elems);
+
+  /**
+   * Computes the maps and gradients for all of \p elems together,
+   * from the reference values on the first of them.
+   */
+  void reinit_batched (const std::vector<const Elem *> & elems);
+
+  /**
+   * The dimension of the elements.
+   */
+  const unsigned int _dim;
+
+  /**
+   * The finite element object used to get reference values, or
+   * values on each element in the fallback case.
+   */
+  std::unique_ptr<FEBase> _fe;
+
+  /**
+   * The quadrature rule used on every element.
+   */
+  QBase * _qrule;
+
+  /**
+   * Whether the reference shape functions are the same on every
+   * element of a given type and p level.
+   */
+  const bool _shapes_are_reference;
+
+  unsigned int _n_elem;
+  unsigned int _n_qp;
+  unsigned int _n_shape;
+
+  std::vector<Real> _phi;
+  std::vector<Real> _dphi[LIBMESH_DIM];
+  std::vector<Real> _JxW;
+
+  /**
+   * Scratch space for the batched map: node coordinates, the
+   * Jacobian, and its (generalized) inverse at a single quadrature
+   * point, each stored with the element index varying fastest.
+   */
+  std::vector<Real> _node_xyz;
+  std::vector<Real> _dxyzdxi;
+  std::vector<Real> _dxidxyz;
+  std::vector<Real> _jac;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_BATCH_H
@@ -0,0 +1,278 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_FE_LAGRANGE_KERNELS_H
+#define LIBMESH_FE_LAGRANGE_KERNELS_H
+
+// Local includes
+#include "libmesh/fe_lagrange_shape_1D.h"
+#include "libmesh/int_range.h"
+
+// C++ includes
+#include <vector>
+
+// Lagrange shape function kernels for the most common element types
+// and orders, with the element type and order fixed at compile time.
+// The vectorized FE<Dim,LAGRANGE> shape evaluations choose one of
+// these once per call, rather than switching on the element type and
+// order again for every shape function at every point.
+
+namespace libMesh
+{
+
+/**
+ * Node numberings for the tensor-product kernels: the 1D node each
+ * shape function uses in each direction.
+ */
+struct Quad4Nodes
+{
+  static const unsigned int n_shapes = 4;
+  static unsigned int node (unsigned int d, unsigned int i)
+  {
+    //                                      0  1  2  3
+    static const unsigned int nodes[2][4] = {{0, 1, 1, 0},
+                                             {0, 0, 1, 1}};
+    return nodes[d][i];
+  }
+};
+
+struct Quad9Nodes
+{
+  static const unsigned int n_shapes = 9;
+  static unsigned int node (unsigned int d, unsigned int i)
+  {
+    //                                      0  1  2  3  4  5  6  7  8
+    static const unsigned int nodes[2][9] = {{0, 1, 1, 0, 2, 1, 2, 0, 2},
+                                             {0, 0, 1, 1, 0, 2, 1, 2, 2}};
+    return nodes[d][i];
+  }
+};
+
+struct Hex8Nodes
+{
+  static const unsigned int n_shapes = 8;
+  static unsigned int node (unsigned int d, unsigned int i)
+  {
+    //                                      0  1  2  3  4  5  6  7
+    static const unsigned int nodes[3][8] = {{0, 1, 1, 0, 0, 1, 1, 0},
+                                             {0, 0, 1, 1, 0, 0, 1, 1},
+                                             {0, 0, 0, 0, 1, 1, 1, 1}};
+    return nodes[d][i];
+  }
+};
+
+struct Hex27Nodes
+{
+  static const unsigned int n_shapes = 27;
+  static unsigned int node (unsigned int d, unsigned int i)
+  {
+    //                                        0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26
+    static const unsigned int nodes[3][27] = {{0, 1, 1, 0, 0, 1, 1, 0, 2, 1, 2, 0, 0, 1, 1, 0, 2, 1, 2, 0, 2, 2, 1, 2, 0, 2, 2},
+                                              {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 1, 2, 0, 0, 1, 1, 0, 2, 1, 2, 2, 0, 2, 1, 2, 2, 2},
+                                              {0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 2, 2, 1, 1, 1, 1, 0, 2, 2, 2, 2, 1, 2}};
+    return nodes[d][i];
+  }
+};
+
+
+
+/**
+ * Tensor products of the 1D Lagrange shape functions of order \p O
+ * on the hypercube, numbered as \p Nodes says.
+ */
+template <unsigned int Dim, Order O, typename Nodes>
+struct TensorLagrangeKernel
+{
+  static const unsigned int n_shapes = Nodes::n_shapes;
+
+  static Real shape (unsigned int i, const Point & p)
+  {
+    Real value = 1;
+    for (unsigned int d=0; d != Dim; ++d)
+      value *= fe_lagrange_1D_shape(O, Nodes::node(d,i), p(d));
+    return value;
+  }
+
+  static Real shape_deriv (unsigned int i, unsigned int j, const Point & p)
+  {
+    libmesh_assert_less (j, Dim);
+
+    Real value = 1;
+    for (unsigned int d=0; d != Dim; ++d)
+      value *= (d == j) ?
+        fe_lagrange_1D_shape_deriv(O, Nodes::node(d,i), 0, p(d)) :
+        fe_lagrange_1D_shape(O, Nodes::node(d,i), p(d));
+    return value;
+  }
+
+  // Fills phi with every shape function at p, evaluating each 1D
+  // factor only once
+  static void shapes (const Point & p, Real * phi)
+  {
+    Real factors[Dim][O+1];
+    for (unsigned int d=0; d != Dim; ++d)
+      for (unsigned int a=0; a != O+1; ++a)
+        factors[d][a] = fe_lagrange_1D_shape(O, a, p(d));
+    for (unsigned int i=0; i != n_shapes; ++i)
+      {
+        phi[i] = factors[0][Nodes::node(0,i)];
+        for (unsigned int d=1; d != Dim; ++d)
+          phi[i] *= factors[d][Nodes::node(d,i)];
+      }
+  }
+};
+
+
+
+/**
+ * Linear and quadratic Lagrange shape functions on the reference
+ * triangle or tetrahedron, in terms of the area coordinates of \p p.
+ */
+template <unsigned int Dim, Order O>
+struct SimplexLagrangeKernel
+{
+  static const unsigned int n_vertices = Dim+1;
+  static const unsigned int n_shapes =
+    (O == FIRST) ? n_vertices : n_vertices*(n_vertices+1)/2;
+
+  // The vertices at either end of each edge node
+  static unsigned int edge_vertex (unsigned int e, unsigned int end)
+  {
+    static const unsigned int edges[6][2] = {{0,1}, {1,2}, {2,0},
+                                             {0,3}, {1,3}, {2,3}};
+    return edges[e][end];
+  }
+
+  static Real zeta (unsigned int k, const Point & p)
+  {
+    if (k)
+      return p(k-1);
+    Real zeta0 = 1;
+    for (unsigned int d=0; d != Dim; ++d)
+      zeta0 -= p(d);
+    return zeta0;
+  }
+
+  // d(zeta_k)/d(xi_j)
+  static Real dzeta (unsigned int k, unsigned int j)
+  {
+    return k ? Real(k == j+1) : Real(-1);
+  }
+
+  static Real shape (unsigned int i, const Point & p)
+  {
+    if (i < n_vertices)
+      {
+        const Real z = zeta(i, p);
+        return (O == FIRST) ? z : z*(2*z - 1);
+      }
+
+    const unsigned int e = i - n_vertices;
+    return 4*zeta(edge_vertex(e,0), p)*zeta(edge_vertex(e,1), p);
+  }
+
+  static Real shape_deriv (unsigned int i, unsigned int j, const Point & p)
+  {
+    libmesh_assert_less (j, Dim);
+
+    if (i < n_vertices)
+      return (O == FIRST) ? dzeta(i, j) : (4*zeta(i, p) - 1)*dzeta(i, j);
+
+    const unsigned int a = edge_vertex(i - n_vertices, 0),
+                       b = edge_vertex(i - n_vertices, 1);
+    return 4*(zeta(b, p)*dzeta(a, j) + zeta(a, p)*dzeta(b, j));
+  }
+
+  static void shapes (const Point & p, Real * phi)
+  {
+    Real z[n_vertices];
+    for (unsigned int k=0; k != n_vertices; ++k)
+      z[k] = zeta(k, p);
+    for (unsigned int k=0; k != n_vertices; ++k)
+      phi[k] = (O == FIRST) ? z[k] : z[k]*(2*z[k] - 1);
+    for (unsigned int i=n_vertices; i != n_shapes; ++i)
+      phi[i] = 4*z[edge_vertex(i-n_vertices,0)]*z[edge_vertex(i-n_vertices,1)];
+  }
+};
+
+
+
+/**
+ * Operations the vectorized shape evaluations apply with whichever
+ * kernel matches the element type and order, filling their outputs
+ * just as \p FE::default_all_shapes(), \p default_shapes() and
+ * \p default_shape_derivs() do.
+ */
+struct LagrangeAllShapes
+{
+  const std::vector<Point> & p;
+  std::vector<std::vector<Real>> & v;
+
+  template <typename Kernel>
+  void apply () const
+  {
+    libmesh_assert_equal_to (v.size(), std::size_t(Kernel::n_shapes));
+
+    Real phi[Kernel::n_shapes];
+    for (auto qp : index_range(p))
+      {
+        Kernel::shapes(p[qp], phi);
+        for (unsigned int i=0; i != Kernel::n_shapes; ++i)
+          v[i][qp] = phi[i];
+      }
+  }
+};
+
+struct LagrangeShapes
+{
+  unsigned int i;
+  const std::vector<Point> & p;
+  std::vector<Real> & v;
+
+  template <typename Kernel>
+  void apply () const
+  {
+    libmesh_assert_less (i, static_cast<unsigned int>(Kernel::n_shapes));
+    libmesh_assert_equal_to (p.size(), v.size());
+
+    for (auto qp : index_range(v))
+      v[qp] = Kernel::shape(i, p[qp]);
+  }
+};
+
+struct LagrangeShapeDerivs
+{
+  unsigned int i;
+  unsigned int j;
+  const std::vector<Point> & p;
+  std::vector<Real> & v;
+
+  template <typename Kernel>
+  void apply () const
+  {
+    libmesh_assert_less (i, static_cast<unsigned int>(Kernel::n_shapes));
+    libmesh_assert_equal_to (p.size(), v.size());
+
+    for (auto qp : index_range(v))
+      v[qp] = Kernel::shape_deriv(i, j, p[qp]);
+  }
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_LAGRANGE_KERNELS_H
@@ -22,6 +22,7 @@
 
 // libMesh includes
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/affine_map_cache.h"
 #include "libmesh/point.h"
 #include "libmesh/vector_value.h"
 #include "libmesh/fe_type.h"
@@ -34,6 +35,7 @@ namespace libMesh
 
 // forward declarations
 class Elem;
+class MeshBase;
 class Node;
 
 /**
@@ -73,6 +75,17 @@ public:
                                 const std::vector<const Node *> & elem_nodes,
                                 bool compute_second_derivatives);
 
+  /**
+   * Same as above, but takes the locations of the points which
+   * contribute to the element rather than the nodes themselves.
+   */
+  void compute_single_point_map(const unsigned int dim,
+                                const std::vector<Real> & qw,
+                                const Elem * elem,
+                                unsigned int p,
+                                const std::vector<Point> & elem_points,
+                                bool compute_second_derivatives);
+
   /**
    * Compute the jacobian and some other additional
    * data fields. Takes the integration weights
@@ -83,6 +96,15 @@ public:
                                   const std::vector<Real> & qw,
                                   const Elem * elem);
 
+  /**
+   * Fills in the map data on an affine element from the values in
+   * \p entry, which were cached for \p elem.
+   */
+  void compute_cached_affine_map(const unsigned int dim,
+                                 const std::vector<Real> & qw,
+                                 const Elem * elem,
+                                 const AffineMapCache::Entry & entry);
+
   /**
    * Assign a fake jacobian and some other additional data fields.
    * Takes the integration weights as input.  For use on non-element
@@ -160,6 +182,8 @@ public:
    * how close is "good enough."  The map inversion iteration
    * computes the sequence \f$ \{ p_n \} \f$, and the iteration is
    * terminated when \f$ \|p - p_n\| < \mbox{\texttt{tolerance}} \f$
+   * Elements with affine Lagrange maps are inverted directly, without
+   * iterating.
    *
    * When secure == true, the following checks are enabled:
    *
@@ -195,6 +219,11 @@ public:
    * reference element are returned in the vector \p
    * reference_points. The other parameters have the same meaning
    * as the single Point version of inverse_map() above.
+   *
+   * This is cheaper than inverting each point separately: all the
+   * points share a single linearization of the map, which is the
+   * exact inverse for affine elements and the first Newton step
+   * for every other element.
    */
   static void inverse_map (unsigned int dim,
                            const Elem * elem,
@@ -635,6 +664,25 @@ public:
    */
   void set_jacobian_tolerance(Real tol) { jacobian_tolerance = tol; }
 
+  /**
+   * Use the precomputed maps in \p cache on the elements it holds,
+   * rather than computing their (constant) Jacobians on every
+   * \p compute_map().  Pass a null pointer to stop using a cache.
+   * The cache must outlive this object, or be detached first.
+   */
+  void set_affine_map_cache(const AffineMapCache * cache) { _affine_map_cache = cache; }
+
+  /**
+   * Read the node locations of elements of \p mesh from \p
+   * mesh.node_coordinates() rather than from each \p Node in
+   * \p compute_map().  The coordinates are built here if necessary,
+   * so this must not be called in threaded code.  Whenever the mesh
+   * has since dropped them, e.g. in \p prepare_for_use(), elements
+   * are read from their nodes until the coordinates are built again.
+   * Pass a null pointer to always read from the nodes.
+   */
+  void set_node_coordinates(const MeshBase * mesh);
+
 protected:
 
   /**
@@ -1032,10 +1080,32 @@ private:
    */
   void compute_inverse_map_second_derivs(unsigned p);
 
+  /**
+   * Gathers the locations of the nodes of \p elem into \p _elem_points,
+   * from the mesh's contiguous coordinates if we were given them.
+   */
+  void gather_elem_points(const Elem * elem);
+
   /**
    * Work vector for compute_affine_map()
    */
   std::vector<const Node *> _elem_nodes;
+
+  /**
+   * Work vector of the locations of the points contributing to the
+   * current element
+   */
+  std::vector<Point> _elem_points;
+
+  /**
+   * Precomputed maps for affine elements, if any
+   */
+  const AffineMapCache * _affine_map_cache;
+
+  /**
+   * The mesh whose contiguous node coordinates we read, if any
+   */
+  const MeshBase * _node_coordinates_mesh;
 };
 
 }
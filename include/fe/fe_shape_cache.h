@@ -0,0 +1,146 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_SHAPE_CACHE_H
+#define LIBMESH_FE_SHAPE_CACHE_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+#include "libmesh/threads.h"
+
+#ifdef LIBMESH_FORWARD_DECLARE_ENUMS
+namespace libMesh
+{
+enum ElemType : int;
+enum QuadratureType : int;
+}
+#else
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_quadrature_type.h"
+#endif
+
+// C++ includes
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class template implements a process-wide, thread-safe cache
+ * of shape function values and reference-space derivatives at
+ * quadrature points.  For families whose shape functions depend only
+ * on the element type and p level (e.g. \p LAGRANGE or \p MONOMIAL),
+ * these tables are identical for every \p FE object using the same
+ * quadrature rule, so \p FE::init_shape_functions() fetches them here
+ * rather than evaluating them again each time the element type
+ * changes or another \p FE object (in another system, context or
+ * thread) is reinitialized on the same type.
+ *
+ * Tables are immutable once inserted and are handed out through
+ * shared pointers, so they remain valid after \p clear().
+ */
+template <typename OutputShape>
+class FEShapeCache
+{
+public:
+
+  /**
+   * Identifies a table: the finite element type, the element type,
+   * the element p level, the quadrature rule type and order, and
+   * whether second derivatives are included.
+   */
+  struct Key
+  {
+    FEType fe_type;
+    ElemType elem_type;
+    unsigned int p_level;
+    QuadratureType qrule_type;
+    Order qrule_order;
+    bool second_derivatives;
+
+    bool operator< (const Key & other) const;
+  };
+
+  /**
+   * The cached values, indexed as \p [i][qp] like the corresponding
+   * \p FEGenericBase members, along with the points they were
+   * evaluated at.
+   */
+  struct Table
+  {
+    std::vector<Point> points;
+    std::vector<std::vector<OutputShape>> phi;
+    std::vector<std::vector<OutputShape>> dphidxi;
+    std::vector<std::vector<OutputShape>> dphideta;
+    std::vector<std::vector<OutputShape>> dphidzeta;
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    std::vector<std::vector<OutputShape>> d2phidxi2;
+    std::vector<std::vector<OutputShape>> d2phidxideta;
+    std::vector<std::vector<OutputShape>> d2phidxidzeta;
+    std::vector<std::vector<OutputShape>> d2phideta2;
+    std::vector<std::vector<OutputShape>> d2phidetadzeta;
+    std::vector<std::vector<OutputShape>> d2phidzeta2;
+#endif
+  };
+
+  /**
+   * \returns The table stored for \p key, or a null pointer if
+   * there is none yet.
+   */
+  static std::shared_ptr<const Table> find (const Key & key);
+
+  /**
+   * Stores \p table for \p key, unless another thread got there
+   * first.
+   *
+   * \returns The table stored for \p key afterwards.
+   */
+  static std::shared_ptr<const Table> insert (const Key & key,
+                                              std::shared_ptr<const Table> table);
+
+  /**
+   * Removes every table from the cache.
+   */
+  static void clear ();
+
+  /**
+   * \returns The number of tables currently in the cache.
+   */
+  static std::size_t size ();
+
+private:
+
+  /**
+   * The cached tables.
+   */
+  static std::map<Key, std::shared_ptr<const Table>> _tables;
+
+  /**
+   * Mutex for thread safety.
+   */
+  static Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_SHAPE_CACHE_H
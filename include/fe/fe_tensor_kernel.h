@@ -0,0 +1,205 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_TENSOR_KERNEL_H
+#define LIBMESH_FE_TENSOR_KERNEL_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_quadrature_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/threads.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <map>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+
+/**
+ * This class applies the interpolation and gradient operators of a
+ * tensor-product finite element space (\p LAGRANGE or \p HIERARCHIC
+ * on edges, quadrilaterals and hexahedra) at the points of a
+ * tensor-product quadrature rule (\p QGAUSS or \p QGAUSS_LOBATTO) by
+ * sum factorization: the 1D basis is tabulated once at the 1D
+ * quadrature points, and the tables are applied one dimension at a
+ * time.  On a hex with p+1 1D functions and q 1D points, applying an
+ * operator costs O(p^3 q) rather than the O(p^3 q^3) of a full
+ * \p FE::reinit() and shape function sum, and no per-element shape
+ * function arrays are ever formed.
+ *
+ * Quadrature points are numbered as in the corresponding \p QBase
+ * rule, and degrees of freedom as in the element, so the results can
+ * be used directly in residual evaluation or matrix-free operator
+ * application.  Gradients here are with respect to the reference
+ * coordinates; apply the inverse map (e.g. \p FEMap::get_dxidx()
+ * etc.) to get physical gradients, and the transposed inverse map
+ * and JxW to physical fluxes before passing them to \p
+ * integrate_gradient().
+ *
+ * Hierarchic edge and face functions are oriented by the global
+ * ordering of the element vertices, so the mapping from element
+ * degrees of freedom to tensor-product indices is computed, and
+ * cached, once for each vertex ordering encountered.
+ */
+class FETensorKernel
+{
+public:
+
+  /**
+   * Constructor.  Tabulates the 1D basis for \p fe_type at p level
+   * \p p_level on elements of type \p elem_type, at the points of the
+   * \p qtype rule of order \p qorder.
+   */
+  FETensorKernel (const FEType & fe_type,
+                  const ElemType elem_type,
+                  const QuadratureType qtype,
+                  const Order qorder,
+                  const unsigned int p_level = 0);
+
+  /**
+   * \returns \p true if \p FETensorKernel can handle \p fe_type at p
+   * level \p p_level on \p elem_type with a \p qtype rule.
+   */
+  static bool supported (const FEType & fe_type,
+                         const ElemType elem_type,
+                         const QuadratureType qtype,
+                         const unsigned int p_level = 0);
+
+  /**
+   * \returns The number of degrees of freedom per element.
+   */
+  unsigned int n_dofs() const { return _n_dofs; }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_points() const { return _n_points; }
+
+  /**
+   * Computes the values at the quadrature points of the function
+   * with element coefficients \p dof_values on \p elem.
+   */
+  void interpolate (const Elem & elem,
+                    const std::vector<Number> & dof_values,
+                    std::vector<Number> & qp_values) const;
+
+  /**
+   * Computes the reference gradients at the quadrature points of the
+   * function with element coefficients \p dof_values on \p elem.
+   */
+  void gradient (const Elem & elem,
+                 const std::vector<Number> & dof_values,
+                 std::vector<Gradient> & qp_gradients) const;
+
+  /**
+   * The transpose of \p interpolate(): adds the sum over quadrature
+   * points of \p qp_values times each shape function to \p
+   * dof_values.
+   */
+  void integrate (const Elem & elem,
+                  const std::vector<Number> & qp_values,
+                  std::vector<Number> & dof_values) const;
+
+  /**
+   * The transpose of \p gradient(): adds the sum over quadrature
+   * points of \p qp_fluxes dotted with the reference gradient of each
+   * shape function to \p dof_values.
+   */
+  void integrate_gradient (const Elem & elem,
+                           const std::vector<Gradient> & qp_fluxes,
+                           std::vector<Number> & dof_values) const;
+
+private:
+
+  /**
+   * The tensor-product index and sign of each element degree of
+   * freedom.
+   */
+  struct DofMapping
+  {
+    std::vector<unsigned int> index;
+    std::vector<Real> sign;
+  };
+
+  /**
+   * \returns The mapping for the vertex ordering of \p elem,
+   * computing it if it hasn't been seen before.
+   */
+  const DofMapping & dof_mapping (const Elem & elem) const;
+
+  /**
+   * Computes the mapping on \p elem by expanding each shape function
+   * in the tensor-product basis.
+   */
+  DofMapping compute_dof_mapping (const Elem & elem) const;
+
+  /**
+   * Applies \p table (\p rows by the current extent) along \p axis
+   * of the tensor \p in with extents \p ext, updating \p ext.
+   */
+  template <typename T>
+  static void contract (const std::vector<Real> & table,
+                        const unsigned int rows,
+                        const unsigned int axis,
+                        unsigned int ext[3],
+                        const std::vector<T> & in,
+                        std::vector<T> & out);
+
+  const FEType _fe_type;
+
+  const ElemType _elem_type;
+
+  const unsigned int _p_level;
+
+  unsigned int _dim;
+
+  /**
+   * The number of 1D basis functions and 1D quadrature points.
+   */
+  unsigned int _n_1d;
+  unsigned int _n_qp_1d;
+
+  unsigned int _n_dofs;
+  unsigned int _n_points;
+
+  /**
+   * The 1D values and derivatives at the 1D points, stored
+   * row-major with one row per point, and their transposes.
+   */
+  std::vector<Real> _values, _derivs;
+  std::vector<Real> _values_t, _derivs_t;
+
+  /**
+   * The dof mappings seen so far, by vertex ordering.
+   */
+  mutable std::map<std::vector<unsigned char>, DofMapping> _mappings;
+
+  mutable Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_TENSOR_KERNEL_H
@@ -840,6 +840,22 @@ protected:
    */
   FEType current_fe_type;
 
+  /**
+   * The radial points, and radial order, at which the radial shape
+   * functions were last computed for user-specified points.  The
+   * radial shape functions don't depend on the element, so reinit()
+   * keeps them while successive elements ask for the same points.
+   */
+  std::vector<Point> _cached_radial_pts;
+  Order _cached_radial_order;
+
+  /**
+   * Similarly, the base points, and base element type, at which
+   * \p base_fe was last initialized for user-specified points.
+   */
+  std::vector<Point> _cached_base_pts;
+  ElemType _cached_base_type;
+
 
 private:
 
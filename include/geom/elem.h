@@ -1769,6 +1769,12 @@ public:
    */
   void nullify_neighbors ();
 
+  /**
+   * ElemSideBuilder makes the sides it reuses point back to their
+   * parent, as proxy sides do.
+   */
+  friend class ElemSideBuilder;
+
 protected:
 
   /**
@@ -0,0 +1,94 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_SIDE_BUILDER_H
+#define LIBMESH_ELEM_SIDE_BUILDER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+
+/**
+ * This class builds the sides and edges of elements, as
+ * Elem::build_side_ptr() and Elem::build_edge_ptr() do, but keeps
+ * each element it builds to be reused for the same side of every
+ * later element of the same type.  Loops over many sides therefore
+ * only allocate for the first side of each kind, rather than for
+ * every side.
+ *
+ * Like the proxies those methods return, the sides and edges here
+ * have the nodes of the element they came from, which is also their
+ * parent().  Each one stays valid until the same side or edge of
+ * another element of the same type is requested, or the builder is
+ * destroyed.
+ *
+ * \brief Builds element sides and edges without reallocating them.
+ */
+class ElemSideBuilder
+{
+public:
+  /**
+   * \returns Side \p s of \p elem.
+   */
+  Elem & side (Elem & elem, const unsigned int s);
+
+  const Elem & side (const Elem & elem, const unsigned int s);
+
+  /**
+   * \returns Edge \p e of \p elem.
+   */
+  Elem & edge (Elem & elem, const unsigned int e);
+
+  const Elem & edge (const Elem & elem, const unsigned int e);
+
+private:
+
+  /**
+   * The sides and edges we have built, indexed by the type of the
+   * element they were built from and then by side or edge number.
+   * Each side or edge of a given element type always has the same
+   * type, so they can be reused without any further checks.
+   */
+  typedef std::vector<std::vector<std::unique_ptr<Elem>>> Cache;
+
+  Cache _sides, _edges;
+
+  /**
+   * \returns The cached element for index \p i of elements of the
+   * type of \p elem, which have \p n such indices; this is null if
+   * none has been built yet.
+   */
+  static std::unique_ptr<Elem> & cached (Cache & cache,
+                                         const Elem & elem,
+                                         const unsigned int i,
+                                         const unsigned int n);
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_SIDE_BUILDER_H
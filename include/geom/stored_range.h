@@ -24,6 +24,7 @@
 #include "libmesh/threads.h"
 
 // C++ includes
+#include <utility> // std::move
 #include <vector>
 
 namespace libMesh
@@ -236,6 +237,21 @@ public:
     return *this;
   }
 
+  /**
+   * Resets the \p StoredRange to contain the objects in \p objs,
+   * which are moved rather than copied, for when they were gathered
+   * some faster way than by iterating from \p first to \p last.
+   *
+   * \returns A reference to itself for convenience.
+   */
+  StoredRange<iterator_type, object_type> &
+  reset (std::vector<object_type> && objs)
+  {
+    *_objs = std::move(objs);
+
+    return this->reset();
+  }
+
   /**
    * Resets the range to the last specified range.  This method only exists
    * for efficiency -- it is more efficient to set the range to its previous
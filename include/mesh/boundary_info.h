@@ -26,6 +26,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <set>
@@ -523,6 +524,23 @@ public:
   unsigned int n_boundary_ids (const Elem * const elem,
                                const unsigned short int side) const;
 
+  /**
+   * \returns \p true if any side, edge or shellface of \p elem has a
+   * boundary id stored on \p elem itself.  Ids inherited from
+   * ancestors are not counted, so this is always \p false for
+   * refined elements.
+   *
+   * This is a single lookup per container, much cheaper than asking
+   * about each side of an element in turn when most elements have no
+   * boundary ids at all.
+   */
+  bool has_raw_boundary_ids (const Elem * const elem) const
+  {
+    return _boundary_side_id.find(elem) != _boundary_side_id.end() ||
+      _boundary_edge_id.find(elem) != _boundary_edge_id.end() ||
+      _boundary_shellface_id.find(elem) != _boundary_shellface_id.end();
+  }
+
   /**
    * \returns The list of boundary ids associated with the \p side side of
    * element \p elem.
@@ -592,6 +610,18 @@ public:
   unsigned int side_with_boundary_id(const Elem * const elem,
                                      const boundary_id_type boundary_id) const;
 
+  /**
+   * \returns The (element, side) pairs which are associated with
+   * boundary id \p boundary_id, sorted by element and side.
+   *
+   * Like the raw ids, these are only the level-0 elements on which
+   * boundary ids are stored, not their descendants.  The list is
+   * built on first use after the side boundary ids change, and it is
+   * invalidated by any later change to them.
+   */
+  const std::vector<std::pair<const Elem *, unsigned short int>> &
+  sides_with_boundary_id (const boundary_id_type boundary_id) const;
+
   /**
    * Builds the list of unique node boundary ids.
    *
@@ -835,6 +865,12 @@ public:
   { return _node_boundary_ids; }
 
 
+  /**
+   * \returns An estimate of the heap memory, in bytes, taken by the
+   * boundary ids and names stored here.
+   */
+  std::size_t memory_footprint () const;
+
   /**
    * Prints the boundary information data structure.
    */
@@ -928,6 +964,19 @@ private:
                       std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
                       const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * Implements _find_id_maps() when there are no unpartitioned
+   * elements, so that each processor only needs the ids of the
+   * sides and nodes it can see, and on a serial mesh can work out
+   * every other processor's ids without communication.
+   */
+  void _find_partitioned_id_maps (const std::set<boundary_id_type> & requested_boundary_ids,
+                                  dof_id_type first_free_node_id,
+                                  std::map<dof_id_type, dof_id_type> * node_id_map,
+                                  dof_id_type first_free_elem_id,
+                                  std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
+                                  const std::set<subdomain_id_type> & subdomains_relative_to);
+
   /**
    * The Mesh this boundary info pertains to.
    */
@@ -964,6 +1013,42 @@ private:
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
+  /**
+   * A flat copy of \p _boundary_side_id sorted by element and side,
+   * which is much faster to search, and the sides with each boundary
+   * id.  These are rebuilt lazily: a lookup while they are out of
+   * date searches \p _boundary_side_id instead, and once there have
+   * been as many such lookups as there are side boundary conditions
+   * the index is rebuilt, so that code which alternates adding and
+   * looking up boundary ids never pays for more than one rebuild per
+   * lookup.
+   */
+  struct SideIndexLess;
+  mutable std::vector<std::pair<std::pair<const Elem *, unsigned short int>,
+                                boundary_id_type>> _side_index;
+  mutable std::map<boundary_id_type,
+                   std::vector<std::pair<const Elem *, unsigned short int>>> _sides_by_id;
+  mutable std::atomic<bool> _side_index_built;
+  mutable std::atomic<std::size_t> _side_index_stale_lookups;
+
+  /**
+   * Marks the side index as out of date.  This must be called
+   * whenever \p _boundary_side_id changes.
+   */
+  void _invalidate_side_index ()
+  { _side_index_built = false; _side_index_stale_lookups = 0; }
+
+  /**
+   * \returns \p true if the side index may be used for a lookup,
+   * rebuilding it first if that has become worthwhile.
+   */
+  bool _use_side_index () const;
+
+  /**
+   * Rebuilds the side index, unless another thread already has.
+   */
+  void _build_side_index () const;
+
   /**
    * A collection of user-specified boundary ids for sides, edges, nodes,
    * and shell faces.
@@ -46,6 +46,21 @@ class CheckpointIO;
  */
 std::unique_ptr<CheckpointIO> split_mesh(MeshBase & mesh, processor_id_type nsplits);
 
+/**
+ * write_split_mesh writes the given mesh to \p name split for each of
+ * \p all_nsplits numbers of processors in turn.  A serial mesh is
+ * split by split_mesh().  A DistributedMesh is never serialized:
+ * it is partitioned onto (up to) as many pieces as we have
+ * processors, once for all the splits which need that many, and then
+ * each processor cuts its own piece into its share of the chunks and
+ * writes their files concurrently with the other processors.  The
+ * mesh is left partitioned for the last of the splits.
+ */
+void write_split_mesh(MeshBase & mesh,
+                      const std::string & name,
+                      const std::vector<processor_id_type> & all_nsplits,
+                      const bool binary = true);
+
 /**
  * The CheckpointIO class can be used to write simplified restart
  * files that can be used to restart simulations that have
@@ -98,6 +113,12 @@ public:
    * running on several processors, input_name should simply be the name of the mesh split
    * directory without the "-split[n]" suffix.  The number of splits will be determined
    * automatically by the number of processes being used for the mesh at the time of reading.
+   *
+   * If there is no split for that many processors, we read the smallest split into more
+   * pieces, or failing that the largest split into fewer.  On a distributed mesh each
+   * processor then reads a contiguous block of the split files in parallel and takes
+   * ownership of what they contain; the usual repartitioning in prepare_for_use()
+   * redistributes the result evenly.
    */
   virtual void read (const std::string & input_name) override;
 
@@ -151,6 +172,37 @@ public:
   bool   parallel() const { return _parallel; }
   bool & parallel()       { return _parallel; }
 
+  /**
+   * Get/Set the flag indicating if we should write the per-processor
+   * files as raw arrays rather than through Xdr.
+   *
+   * Raw files store node, element, connectivity and boundary data as
+   * contiguous, aligned arrays in the native (in practice
+   * little-endian) binary layout, which are memory mapped and used
+   * in place when reading, with no per-value decoding.  The header
+   * file is still written as ASCII or XDR binary depending on
+   * binary(), and records whether the split files are raw, so this
+   * flag is set automatically by read().  Raw files can only be read
+   * on machines with the same byte order and Real size as the one
+   * which wrote them.
+   */
+  bool   raw() const { return _raw; }
+  bool & raw()       { return _raw; }
+
+  /**
+   * Get/Set the flag indicating if we should compress the arrays of
+   * raw per-processor files, which implies raw().
+   *
+   * Each array is split into chunks of about a megabyte, which are
+   * deflated with zlib independently, using as many threads as
+   * libMesh has, so reading and writing costs less file system
+   * bandwidth but no more wall time than it must.  Compression
+   * requires libMesh to be built with zlib (--enable-gzstreams), and
+   * like raw() this flag is set automatically by read().
+   */
+  bool   compress() const { return _compress; }
+  bool & compress()       { return _compress; }
+
   /**
    * Get/Set the version string.
    */
@@ -238,6 +290,16 @@ private:
    */
   void write_bc_names (Xdr & io, const BoundaryInfo & info, bool is_sideset) const;
 
+  /**
+   * Write the nodes, connectivity, remote_elem links and boundary
+   * conditions for part of a mesh as a raw binary file
+   */
+  void write_raw_subfile (const std::string & file_name,
+                          const std::set<const Elem *, CompareElemIdsByLevel> & elements,
+                          const std::set<const Node *> & nodeset,
+                          const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> & bc_triples,
+                          const std::vector<std::tuple<dof_id_type, boundary_id_type>> & bc_tuples) const;
+
 
   //---------------------------------------------------------------------------
   // Read Implementation
@@ -256,6 +318,12 @@ private:
   template <typename file_id_type>
   void read_subfile(Xdr & io, bool expect_all_remote);
 
+  /**
+   * Read a non-header file written by write_raw_subfile()
+   */
+  template <typename file_id_type>
+  void read_raw_subfile(const std::string & file_name, bool expect_all_remote);
+
   /**
    * Read subdomain name information
    */
@@ -284,6 +352,45 @@ private:
   template <typename file_id_type>
   void read_nodes (Xdr & io);
 
+  /**
+   * Add a node read from a file to the mesh, or check it against
+   * the copy we already have.  \p id_pid holds the node id, processor
+   * id and any extra integers.
+   */
+  template <typename file_id_type>
+  void add_node (const file_id_type * id_pid,
+                 file_id_type unique_id,
+                 const Real * coords);
+
+  /**
+   * Add an element read from a file to the mesh, or check it against
+   * the copy we already have.  \p elem_data holds the id, type,
+   * processor id, subdomain id, parent id, child number and any extra
+   * integers, and \p conn_data the node ids.
+   *
+   * \returns The dimension of the element.
+   */
+  template <typename file_id_type>
+  unsigned int add_elem (const file_id_type * elem_data,
+                         file_id_type unique_id,
+                         uint16_t p_level,
+                         uint16_t rflag,
+                         uint16_t pflag,
+                         const file_id_type * conn_data,
+                         bool file_is_broken);
+
+  /**
+   * Set the remote_elem neighbor and child links read from a file
+   */
+  template <typename file_id_type>
+  void add_remote_elem_links (const file_id_type * elem_ids,
+                              const uint16_t * elem_sides,
+                              std::size_t n_neighbor_links,
+                              const file_id_type * parent_ids,
+                              const uint16_t * child_numbers,
+                              std::size_t n_child_links,
+                              bool expect_all_remote);
+
   /**
    * Read the boundary conditions for a parallel, distributed mesh
    */
@@ -322,10 +429,19 @@ private:
   unsigned int n_active_levels_in(MeshBase::const_element_iterator begin,
                                   MeshBase::const_element_iterator end) const;
 
+  /**
+   * \returns The processor which should own an object written as
+   * belonging to processor \p file_pid, in a checkpoint split into
+   * \p _input_n_procs pieces.
+   */
+  processor_id_type map_processor_id (largest_id_type file_pid) const;
+
   processor_id_type select_split_config(const std::string & input_name, header_id_type & data_size);
 
   bool _binary;
   bool _parallel;
+  bool _raw;
+  bool _compress;
   std::string _version;
 
   // The processor ids to write
@@ -333,6 +449,9 @@ private:
 
   // The largest processor id to write
   processor_id_type _my_n_processors;
+
+  // The number of pieces the checkpoint we're reading was split into
+  processor_id_type _input_n_procs;
 };
 
 
@@ -21,9 +21,15 @@
 #define LIBMESH_DISTRIBUTED_MESH_H
 
 // Local Includes
+#include "libmesh/libmesh_config.h"
+#ifdef LIBMESH_ENABLE_WINDOWED_MAPVECTOR
+#include "libmesh/windowed_mapvector.h"
+#else
 #include "libmesh/mapvector.h"
+#endif
 #include "libmesh/unstructured_mesh.h"
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
+#include "libmesh/filtered_range.h"
 
 // C++ Includes
 #include <cstddef>
@@ -51,6 +57,19 @@ class DistributedMesh : public UnstructuredMesh
 {
 public:
 
+  /**
+   * The container for our nodes and elements, indexed by id.  By
+   * default this keeps a dense window of ids in a std::vector;
+   * configure with --disable-windowed-mapvector to use a plain
+   * std::map based mapvector instead.
+   */
+  template <typename T>
+#ifdef LIBMESH_ENABLE_WINDOWED_MAPVECTOR
+  using dofobject_container = windowed_mapvector<T *, dof_id_type>;
+#else
+  using dofobject_container = mapvector<T *, dof_id_type>;
+#endif
+
   /**
    * Constructor.  Takes \p dim, the dimension of the mesh.
    * The mesh dimension can be changed (and may automatically be
@@ -147,7 +166,7 @@ public:
    * Calls libmesh_assert() on each possible failure in that container.
    */
   template <typename T>
-  void libmesh_assert_valid_parallel_object_ids(const mapvector<T *,dof_id_type> &) const;
+  void libmesh_assert_valid_parallel_object_ids(const dofobject_container<T> &) const;
 
   /**
    * Verify id and processor_id consistency of our elements and
@@ -175,7 +194,7 @@ public:
    * \returns The smallest globally unused id for that container.
    */
   template <typename T>
-  dof_id_type renumber_dof_objects (mapvector<T *,dof_id_type> &);
+  dof_id_type renumber_dof_objects (dofobject_container<T> &);
 
   /**
    * Remove nullptr elements from arrays.
@@ -313,6 +332,21 @@ public:
   virtual SimpleRange<element_iterator> element_ptr_range() override { return {elements_begin(), elements_end()}; }
   virtual SimpleRange<const_element_iterator> element_ptr_range() const override { return {elements_begin(), elements_end()}; }
 
+  /**
+   * \returns A range over the elements satisfying \p pred, which
+   * unlike the virtual iterator ranges can be inlined entirely.  See
+   * \p MeshTools::for_each_element() and \p ElemFilter.
+   */
+  template <typename Pred>
+  FilteredRange<dofobject_container<Elem>::veclike_iterator, Pred>
+  filtered_element_ptr_range (const Pred & pred)
+  { return {_elements.begin(), _elements.end(), pred}; }
+
+  template <typename Pred>
+  FilteredRange<dofobject_container<Elem>::const_veclike_iterator, Pred>
+  filtered_element_ptr_range (const Pred & pred) const
+  { return {_elements.begin(), _elements.end(), pred}; }
+
   virtual element_iterator active_elements_begin () override;
   virtual element_iterator active_elements_end () override;
   virtual const_element_iterator active_elements_begin() const override;
@@ -552,12 +586,12 @@ protected:
   /**
    * The vertices (spatial coordinates) of the mesh.
    */
-  mapvector<Node *, dof_id_type> _nodes;
+  dofobject_container<Node> _nodes;
 
   /**
    * The elements in the mesh.
    */
-  mapvector<Elem *, dof_id_type> _elements;
+  dofobject_container<Elem> _elements;
 
   /**
    * A boolean remembering whether we're serialized or not
@@ -599,18 +633,16 @@ protected:
 private:
 
   /**
-   * Typedefs for the container implementation.  In this case,
-   * it's just a std::vector<Elem *>.
+   * Typedefs for the container implementation.
    */
-  typedef mapvector<Elem *, dof_id_type>::veclike_iterator             elem_iterator_imp;
-  typedef mapvector<Elem *, dof_id_type>::const_veclike_iterator const_elem_iterator_imp;
+  typedef dofobject_container<Elem>::veclike_iterator             elem_iterator_imp;
+  typedef dofobject_container<Elem>::const_veclike_iterator const_elem_iterator_imp;
 
   /**
-   * Typedefs for the container implementation.  In this case,
-   * it's just a std::vector<Node *>.
+   * Typedefs for the container implementation.
    */
-  typedef mapvector<Node *, dof_id_type>::veclike_iterator             node_iterator_imp;
-  typedef mapvector<Node *, dof_id_type>::const_veclike_iterator const_node_iterator_imp;
+  typedef dofobject_container<Node>::veclike_iterator             node_iterator_imp;
+  typedef dofobject_container<Node>::const_veclike_iterator const_node_iterator_imp;
 };
 
 
@@ -0,0 +1,149 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_FILTER_H
+#define LIBMESH_ELEM_FILTER_H
+
+// Local Includes
+#include "libmesh/distributed_mesh.h"
+#include "libmesh/elem.h"
+#include "libmesh/filtered_range.h"
+#include "libmesh/replicated_mesh.h"
+
+namespace libMesh
+{
+
+/**
+ * Element predicates for \p filtered_element_ptr_range() and \p
+ * MeshTools::for_each_element().  These, unlike those in \p
+ * Predicates, are plain functors, so tests against them inline
+ * into the loops using them.
+ */
+namespace ElemFilter
+{
+
+struct Active
+{
+  bool operator() (const Elem * elem) const
+  { return elem->active(); }
+};
+
+struct Local
+{
+  explicit Local (processor_id_type pid) : _pid(pid) {}
+
+  bool operator() (const Elem * elem) const
+  { return elem->processor_id() == _pid; }
+
+  processor_id_type _pid;
+};
+
+struct ActiveLocal
+{
+  explicit ActiveLocal (processor_id_type pid) : _pid(pid) {}
+
+  bool operator() (const Elem * elem) const
+  { return elem->active() && elem->processor_id() == _pid; }
+
+  processor_id_type _pid;
+};
+
+struct ActiveSubdomain
+{
+  explicit ActiveSubdomain (subdomain_id_type sbd_id) : _sbd_id(sbd_id) {}
+
+  bool operator() (const Elem * elem) const
+  { return elem->active() && elem->subdomain_id() == _sbd_id; }
+
+  subdomain_id_type _sbd_id;
+};
+
+struct ActiveLocalSubdomain
+{
+  ActiveLocalSubdomain (processor_id_type pid, subdomain_id_type sbd_id) :
+    _pid(pid), _sbd_id(sbd_id) {}
+
+  bool operator() (const Elem * elem) const
+  { return elem->active() && elem->processor_id() == _pid &&
+      elem->subdomain_id() == _sbd_id; }
+
+  processor_id_type _pid;
+  subdomain_id_type _sbd_id;
+};
+
+struct ActiveType
+{
+  explicit ActiveType (ElemType type) : _type(type) {}
+
+  bool operator() (const Elem * elem) const
+  { return elem->active() && elem->type() == _type; }
+
+  ElemType _type;
+};
+
+} // namespace ElemFilter
+
+
+
+namespace MeshTools
+{
+
+/**
+ * Calls \p f on each element of \p mesh satisfying \p pred, in the
+ * same order as the \p MeshBase iterators would, and like the
+ * const_element_iterator the const overload passes it non-const
+ * element pointers.  The dispatch on
+ * the type of mesh happens once for the whole loop, rather than
+ * through virtual calls for every element visited.
+ */
+template <typename Pred, typename Func>
+void for_each_element (MeshBase & mesh, const Pred & pred, Func && f)
+{
+  if (ReplicatedMesh * rmesh = dynamic_cast<ReplicatedMesh *>(&mesh))
+    for (Elem * elem : rmesh->filtered_element_ptr_range(pred))
+      f(elem);
+  else if (DistributedMesh * dmesh = dynamic_cast<DistributedMesh *>(&mesh))
+    for (Elem * elem : dmesh->filtered_element_ptr_range(pred))
+      f(elem);
+  else
+    for (Elem * elem : mesh.element_ptr_range())
+      if (pred(elem))
+        f(elem);
+}
+
+template <typename Pred, typename Func>
+void for_each_element (const MeshBase & mesh, const Pred & pred, Func && f)
+{
+  if (const ReplicatedMesh * rmesh = dynamic_cast<const ReplicatedMesh *>(&mesh))
+    for (Elem * elem : rmesh->filtered_element_ptr_range(pred))
+      f(elem);
+  else if (const DistributedMesh * dmesh = dynamic_cast<const DistributedMesh *>(&mesh))
+    for (Elem * elem : dmesh->filtered_element_ptr_range(pred))
+      f(elem);
+  else
+    for (Elem * elem : mesh.element_ptr_range())
+      if (pred(elem))
+        f(elem);
+}
+
+} // namespace MeshTools
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_FILTER_H
@@ -33,6 +33,7 @@ namespace libMesh
 {
 
 // Forward declarations
+class Elem;
 class EquationSystems;
 class ExodusII_IO_Helper;
 class MeshBase;
@@ -96,6 +97,24 @@ public:
    */
   ExodusHeaderInfo read_header (const std::string & name);
 
+  /**
+   * If true, read() into a DistributedMesh has every processor read
+   * only a contiguous range of the elements in the file, along with
+   * the nodes those elements use, rather than the whole mesh.  No
+   * processor ever holds more than its share of the mesh, so reading
+   * very large meshes doesn't require one processor to have room for
+   * all of them.  The elements start out partitioned by their order
+   * in the file, so the mesh should then be repartitioned, as
+   * MeshBase::prepare_for_use() does.
+   *
+   * Nodes which no element uses are not read.  Only sidesets and
+   * nodesets are read as boundary information; edge blocks and extra
+   * integer variables are not yet supported.
+   * This flag is ignored when reading into a ReplicatedMesh.  By
+   * default this flag is set to false.
+   */
+  void set_parallel_read (bool val);
+
   /**
    * This method implements writing a mesh to a specified file.
    */
@@ -252,6 +271,23 @@ public:
   using MeshOutput<MeshBase>::write_nodal_data;
   using MeshOutput<MeshBase>::write_nodal_data_discontinuous;
 
+  /**
+   * Writes the mesh and the nodal solution of \p es.  Unlike the
+   * generic MeshOutput implementation, this only builds the variables
+   * which will actually be output, and processor 0 gathers and writes
+   * them a block of nodes at a time straight from the parallel
+   * solution vector, rather than localizing every variable at once.
+   */
+  virtual void write_equation_systems (const std::string & fname,
+                                       const EquationSystems & es,
+                                       const std::set<std::string> * system_names=nullptr) override;
+
+  /**
+   * Sets how many nodes' values write_equation_systems() gathers and
+   * writes at a time, for each variable.  Defaults to 1048576.
+   */
+  void set_write_block_size(unsigned int n_nodes);
+
   /**
    * Write out a nodal solution.
    */
@@ -388,6 +424,24 @@ public:
    */
   void append(bool val);
 
+  /**
+   * If true, write_timestep() and write_nodal_data() return once the
+   * nodal data is gathered and copied, and a background thread
+   * writes it to the file while the caller continues, e.g. with the
+   * next timestep's solve.  Any other use of the file, such as
+   * writing element or global data, first waits for those writes.
+   * Requires NetCDF/HDF5 built thread-safe if anything else uses them
+   * meanwhile.  Without C++11 thread support the writes just happen
+   * immediately.  By default this flag is set to false.
+   */
+  void set_asynchronous_writes(bool val);
+
+  /**
+   * Blocks until all asynchronous writes so far are complete, and
+   * throws if any of them failed.
+   */
+  void wait_for_writes();
+
   /**
    * Return list of the elemental variable names
    */
@@ -478,6 +532,34 @@ private:
    * by not writing out.
    */
   bool _write_complex_abs;
+
+  /**
+   * Default false.  If true, each processor reads only part of the
+   * mesh into a DistributedMesh.
+   */
+  bool _parallel_read;
+
+  /**
+   * The number of nodes whose values write_equation_systems() writes
+   * at a time.
+   */
+  unsigned int _write_block_size;
+
+#ifdef LIBMESH_HAVE_EXODUS_API
+  /**
+   * Implements read() when every processor reads part of the mesh.
+   */
+  void read_parallel (const std::string & name);
+
+  /**
+   * Adds the (zero-based) Exodus side \p raw_side_index of \p elem to
+   * the boundary \p id, as either a side or a shellface.
+   */
+  void add_exodus_side (MeshBase & mesh,
+                        const Elem & elem,
+                        unsigned int raw_side_index,
+                        boundary_id_type id);
+#endif
 };
 
 
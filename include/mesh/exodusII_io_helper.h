@@ -34,6 +34,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 
 // Macros to simplify checking Exodus error codes
 #define EX_CHECK_ERR(code, msg)                 \
@@ -68,6 +69,7 @@ namespace libMesh
 {
 
 // Forward declarations
+class BackgroundTaskQueue;
 class MeshBase;
 
 /**
@@ -151,12 +153,25 @@ public:
    */
   void read_nodes();
 
+  /**
+   * Reads the nodal data of only the \p n_nodes nodes starting with
+   * (zero-based) node \p first_node, so that \p x[i] is the x
+   * coordinate of node \p first_node+i.
+   */
+  void read_nodes(int first_node, int n_nodes);
+
   /**
    * Reads the optional \p node_num_map from the \p ExodusII mesh
    * file.
    */
   void read_node_num_map();
 
+  /**
+   * Reads the \p n_nodes entries of the \p node_num_map starting
+   * with (zero-based) node \p first_node.
+   */
+  void read_node_num_map(int first_node, int n_nodes);
+
   /**
    * Prints the nodal information, by default to \p libMesh::out.
    */
@@ -207,6 +222,19 @@ public:
    */
   void read_elem_in_block(int block);
 
+  /**
+   * Reads the element type, the number of elements, nodes per
+   * element and attributes of block \p block, but not its
+   * connectivity.
+   */
+  void read_elem_block_header(int block);
+
+  /**
+   * Reads the connectivity of only the \p n_elem elements starting
+   * with (zero-based) element \p first_elem of block \p block.
+   */
+  void read_elem_in_block(int block, int first_elem, int n_elem);
+
   /**
    * Read in edge blocks, storing information in the BoundaryInfo object.
    */
@@ -218,6 +246,12 @@ public:
    */
   void read_elem_num_map();
 
+  /**
+   * Reads the \p n_elem entries of the \p elem_num_map starting
+   * with (zero-based) element \p first_elem.
+   */
+  void read_elem_num_map(int first_elem, int n_elem);
+
   /**
    * Reads information about all of the sidesets in the \p ExodusII
    * mesh file.
@@ -284,6 +318,41 @@ public:
                                  int time_step,
                                  std::map<dof_id_type, Real> & elem_var_value_map);
 
+  /**
+   * Reads the \p n_nodes values, in file order, of the (zero-based)
+   * nodal variable \p var_index at the specified time, starting with
+   * (zero-based) node \p first_node, into \p values.  This lets
+   * huge files be read a block of nodes at a time.
+   */
+  void read_nodal_var_values(int var_index,
+                             int time_step,
+                             int first_node,
+                             int n_nodes,
+                             std::vector<Real> & values);
+
+  /**
+   * Reads the \p n_elem values, in file order, of the (zero-based)
+   * elemental variable \p var_index at the specified time, starting
+   * with (zero-based) element \p first_elem of block \p block, into
+   * \p values.  The block header must have been read by
+   * read_elem_block_header(), and the variable must be defined on the
+   * block.
+   */
+  void read_elemental_var_values(int var_index,
+                                 int time_step,
+                                 int block,
+                                 int first_elem,
+                                 int n_elem,
+                                 std::vector<Real> & values);
+
+  /**
+   * Reads the element variable truth table into \p table, which has
+   * an entry for each elemental variable on the first block, then
+   * for each on the second, and so on.  An entry is nonzero iff the
+   * variable is defined on the block.
+   */
+  void read_elem_var_truth_table(std::vector<int> & table);
+
   /**
    * Opens an \p ExodusII mesh file named \p filename for writing.
    */
@@ -396,10 +465,36 @@ public:
    const std::map<subdomain_id_type, std::vector<std::string>> & subdomain_to_var_names);
 
   /**
-   * Writes the vector of values to a nodal variable.
+   * Writes the vector of values to a nodal variable.  With
+   * asynchronous writes, only copies the values, for a background
+   * thread to write.
    */
   void write_nodal_values(int var_id, const std::vector<Real> & values, int timestep);
 
+  /**
+   * Writes \p values to the nodal variable \p var_id at the nodes
+   * (0-based, in file order) starting at \p first_node, leaving the
+   * others alone, so that a large variable can be written a block at
+   * a time.
+   */
+  void write_nodal_values(int var_id, int first_node,
+                          const std::vector<Real> & values, int timestep);
+
+  /**
+   * If true, write_nodal_values() and write_timestep() return as soon
+   * as they have copied their data, and a background thread writes
+   * it in order, while the caller gets on with its work.  Other
+   * functions which use the file first wait for those writes to
+   * finish.  By default this flag is false.
+   */
+  void set_asynchronous_writes(bool val);
+
+  /**
+   * Blocks until any asynchronous writes have finished, then throws
+   * if any of them failed.
+   */
+  void wait_for_writes();
+
   /**
    * Writes the vector of information records.
    */
@@ -840,6 +935,19 @@ private:
    */
   std::map<ElemType, ExodusII_IO_Helper::Conversion> conversion_map;
   void init_conversion_map();
+
+  /**
+   * Writes nodal values and timesteps, for write_nodal_values() and
+   * write_timestep(), on whichever thread runs them.
+   */
+  void write_nodal_values_now(int var_id, int first_node,
+                              const std::vector<Real> & values, int timestep);
+  void write_timestep_now(int timestep, Real time);
+
+  /**
+   * Runs asynchronous writes in the background, if we do them at all
+   */
+  std::unique_ptr<BackgroundTaskQueue> _write_queue;
 };
 
 
@@ -0,0 +1,81 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+#ifndef LIBMESH_INTERIOR_FACES_H
+#define LIBMESH_INTERIOR_FACES_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class MeshBase;
+
+namespace MeshTools
+{
+
+/**
+ * A face (or edge, in 2D) between two active elements, seen from
+ * side \p side of \p elem, which is side \p neighbor_side of
+ * \p neighbor.
+ *
+ * If the mesh is adaptively refined, \p elem may be finer than
+ * \p neighbor, in which case the face is only the part of the
+ * neighbor's side which \p elem's side covers.  Quadrature points on
+ * \p elem's side are therefore always on the face, and mapping them
+ * into \p neighbor (as DGFEMContext::neighbor_side_fe_reinit() does)
+ * gives the neighbor's values at the same points in the same order.
+ */
+struct InteriorFace
+{
+  const Elem * elem;
+  unsigned int side;
+  const Elem * neighbor;
+  unsigned int neighbor_side;
+};
+
+/**
+ * \returns \p true if the face on side \p side of the active element
+ * \p elem is an interior face which should be visited from \p elem:
+ * if its neighbor there is coarser, or is as fine and has a larger
+ * id.  Every interior face between active elements is visited from
+ * exactly one of them this way.  Boundary sides, and sides whose
+ * neighbors are refined further (whose children visit those faces
+ * instead), are never visited.
+ */
+bool visits_interior_face (const Elem & elem, unsigned int side);
+
+/**
+ * Fills \p faces with each interior face which an active local
+ * element of \p mesh visits.  Every interior face of the mesh is
+ * then found by exactly one processor, from one side, so that
+ * discontinuous Galerkin face terms can be computed once per face
+ * and added to both elements' rows.
+ */
+void build_interior_faces (const MeshBase & mesh,
+                           std::vector<InteriorFace> & faces);
+
+} // namespace MeshTools
+
+} // namespace libMesh
+
+#endif // LIBMESH_INTERIOR_FACES_H
@@ -27,6 +27,8 @@
 #include "libmesh/multi_predicates.h"
 #include "libmesh/point_locator_base.h"
 #include "libmesh/variant_filter_iterator.h"
+#include "libmesh/node_adjacency.h"
+#include "libmesh/node_coordinates.h"
 #include "libmesh/parallel_object.h"
 #include "libmesh/simple_range.h"
 
@@ -44,6 +46,7 @@ enum ElemMappingType : unsigned char;
 #include <cstddef>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -426,6 +429,16 @@ public:
   dof_id_type n_active_local_elem () const
   { return this->n_active_elem_on_proc (this->processor_id()); }
 
+  /**
+   * The counts of local and unpartitioned nodes and elements, and of
+   * active elements, are cached until the mesh is modified.  Adding,
+   * inserting or deleting nodes and elements, partitioning, refining
+   * and coarsening, and the library's parallel synchronization all
+   * invalidate them; code that changes processor ids or refinement
+   * states by hand must call this afterward instead.
+   */
+  void invalidate_cached_counts () { _cached_counts_valid = false; }
+
   /**
    * \returns The number of elements that will be written
    * out in certain I/O formats.
@@ -794,6 +807,18 @@ public:
   virtual void find_neighbors (const bool reset_remote_elements = false,
                                const bool reset_current_list    = true) = 0;
 
+  /**
+   * Updates the neighbor links of only those elements near the
+   * children of \p refined_elems, assuming those elements are all
+   * that has been refined, and nothing else has changed, since the
+   * links were last found.
+   *
+   * \returns \p false, having changed nothing, if this mesh can't be
+   * updated that way or if the update wouldn't be much cheaper than
+   * find_neighbors(), which is then still needed.
+   */
+  virtual bool find_neighbors_after_refinement (const std::vector<Elem *> & refined_elems) = 0;
+
   /**
    * Removes any orphaned nodes, nodes not connected to any elements.
    * Typically done automatically in prepare_for_use
@@ -1088,6 +1113,45 @@ public:
   void allow_find_neighbors(bool allow) { _skip_find_neighbors = !allow; }
   bool allow_find_neighbors() const { return !_skip_find_neighbors; }
 
+  /**
+   * If \p true is passed then, when the only change to a serialized
+   * mesh since it was last prepared is MeshRefinement refining some
+   * of its elements, prepare_for_use() will only update the neighbor
+   * links near the new children rather than over the whole mesh, and
+   * will keep the element dimensions it has cached.  This is only
+   * valid if nothing else has modified the mesh without preparing it
+   * since, so it is off by default.
+   */
+  void allow_incremental_preparation(bool allow) { _allow_incremental_preparation = allow; }
+  bool allow_incremental_preparation() const { return _allow_incremental_preparation; }
+
+  /**
+   * Records that \p elem has been refined, so that an incremental
+   * prepare_for_use() knows where the mesh has changed.
+   * MeshRefinement calls this when incremental preparation is
+   * allowed; the record is cleared by the next prepare_for_use().
+   */
+  void add_refined_elem (Elem * elem) { _refined_elems.push_back(elem); }
+
+  /**
+   * Discards the record of refined elements, for when the mesh has
+   * also changed in other ways and must be prepared in full.
+   */
+  void clear_refined_elems () { _refined_elems.clear(); }
+
+  /**
+   * If \p true is passed then prepare_for_use() will renumber the
+   * elements, and then the nodes, of a serialized mesh in order along
+   * a space-filling curve (see \p
+   * MeshTools::Modification::order_along_space_filling_curve()), so
+   * that loops over the mesh, and the degree of freedom numbering
+   * derived from it, walk through memory and space together.  This
+   * has no effect if renumbering is disallowed.  It is off by
+   * default.
+   */
+  void space_filling_curve_ordering(bool enable) { _space_filling_curve_ordering = enable; }
+  bool space_filling_curve_ordering() const { return _space_filling_curve_ordering; }
+
   /**
    * If false is passed in then this mesh will no longer have remote
    * elements deleted when being prepared for use; i.e. even a
@@ -1216,6 +1280,14 @@ public:
   unsigned int n_partitions () const
   { return _n_parts; }
 
+  /**
+   * \returns An estimate of the memory, in bytes, this processor
+   * uses to store the mesh: its nodes and elements, with their degree
+   * of freedom indexing, its boundary information, and its node
+   * adjacency if that has been built.
+   */
+  std::size_t memory_footprint () const;
+
   /**
    * \returns A string containing relevant information
    * about the mesh.
@@ -1338,6 +1410,52 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * \returns The elements touching each node and the nodal neighbors
+   * of each node, building them first if necessary.  They are kept
+   * until nodes or elements are added, deleted or renumbered; code
+   * changing element connectivity by other means must call \p
+   * clear_node_adjacency() afterward.  Like \p sub_point_locator(),
+   * this should not be used in threaded code unless the adjacency has
+   * already been built.
+   */
+  const NodeAdjacency & node_adjacency () const;
+
+  /**
+   * Releases the current \p NodeAdjacency object.
+   */
+  void clear_node_adjacency () { _node_adjacency.reset(); }
+
+  /**
+   * \returns A contiguous copy of the locations of our nodes, in the
+   * form \p FEMap can read them from, building it first if
+   * necessary.  Like the node adjacency it is kept until nodes or
+   * elements are added, deleted or renumbered; code moving nodes
+   * other than through \p MeshTools::Modification must call \p
+   * update_node_coordinates() afterward.  This should not be used in
+   * threaded code unless the coordinates have already been built.
+   */
+  const NodeCoordinates & node_coordinates () const;
+
+  /**
+   * \returns The current \p NodeCoordinates object, or \p nullptr if
+   * none has been built since the mesh last changed.  Unlike \p
+   * node_coordinates() this never builds one, so it is safe to use
+   * in threaded code.
+   */
+  const NodeCoordinates * built_node_coordinates () const { return _node_coordinates.get(); }
+
+  /**
+   * Copies the node locations into the current \p NodeCoordinates
+   * object again, if there is one, after nodes have been moved.
+   */
+  void update_node_coordinates ();
+
+  /**
+   * Releases the current \p NodeCoordinates object.
+   */
+  void clear_node_coordinates () { _node_coordinates.reset(); }
+
   /**
    * In the point locator, do we count lower dimensional elements
    * when we refine point locator regions? This is relevant in
@@ -1760,6 +1878,24 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * Updates the cached node and element counts, if they are not
+   * already up to date, with one pass over each container.
+   */
+  void _update_cached_counts () const;
+
+  /**
+   * Whether the cached counts are up to date, and the counts of
+   * local and unpartitioned nodes, of local, unpartitioned and
+   * active elements, and of local and unpartitioned active elements.
+   * Only active elements this processor has are counted.
+   */
+  mutable bool _cached_counts_valid;
+  mutable dof_id_type _n_local_nodes_cached, _n_unpartitioned_nodes_cached;
+  mutable dof_id_type _n_local_elem_cached, _n_unpartitioned_elem_cached;
+  mutable dof_id_type _n_active_elem_cached;
+  mutable dof_id_type _n_active_local_elem_cached, _n_active_unpartitioned_elem_cached;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -1769,6 +1905,18 @@ protected:
    */
   mutable std::unique_ptr<PointLocatorBase> _point_locator;
 
+  /**
+   * The adjacency of our nodes, built on demand by \p
+   * node_adjacency().
+   */
+  mutable std::unique_ptr<NodeAdjacency> _node_adjacency;
+
+  /**
+   * The contiguous node locations, built on demand by \p
+   * node_coordinates().
+   */
+  mutable std::unique_ptr<NodeCoordinates> _node_coordinates;
+
   /**
    * Do we count lower dimensional elements in point locator refinement?
    * This is relevant in tree-based point locators, for example.
@@ -1813,6 +1961,24 @@ protected:
    */
   bool _skip_find_neighbors;
 
+  /**
+   * If this is \p true then prepare_for_use() will order serialized
+   * meshes along a space-filling curve.
+   */
+  bool _space_filling_curve_ordering;
+
+  /**
+   * If this is \p true then prepare_for_use() may only update the
+   * mesh near \p _refined_elems.
+   */
+  bool _allow_incremental_preparation;
+
+  /**
+   * The elements refined since the mesh was last prepared, if we're
+   * keeping track
+   */
+  std::vector<Elem *> _refined_elems;
+
   /**
    * If this is false then even on DistributedMesh remote elements
    * will not be deleted during mesh preparation.
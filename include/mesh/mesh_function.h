@@ -254,6 +254,53 @@ public:
                 std::vector<Tensor> & output,
                 const std::set<subdomain_id_type> * subdomain_ids = nullptr);
 
+  /**
+   * Computes values at each of the coordinates \p points and for time
+   * \p time, optionally restricting the points to the passed
+   * subdomain_ids.  \p output[i] is what operator() would give for
+   * \p points[i].
+   *
+   * This is much faster than evaluating the points one at a time.
+   * The points are located in a space-filling-curve order, so that
+   * successive lookups usually hit the element the point locator
+   * found last, and each element is then reinitialized once for all
+   * of its points, with the elements split between threads.
+   */
+  void operator() (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<DenseVector<Number>> & output,
+                   const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
+  /**
+   * Computes gradients at each of the coordinates \p points and for
+   * time \p time, as the batched operator() above does for values.
+   * \p output[i] is what gradient() would give for \p points[i]; it
+   * is empty for points outside the mesh.
+   */
+  void gradient (const std::vector<Point> & points,
+                 const Real time,
+                 std::vector<std::vector<Gradient>> & output,
+                 const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
+  /**
+   * Computes values at each of the coordinates \p points and for time
+   * \p time, as the batched operator() above does, but also finds
+   * points in elements that only other processors have, which is
+   * what a distributed mesh needs.  \p output[i] is the value at
+   * \p points[i].
+   *
+   * Each point is sent to the processors whose local elements have a
+   * bounding box around it, evaluated by whichever of them finds it,
+   * and the values are sent back.  Every processor may pass its own
+   * points.
+   *
+   * This method must be called on all processors at once.
+   */
+  void parallel_values (const std::vector<Point> & points,
+                        const Real time,
+                        std::vector<DenseVector<Number>> & output,
+                        const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
   /**
    * \returns The current \p PointLocator object, for use elsewhere.
    *
@@ -304,6 +351,20 @@ public:
    */
   void unset_point_locator_tolerance();
 
+  /**
+   * Have the PointLocator walk across neighbors from the element it
+   * found last before searching from scratch, for up to \p max_steps
+   * elements.  This speeds up spatially coherent evaluations; see
+   * PointLocatorBase::enable_neighbor_walk().  Clones get their own
+   * locator, with its own last element, and inherit this setting.
+   */
+  void enable_point_locator_neighbor_walk(unsigned int max_steps = 20);
+
+  /**
+   * Turn off neighbor walking in the PointLocator.
+   */
+  void disable_point_locator_neighbor_walk();
+
 protected:
 
   /**
@@ -321,6 +382,36 @@ protected:
   std::set<const Elem *> find_elements(const Point & p,
                                        const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
 
+  /**
+   * Helper function for the batched evaluations: locates every point
+   * in \p points, and sorts their indices into \p order so that the
+   * points in the same element are contiguous.  The points in element
+   * \p elems[g] are those indexed by \p order between
+   * \p group_offsets[g] and \p group_offsets[g+1].  The indices of
+   * points outside the mesh come last, after the final offset.
+   */
+  void group_points_by_element(const std::vector<Point> & points,
+                               const std::set<subdomain_id_type> * subdomain_ids,
+                               std::vector<std::size_t> & order,
+                               std::vector<const Elem *> & elems,
+                               std::vector<std::size_t> & group_offsets) const;
+
+  /**
+   * Helper function for the batched evaluations: computes values
+   * (when \p values is not null) or gradients (when \p gradients is
+   * not null) at the points in groups \p first_group up to
+   * \p last_group, as found by group_points_by_element().  This is
+   * called on several threads at once.
+   */
+  void evaluate_groups(const std::vector<Point> & points,
+                       const std::vector<std::size_t> & order,
+                       const std::vector<const Elem *> & elems,
+                       const std::vector<std::size_t> & group_offsets,
+                       std::size_t first_group,
+                       std::size_t last_group,
+                       std::vector<DenseVector<Number>> * values,
+                       std::vector<std::vector<Gradient>> * gradients) const;
+
   /**
    * The equation systems handler, from which
    * the data are gathered.
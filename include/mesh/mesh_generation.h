@@ -110,6 +110,27 @@ void build_square (UnstructuredMesh & mesh,
                    const ElemType type=INVALID_ELEM,
                    const bool gauss_lobatto_grid=false);
 
+/**
+ * Builds the same \f$ nx \times ny \times nz \f$ (elements) cube
+ * as \p build_cube(), without ever building the whole of it on each
+ * processor, for meshes too large for that.  Each processor directly
+ * creates one block of the grid and the layer of ghost elements
+ * around it, and that block partitioning is kept.  Unlike with \p
+ * build_cube(), the elements must be Lagrange edges, quads or hexes,
+ * and there is no Gauss-Lobatto grid option.
+ *
+ * A replicated mesh, or a mesh on just one processor, is simply
+ * built by \p build_cube().
+ */
+void build_distributed_cube (UnstructuredMesh & mesh,
+                             const unsigned int nx,
+                             const unsigned int ny=0,
+                             const unsigned int nz=0,
+                             const Real xmin=0., const Real xmax=1.,
+                             const Real ymin=0., const Real ymax=1.,
+                             const Real zmin=0., const Real zmax=1.,
+                             const ElemType type=INVALID_ELEM);
+
 /**
  * Meshes a spherical or mapped-spherical domain.
  */
@@ -129,6 +150,24 @@ void build_extrusion (UnstructuredMesh & mesh,
                       RealVectorValue extrusion_vector,
                       QueryElemSubdomainIDBase * elem_subdomain = nullptr);
 
+/**
+ * Builds the same extrusion as \p build_extrusion(), of a serial
+ * \p cross_section, without ever building the whole of it on each
+ * processor, for meshes too large for that.  Each processor directly
+ * creates one range of the \p nz layers of elements and the layer of
+ * ghost elements on either side of it, and that partitioning is
+ * kept.
+ *
+ * A replicated mesh, a mesh on just one processor, or the extrusion
+ * of an already distributed cross section is simply built by \p
+ * build_extrusion().
+ */
+void build_distributed_extrusion (UnstructuredMesh & mesh,
+                                  const MeshBase & cross_section,
+                                  const unsigned int nz,
+                                  RealVectorValue extrusion_vector,
+                                  QueryElemSubdomainIDBase * elem_subdomain = nullptr);
+
 #if defined(LIBMESH_HAVE_TRIANGLE) && LIBMESH_DIM > 1
 /**
  * Meshes a rectangular (2D) region (with or without holes) with a
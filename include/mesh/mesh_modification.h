@@ -159,6 +159,21 @@ void change_subdomain_id (MeshBase & mesh,
                           const subdomain_id_type old_id,
                           const subdomain_id_type new_id);
 
+/**
+ * Renumbers the elements of a serialized mesh along a space-filling
+ * curve (Hilbert if libHilbert is available, Morton otherwise)
+ * through their centroids, level by level, and then renumbers the
+ * nodes in the order they are first reached by the reordered
+ * elements.  The sets of element and node ids are unchanged; only
+ * their assignment to objects is permuted.
+ *
+ * Since mesh storage and iteration follow id order, loops over the
+ * mesh then visit neighboring objects consecutively, which improves
+ * cache reuse in assembly and in the vector accesses of the degree
+ * of freedom numbering derived from the element order.
+ */
+void order_along_space_filling_curve (MeshBase & mesh);
+
 } // end namespace Meshtools::Modification
 } // end namespace MeshTools
 
@@ -748,6 +748,14 @@ private:
    */
   TopologyMap _new_nodes_map;
 
+  /**
+   * Where the nodes of the children of \p _child_node_parent go,
+   * indexed by child*n_nodes+node, when _refine_elements() has
+   * already worked that out on several threads; otherwise nullptr.
+   */
+  const Elem * _child_node_parent;
+  const std::vector<Point> * _child_node_points;
+
   /**
    * Reference to the mesh.
    */
@@ -21,6 +21,7 @@
 #define LIBMESH_MESH_SMOOTHER_LAPLACE_H
 
 // C++ Includes
+#include <unordered_map>
 #include <vector>
 
 // Local Includes
@@ -38,6 +39,10 @@ namespace libMesh
  * guarantee that points will be smoothed to valid locations, e.g.
  * locations inside the boundary!  This aspect could use work.
  *
+ * Each processor only smooths, and only keeps the graph of, its own
+ * nodes, so a DistributedMesh never needs to be serialized.  The
+ * averaging is done in parallel between threads.
+ *
  * \author John W. Peterson
  * \date 2002-2007
  */
@@ -82,26 +87,22 @@ public:
 
   /**
    * Mainly for debugging, this function will print
-   * out the connectivity graph which has been created.
+   * out the connectivity graph which has been created,
+   * for the nodes local to this processor.
    */
   void print_graph(std::ostream & out = libMesh::out) const;
 
 private:
-  /**
-   * This function allgather's the (local) graph after
-   * it is computed on each processor by the init() function.
-   */
-  void allgather_graph();
-
   /**
    * True if the L-graph has been created, false otherwise.
    */
   bool _initialized;
 
   /**
-   * Data structure for holding the L-graph
+   * Data structure for holding the L-graph: the ids of the nodes
+   * sharing an edge with each of our local nodes, indexed by id.
    */
-  std::vector<std::vector<dof_id_type>> _graph;
+  std::unordered_map<dof_id_type, std::vector<dof_id_type>> _graph;
 };
 
 
@@ -57,6 +57,9 @@ class UnstructuredMesh;
  * 3) L. Branets, "A variational grid optimization algorithm based on a local
  * cell quality metric", Ph.D. thesis, The University of Texas at Austin, 2005.
  *
+ * The optimization is serial: a DistributedMesh is serialized while
+ * it is smoothed, and every processor smooths the whole mesh.
+ *
  * \author Derek R. Gaston
  * \date 2006
  */
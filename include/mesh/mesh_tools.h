@@ -30,9 +30,11 @@
 namespace libMesh
 {
 enum ElemType : int;
+enum ElemQuality : int;
 }
 #else
 #include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_elem_quality.h"
 #endif
 
 // C++ Includes
@@ -220,6 +222,19 @@ create_nodal_bounding_box (const MeshBase & mesh);
 libMesh::BoundingBox
 create_local_bounding_box (const MeshBase & mesh);
 
+/**
+ * \returns The permutation which sorts \p points along a
+ * space-filling curve through \p bbox: a Hilbert curve if libMesh
+ * was configured with libHilbert, or a Morton (Z-order) curve
+ * otherwise.  Points with equal curve positions keep their input
+ * order.
+ *
+ * This does not need to be run in parallel.
+ */
+std::vector<std::size_t>
+space_filling_curve_order (const std::vector<Point> & points,
+                           const BoundingBox & bbox);
+
 /**
  * \returns Two points defining a cartesian box that bounds the
  * elements belonging to processor pid.
@@ -277,6 +292,39 @@ Sphere
 subdomain_bounding_sphere (const MeshBase & mesh,
                            const subdomain_id_type sid);
 
+/**
+ * \returns The smallest Elem::hmin() and the largest Elem::hmax()
+ * over all active elements of \p mesh.  Each element's vertex
+ * coordinates are gathered once and both distances found in a single
+ * pass over its vertex pairs, with the elements split across
+ * threads.
+ *
+ * This must be called on every processor of the mesh.
+ */
+std::pair<Real, Real>
+h_range (const MeshBase & mesh);
+
+/**
+ * \returns The total Elem::volume() of the active elements of
+ * dimension \p dim, or of mesh_dimension() by default, computed
+ * across threads and processors.
+ *
+ * This must be called on every processor of the mesh.
+ */
+Real
+volume (const MeshBase & mesh,
+        unsigned int dim = libMesh::invalid_uint);
+
+/**
+ * Fills \p qualities with the Elem::quality() of type \p quality_type
+ * of each active element on this processor, i.e. of every active
+ * element of a serialized mesh, in iteration order, computing them
+ * across threads.
+ */
+void elem_quality (const MeshBase & mesh,
+                   const ElemQuality quality_type,
+                   std::vector<Real> & qualities);
+
 
 /**
  * Fills in a vector of all element types in the mesh.  Implemented
@@ -632,6 +680,18 @@ namespace Private {
  *
  */
 void globally_renumber_nodes_and_elements (MeshBase &);
+
+/**
+ * There is no reason for a user to ever call this function.
+ *
+ * Fills \p neighbors with the nodal neighbors of the node with id
+ * \p global_id, given the elements touching it.  This is the common
+ * implementation of find_nodal_neighbors() and of NodeAdjacency.
+ */
+void find_nodal_neighbors_helper (const dof_id_type global_id,
+                                  const std::vector<const Elem *>::const_iterator elems_begin,
+                                  const std::vector<const Elem *>::const_iterator elems_end,
+                                  std::vector<const Node *> & neighbors);
 } // end namespace Private
 
 } // end namespace MeshTools
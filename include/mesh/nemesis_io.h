@@ -151,6 +151,21 @@ public:
    */
   void append(bool val);
 
+  /**
+   * If true, write_timestep() and write_nodal_data() return once the
+   * local nodal data is copied, and a background thread on each
+   * processor writes it to that processor's file.  See
+   * ExodusII_IO::set_asynchronous_writes().  By default this flag is
+   * set to false.
+   */
+  void set_asynchronous_writes(bool val);
+
+  /**
+   * Blocks until all asynchronous writes so far are complete, and
+   * throws if any of them failed.
+   */
+  void wait_for_writes();
+
 private:
 #if defined(LIBMESH_HAVE_EXODUS_API) && defined(LIBMESH_HAVE_NEMESIS_API)
   std::unique_ptr<Nemesis_IO_Helper> nemhelper;
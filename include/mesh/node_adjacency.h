@@ -0,0 +1,111 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_NODE_ADJACENCY_H
+#define LIBMESH_NODE_ADJACENCY_H
+
+// Local Includes
+#include "libmesh/id_types.h"
+#include "libmesh/simple_range.h"
+
+// C++ Includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class MeshBase;
+class Node;
+
+/**
+ * The elements touching each node of a mesh, and the nodal neighbors
+ * of each node as \p MeshTools::find_nodal_neighbors() defines them,
+ * each stored in compressed sparse row form: one array holding the
+ * entries for every node, and the offset of each node's first entry.
+ *
+ * \p MeshBase::node_adjacency() builds one of these when it is first
+ * needed and keeps it until nodes or elements are added, deleted or
+ * renumbered, so that code needing this connectivity repeatedly
+ * doesn't have to build its own nodes-to-elements map each time.
+ */
+class NodeAdjacency
+{
+public:
+  /**
+   * Builds the adjacency of every node and element \p mesh has.
+   * The nodal neighbors are found in parallel between threads.
+   */
+  explicit NodeAdjacency (const MeshBase & mesh);
+
+  typedef std::vector<const Elem *>::const_iterator elem_iterator;
+  typedef std::vector<const Node *>::const_iterator node_iterator;
+
+  /**
+   * \returns The elements touching \p node, active or not, in the
+   * order the mesh iterates over its elements.
+   */
+  SimpleRange<elem_iterator> elems (const Node & node) const;
+
+  /**
+   * \returns Every node directly attached to \p node by an edge of an
+   * active element, in the same order \p
+   * MeshTools::find_nodal_neighbors() gives them.
+   */
+  SimpleRange<node_iterator> nodal_neighbors (const Node & node) const;
+
+  /**
+   * \returns The heap memory, in bytes, this adjacency takes.
+   */
+  std::size_t memory_footprint () const;
+
+private:
+
+  /**
+   * \returns The row of \p node in the offset arrays.
+   */
+  std::size_t _row (const Node & node) const;
+
+  /**
+   * The id of the node in each row, when the ids aren't simply
+   * 0 to the number of rows.
+   */
+  std::vector<dof_id_type> _node_ids;
+  bool _contiguous_ids;
+
+  /**
+   * The elements touching each node, and the offset of the first of
+   * them for each row, with one extra offset at the end.
+   */
+  std::vector<std::size_t> _elem_offsets;
+  std::vector<const Elem *> _elems;
+
+  /**
+   * The nodal neighbors of each node, and the offset of the first of
+   * them for each row, with one extra offset at the end.
+   */
+  std::vector<std::size_t> _neighbor_offsets;
+  std::vector<const Node *> _neighbors;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_NODE_ADJACENCY_H
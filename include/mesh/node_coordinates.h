@@ -0,0 +1,116 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_NODE_COORDINATES_H
+#define LIBMESH_NODE_COORDINATES_H
+
+// Local Includes
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+
+// C++ Includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class MeshBase;
+class Node;
+
+/**
+ * A contiguous copy of the coordinates of every node of a mesh, in
+ * separate x, y and z arrays indexed by a compact local node index,
+ * together with the indices of the nodes of every element.
+ *
+ * Reading an element's node locations from here touches a few
+ * contiguous arrays instead of every individually allocated \p Node,
+ * which is what \p FEMap does when told to (see \p
+ * FEMap::set_node_coordinates()).
+ *
+ * \p MeshBase::node_coordinates() builds one of these when it is first
+ * needed and keeps it until nodes or elements are added, deleted or
+ * renumbered, and the \p MeshTools::Modification functions which move
+ * nodes update it.  Code moving nodes by other means must call \p
+ * MeshBase::update_node_coordinates() afterward.  Debug builds check
+ * each location read against its node.
+ */
+class NodeCoordinates
+{
+public:
+  /**
+   * Copies the locations of every node \p mesh has, and the node
+   * indices of every element.
+   */
+  explicit NodeCoordinates (const MeshBase & mesh);
+
+  /**
+   * Copies the node locations again, e.g. after the nodes have been
+   * moved.  The connectivity is unchanged.
+   */
+  void update_coordinates ();
+
+  /**
+   * \returns The number of nodes stored.
+   */
+  std::size_t n_nodes () const { return _nodes.size(); }
+
+  /**
+   * \returns The location of the node with compact index \p i.
+   */
+  Point point (std::size_t i) const;
+
+  /**
+   * Fills \p points with the locations of the nodes of \p elem.
+   *
+   * \returns \p false, leaving \p points untouched, if \p elem isn't
+   * stored here.
+   */
+  bool elem_points (const Elem & elem,
+                    std::vector<Point> & points) const;
+
+  /**
+   * \returns The heap memory, in bytes, these coordinates take.
+   */
+  std::size_t memory_footprint () const;
+
+private:
+
+  /**
+   * The node at each compact index.
+   */
+  std::vector<const Node *> _nodes;
+
+  /**
+   * The coordinates of each node.
+   */
+  std::vector<Real> _x, _y, _z;
+
+  /**
+   * The compact indices of the nodes of every element, and the
+   * offset of the first of them for each element id, with one extra
+   * offset at the end.  Ids without an element have no entries.
+   */
+  std::vector<std::size_t> _elem_offsets;
+  std::vector<std::size_t> _elem_nodes;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_NODE_COORDINATES_H
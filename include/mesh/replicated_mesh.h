@@ -23,10 +23,13 @@
 // Local Includes
 #include "libmesh/unstructured_mesh.h"
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
+#include "libmesh/filtered_range.h"
 
 // C++ Includes
 #include <cstddef>
+#include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -39,6 +42,13 @@ namespace libMesh
  * Most methods for this class are found in MeshBase, and most
  * implementation details are found in UnstructuredMesh.
  *
+ * \note Every processor, including every processor on the same
+ * compute node, gets its own copy.  The copies can't be shared
+ * through shared memory, because each processor writes to its
+ * nodes and elements: the DofMap stores its dof indices on them,
+ * and refinement, renumbering and partitioning change them.  When
+ * one copy per processor won't fit, use a DistributedMesh.
+ *
  * \author Roy Stogner
  * \date 2007
  * \brief Mesh data structure replicated on all processors.
@@ -196,8 +206,9 @@ public:
    * If \p clear_stitched_boundary_ids==true, this function clears boundary_info IDs in this
    * mesh associated \p this_mesh_boundary and \p other_mesh_boundary.
    * If \p use_binary_search is true, we use an optimized "sort then binary search" algorithm
-   * for finding matching nodes. Otherwise we use a N^2 algorithm (which can be more reliable
-   * at dealing with slightly misaligned meshes).
+   * for finding matching nodes. Otherwise we compare every pair of nodes within the relative
+   * tolerance of each other (which can be more reliable at dealing with slightly misaligned
+   * meshes).
    * If \p enforce_all_nodes_match_on_boundaries is true, we throw an error if the number of
    * nodes on the specified boundaries don't match the number of nodes that were merged.
    * This is a helpful error check in some cases.
@@ -222,6 +233,26 @@ public:
                       bool use_binary_search=true,
                       bool enforce_all_nodes_match_on_boundaries=false);
 
+  /**
+   * Stitch each of \p other_meshes to this mesh in turn, so that this mesh is the union of
+   * all of them.  \p other_mesh_boundary_ids[i] on \p other_meshes[i] is stitched to
+   * \p this_mesh_boundary_ids[i] on this mesh as stitched so far, which may be a boundary
+   * that came from an earlier mesh in the list.  The other arguments are as above.
+   *
+   * This is much faster than stitching the meshes one call at a time, since neighbor links
+   * are only patched up around each stitched surface and the result is only prepared for
+   * use once, at the end.  If \p clear_stitched_boundary_ids==true, all the boundary ids
+   * which were stitched are cleared from the faces now internal to the mesh.
+   */
+  void stitch_meshes (const std::vector<const ReplicatedMesh *> & other_meshes,
+                      const std::vector<boundary_id_type> & this_mesh_boundary_ids,
+                      const std::vector<boundary_id_type> & other_mesh_boundary_ids,
+                      Real tol=TOLERANCE,
+                      bool clear_stitched_boundary_ids=false,
+                      bool verbose=true,
+                      bool use_binary_search=true,
+                      bool enforce_all_nodes_match_on_boundaries=false);
+
   /**
    * Similar to stitch_meshes, except that we stitch two adjacent surfaces within this mesh.
    */
@@ -270,6 +301,21 @@ public:
   virtual SimpleRange<element_iterator> element_ptr_range() override { return {elements_begin(), elements_end()}; }
   virtual SimpleRange<const_element_iterator> element_ptr_range() const override  { return {elements_begin(), elements_end()}; }
 
+  /**
+   * \returns A range over the elements satisfying \p pred, which
+   * unlike the virtual iterator ranges can be inlined entirely.  See
+   * \p MeshTools::for_each_element() and \p ElemFilter.
+   */
+  template <typename Pred>
+  FilteredRange<std::vector<Elem *>::iterator, Pred>
+  filtered_element_ptr_range (const Pred & pred)
+  { return {_elements.begin(), _elements.end(), pred}; }
+
+  template <typename Pred>
+  FilteredRange<std::vector<Elem *>::const_iterator, Pred>
+  filtered_element_ptr_range (const Pred & pred) const
+  { return {_elements.begin(), _elements.end(), pred}; }
+
   virtual element_iterator active_elements_begin () override;
   virtual element_iterator active_elements_end () override;
   virtual const_element_iterator active_elements_begin() const override;
@@ -524,7 +570,9 @@ private:
 
   /**
    * Helper function for stitch_meshes and stitch_surfaces
-   * that does the mesh stitching.
+   * that does the mesh stitching.  Unless \p prepare_after is
+   * true, the stitched mesh is left for the caller to prepare,
+   * and its stitched boundary ids are left for the caller to clear.
    */
   void stitching_helper (const ReplicatedMesh * other_mesh,
                          boundary_id_type boundary_id_1,
@@ -534,7 +582,14 @@ private:
                          bool verbose,
                          bool use_binary_search,
                          bool enforce_all_nodes_match_on_boundaries,
-                         bool skip_find_neighbors);
+                         bool skip_find_neighbors,
+                         bool prepare_after);
+
+  /**
+   * Removes any of \p stitched_ids from the element sides which
+   * have neighbors after stitching.
+   */
+  void clear_stitched_boundary_ids (const std::set<boundary_id_type> & stitched_ids);
 
   /**
    * Typedefs for the container implementation.  In this case,
@@ -0,0 +1,81 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_STREAMED_GATHER_H
+#define LIBMESH_STREAMED_GATHER_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes
+#include <cstddef>
+#include <functional>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class MeshBase;
+class Node;
+
+namespace MeshTools
+{
+
+/**
+ * Calls \p node_action on processor 0 for every node of \p mesh,
+ * without gathering the mesh there.  Processor 0 visits its own nodes
+ * first, then asks each other processor in turn for chunks of at
+ * most \p chunk_size of its local nodes, so that writers of serial
+ * file formats can output a huge DistributedMesh while no processor
+ * holds more than its own part of it plus one chunk.
+ *
+ * The nodes processor 0 gets from other processors are temporary
+ * copies with the right id, position, and processor id, and nothing
+ * else.  They are only valid during the call to \p node_action.
+ *
+ * This must be called on every processor, unless the mesh is
+ * serialized on processor 0 already, in which case it just visits
+ * every node there and nothing needs to be sent.
+ */
+void stream_nodes_to_zero (const MeshBase & mesh,
+                           const std::function<void (const Node &)> & node_action,
+                           std::size_t chunk_size = 4096);
+
+/**
+ * Calls \p elem_action on processor 0 for every element of \p mesh,
+ * or every active element if \p active_only, in the same way
+ * \p stream_nodes_to_zero() visits nodes.
+ *
+ * The elements processor 0 gets from other processors are temporary
+ * copies with the right type, id, subdomain id and processor id,
+ * whose nodes have the right ids, but which have no node positions,
+ * neighbors, parents or children.  They are only valid during the
+ * call to \p elem_action.
+ */
+void stream_elems_to_zero (const MeshBase & mesh,
+                           const std::function<void (const Elem &)> & elem_action,
+                           bool active_only = false,
+                           std::size_t chunk_size = 4096);
+
+} // namespace MeshTools
+
+} // namespace libMesh
+
+#endif // LIBMESH_STREAMED_GATHER_H
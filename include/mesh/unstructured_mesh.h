@@ -175,6 +175,18 @@ public:
   virtual void find_neighbors (const bool reset_remote_elements = false,
                                const bool reset_current_list    = true) override;
 
+  virtual bool find_neighbors_after_refinement (const std::vector<Elem *> & refined_elems) override;
+
+  /**
+   * Sets how many pieces find_neighbors() splits its search for
+   * matching sides into, for threads to work on.  With the default,
+   * 0, it uses one per thread, but none for meshes too small to be
+   * worth it.  With more than one, the search is split that way
+   * whatever the number of threads; this is mostly useful for
+   * testing.
+   */
+  void find_neighbors_ranges (unsigned int n_ranges) { _find_neighbors_ranges = n_ranges; }
+
 #ifdef LIBMESH_ENABLE_AMR
   /**
    * Delete subactive (i.e. children of coarsened) elements.
@@ -184,6 +196,13 @@ public:
   virtual bool contract () override;
 #endif // #ifdef LIBMESH_ENABLE_AMR
 
+private:
+
+  /**
+   * How many pieces find_neighbors() splits its search into, or 0 to
+   * decide from the number of threads.
+   */
+  unsigned int _find_neighbors_ranges;
 };
 
 
@@ -36,6 +36,9 @@
 // C++ includes
 #include <cstddef>
 #include <map>
+#include <set>
+#include <string>
+#include <vector>
 
 // Forward declarations
 class vtkUnstructuredGrid;
@@ -43,7 +46,9 @@ class vtkUnstructuredGrid;
 namespace libMesh
 {
 
+class EquationSystems;
 class MeshBase;
+class Node;
 
 /**
  * This class implements reading and writing meshes in the VTK format.
@@ -93,6 +98,17 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * With direct writes, this writes the nodal values of the Lagrange
+   * variables (and the element values of the CONSTANT, MONOMIAL
+   * variables) of \p es straight from each system's
+   * current_local_solution, so no global solution vector is built.
+   * Otherwise this falls back on the MeshOutput implementation.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const EquationSystems &,
+                                 const std::set<std::string> *) override;
+
   /**
    * This method implements reading a mesh from a specified file
    * in VTK format.
@@ -112,13 +128,25 @@ public:
    */
   virtual void write (const std::string &) override;
 
-#ifdef LIBMESH_HAVE_VTK
-
   /**
    * Setter for compression flag
    */
   void set_compression(bool b);
 
+  /**
+   * If \p b is true, each processor writes its own piece of the mesh,
+   * with its local active elements and their nodes, straight to a
+   * .vtu file, and processor 0 writes the .pvtu file which indexes
+   * them.  This needs neither a serialized mesh nor a copy of it in a
+   * vtkUnstructuredGrid, and works even without the VTK library.
+   *
+   * Compressed direct writes need zlib; without it they are written
+   * uncompressed.
+   */
+  void set_direct_writes(bool b);
+
+#ifdef LIBMESH_HAVE_VTK
+
   /**
    * Get a pointer to the VTK unstructured grid data structure.
    */
@@ -168,11 +196,6 @@ private:
    */
   vtkSmartPointer<vtkUnstructuredGrid> _vtk_grid;
 
-  /**
-   * Flag to indicate whether the output should be compressed
-   */
-  bool _compress;
-
   /**
    * maps global node id to node id of partition
    */
@@ -220,6 +243,47 @@ private:
   static ElementMaps build_element_maps();
 
 #endif
+
+private:
+  /**
+   * Finds the nodes of our piece of the mesh: our local nodes, then
+   * any others our active local elements use.
+   */
+  void build_piece_nodes();
+
+  /**
+   * The direct writes version of write_nodal_data(), for a nodal
+   * solution vector as built by EquationSystems.
+   */
+  void write_nodal_data_directly (const std::string & fname,
+                                  const std::vector<Number> & soln,
+                                  const std::vector<std::string> & names);
+
+  /**
+   * Writes our piece of the mesh, with the given point and cell data
+   * arrays, to its .vtu file, and the .pvtu file \p fname indexing
+   * every processor's piece.
+   */
+  void write_piece (const std::string & fname,
+                    const std::vector<std::string> & node_names,
+                    const std::vector<std::vector<double>> & node_data,
+                    const std::vector<std::string> & elem_names,
+                    const std::vector<std::vector<double>> & elem_data);
+
+  /**
+   * Flag to indicate whether the output should be compressed
+   */
+  bool _compress;
+
+  /**
+   * Flag to indicate whether we write pieces ourselves
+   */
+  bool _direct_writes;
+
+  /**
+   * The nodes of our piece, in the order we write them
+   */
+  std::vector<const Node *> _piece_nodes;
 };
 
 
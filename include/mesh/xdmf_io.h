@@ -0,0 +1,168 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_XDMF_IO_H
+#define LIBMESH_XDMF_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_output.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class DofObject;
+class EquationSystems;
+class MeshBase;
+
+/**
+ * This class writes a mesh, and the values of variables on it, to a
+ * single HDF5 file of heavy data described by an XDMF file, which
+ * ParaView and VisIt can read.
+ *
+ * Each processor writes only its own nodes and active elements, as
+ * one contiguous slab of each global array, so nothing is gathered
+ * onto one processor and there are no per-processor files to
+ * combine later.  With a parallel HDF5 library the slabs are written
+ * collectively through MPI-IO; with a serial one the processors
+ * take turns writing to the file.
+ *
+ * Successive write_timestep() calls append time steps to the same
+ * file.  As with ExodusII_IO, the mesh is written with the first of
+ * them and must not change afterwards.
+ *
+ * This class will not have any functionality unless HDF5 is detected
+ * during configure and hence LIBMESH_HAVE_HDF5 is defined.
+ */
+class XDMFIO : public MeshOutput<MeshBase>,
+               public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  Takes a read-only reference to a mesh object.
+   */
+  explicit
+  XDMFIO (const MeshBase & mesh);
+
+  /**
+   * Bring in base class functionality for name resolution and to
+   * avoid warnings about hidden overloaded virtual functions.
+   */
+  using MeshOutput<MeshBase>::write_nodal_data;
+
+  /**
+   * Writes the mesh alone to the XDMF file \p fname, and its heavy
+   * data to heavy_data_file_name(fname).
+   */
+  virtual void write (const std::string & fname) override;
+
+  /**
+   * Writes the mesh, and the variables of \p es (or of its systems
+   * \p system_names), as a file with a single time step.
+   */
+  virtual void write_equation_systems (const std::string & fname,
+                                       const EquationSystems & es,
+                                       const std::set<std::string> * system_names=nullptr) override;
+
+  /**
+   * Appends the variables of \p es (or of its systems \p
+   * system_names), at time \p time, to \p fname, first starting the
+   * file with the mesh if we haven't written to it yet.
+   *
+   * CONSTANT, MONOMIAL variables are written as element data, and
+   * other scalar-valued variables by their values at nodes.  SCALAR
+   * and vector-valued variables are skipped.  With complex numbers,
+   * each variable is written as "r_" and "i_" prefixed real and
+   * imaginary parts.
+   */
+  void write_timestep (const std::string & fname,
+                       const EquationSystems & es,
+                       const int timestep,
+                       const Real time,
+                       const std::set<std::string> * system_names=nullptr);
+
+  /**
+   * \returns The name of the HDF5 file holding the data for the XDMF
+   * file \p fname: \p fname with its extension replaced by ".h5".
+   */
+  static std::string heavy_data_file_name (const std::string & fname);
+
+private:
+
+  /**
+   * Starts the files for \p fname, writing the mesh to the heavy
+   * data file and numbering our nodes and elements within it.
+   */
+  void start_file (const std::string & fname);
+
+  /**
+   * Rewrites the XDMF description of everything in the heavy data
+   * file so far.
+   */
+  void write_xdmf () const;
+
+  /**
+   * One time step of the series
+   */
+  struct Step
+  {
+    int timestep;
+    Real time;
+    std::vector<std::string> nodal_names, elemental_names;
+  };
+
+  /**
+   * The XDMF file we are writing, or empty if none yet
+   */
+  std::string _file_name;
+
+  /**
+   * The steps we've written to it
+   */
+  std::vector<Step> _steps;
+
+  /**
+   * Our local nodes and active elements, in the order we wrote them
+   */
+  std::vector<const DofObject *> _local_nodes, _local_elems;
+
+  /**
+   * The numbers of nodes and elements on all processors, and of
+   * those before ours in the file
+   */
+  uint64_t _n_nodes, _node_offset, _n_elems, _elem_offset;
+
+  /**
+   * The length of the mixed topology array
+   */
+  uint64_t _topology_size;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_XDMF_IO_H
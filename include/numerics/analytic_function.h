@@ -22,9 +22,11 @@
 
 // Local Includes
 #include "libmesh/function_base.h"
+#include "libmesh/int_range.h"
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -100,6 +102,14 @@ public:
   virtual void operator() (const Point & p,
                            const Real time,
                            DenseVector<Output> & output) override;
+
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<Output> & output) override;
+
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<DenseVector<Output>> & output) override;
 };
 
 
@@ -130,6 +140,36 @@ void AnalyticFunction<Output>::operator() (const Point & p,
 
 
 
+template <typename Output>
+inline
+void AnalyticFunction<Output>::evaluate (const std::vector<Point> & points,
+                                         const Real time,
+                                         std::vector<Output> & output)
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert (this->_number_fptr);
+  output.resize(points.size());
+  for (auto i : index_range(points))
+    output[i] = this->_number_fptr(points[i], time);
+}
+
+
+
+template <typename Output>
+inline
+void AnalyticFunction<Output>::evaluate (const std::vector<Point> & points,
+                                         const Real time,
+                                         std::vector<DenseVector<Output>> & output)
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert (this->_vector_fptr);
+  libmesh_assert_equal_to (output.size(), points.size());
+  for (auto i : index_range(points))
+    this->_vector_fptr(output[i], points[i], time);
+}
+
+
+
 template <typename Output>
 AnalyticFunction<Output>::AnalyticFunction (OutputFunction fptr) :
   FunctionBase<Output> (),
@@ -166,6 +166,52 @@ public:
       component(reverse_index_map[i].second,p,time);
   }
 
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<Output> & output) override
+  {
+    output.assign(points.size(), 0);
+
+    if (reverse_index_map.empty() ||
+        reverse_index_map[0].first == libMesh::invalid_uint)
+      return;
+
+    const unsigned int sub_index = reverse_index_map[0].second;
+    std::vector<DenseVector<Output>> temp
+      (points.size(), DenseVector<Output>(sub_index+1));
+    subfunctions[reverse_index_map[0].first]->evaluate(points, time, temp);
+    for (auto p : index_range(points))
+      output[p] = temp[p](sub_index);
+  }
+
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<DenseVector<Output>> & output) override
+  {
+    libmesh_assert_equal_to (output.size(), points.size());
+
+    // Necessary in case we have output components not covered by
+    // any subfunctions
+    for (auto & point_output : output)
+      {
+        libmesh_assert_greater_equal (point_output.size(),
+                                      reverse_index_map.size());
+        point_output.zero();
+      }
+
+    // Each subfunction sees every point in one call
+    std::vector<DenseVector<Output>> temp(points.size());
+    for (auto i : index_range(subfunctions))
+      {
+        for (auto & point_temp : temp)
+          point_temp.resize(cast_int<unsigned int>(index_maps[i].size()));
+        subfunctions[i]->evaluate(points, time, temp);
+        for (auto p : index_range(points))
+          for (auto j : index_range(index_maps[i]))
+            output[p](index_maps[i][j]) = temp[p](j);
+      }
+  }
+
   virtual std::unique_ptr<FunctionBase<Output>> clone() const override
   {
     CompositeFunction * returnval = new CompositeFunction();
@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
@@ -72,6 +73,23 @@ public:
       output(i) = _c;
   }
 
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real,
+                         std::vector<Output> & output) override
+  {
+    output.assign(points.size(), _c);
+  }
+
+  virtual void evaluate (const std::vector<Point> & libmesh_dbg_var(points),
+                         const Real,
+                         std::vector<DenseVector<Output>> & output) override
+  {
+    libmesh_assert_equal_to (output.size(), points.size());
+    for (auto & point_output : output)
+      for (auto & val : point_output.get_values())
+        val = _c;
+  }
+
   virtual std::unique_ptr<FunctionBase<Output>> clone() const override
   {
     return libmesh_make_unique<ConstFunction<Output>>(_c);
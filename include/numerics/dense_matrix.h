@@ -240,6 +240,22 @@ public:
   void resize(const unsigned int new_m,
               const unsigned int new_n);
 
+  /**
+   * Makes room for a \p new_m by \p new_n matrix without changing
+   * the size of this one, so that later resize() calls up to that
+   * many entries won't allocate memory.
+   */
+  void reserve(const unsigned int new_m,
+               const unsigned int new_n)
+  { _val.reserve(std::size_t(new_m)*new_n); }
+
+  /**
+   * \returns The number of entries the matrix can hold without
+   * allocating more memory.
+   */
+  std::size_t capacity() const
+  { return _val.capacity(); }
+
   /**
    * Multiplies every element in the matrix by \p factor.
    */
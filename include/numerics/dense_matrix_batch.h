@@ -0,0 +1,221 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DENSE_MATRIX_BATCH_H
+#define LIBMESH_DENSE_MATRIX_BATCH_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+template <typename T> class DenseMatrix;
+template <typename T> class DenseVector;
+
+/**
+ * Holds many square dense matrices of the same size, to be factored
+ * and solved together.  This is meant for the thousands of small
+ * independent solves done in patch recovery, local DG solves, static
+ * condensation and the like, where solving one DenseMatrix at a time
+ * leaves each solve too short to vectorize.
+ *
+ * The matrices are interleaved: entry (i,j) of every matrix is
+ * stored contiguously, so that each step of a factorization or a
+ * solve runs over all of the matrices at once in a unit stride loop.
+ * Only the pivot searches and row swaps of the LU factorization are
+ * done one matrix at a time.
+ *
+ * As with DenseMatrix, the first solve factors the matrices in
+ * place, and later solves with the same factorization reuse it.
+ *
+ * \brief Many small dense matrices factored together.
+ */
+template<typename T>
+class DenseMatrixBatch
+{
+public:
+
+  /**
+   * Constructor.  Creates \p n_matrices matrices of size \p n by
+   * \p n, all zero.
+   */
+  DenseMatrixBatch (const unsigned int n_matrices = 0,
+                    const unsigned int n = 0);
+
+  /**
+   * Resizes to \p n_matrices matrices of size \p n by \p n, and
+   * zeros them.
+   */
+  void resize (const unsigned int n_matrices,
+               const unsigned int n);
+
+  /**
+   * Sets every entry of every matrix to zero, and forgets any
+   * factorization.
+   */
+  void zero ();
+
+  /**
+   * \returns The number of matrices.
+   */
+  unsigned int n_matrices () const { return _n_matrices; }
+
+  /**
+   * \returns The number of rows, and of columns, of each matrix.
+   */
+  unsigned int n () const { return _n; }
+
+  /**
+   * \returns Entry (i,j) of matrix \p matrix.
+   */
+  T operator() (const unsigned int matrix,
+                const unsigned int i,
+                const unsigned int j) const;
+
+  /**
+   * \returns A writable reference to entry (i,j) of matrix \p matrix.
+   */
+  T & operator() (const unsigned int matrix,
+                  const unsigned int i,
+                  const unsigned int j);
+
+  /**
+   * Copies \p mat, which must be \p n() by \p n(), into matrix
+   * \p matrix.
+   */
+  void set_matrix (const unsigned int matrix,
+                   const DenseMatrix<T> & mat);
+
+  /**
+   * Solves each system \p matrix \p x[matrix] = \p b[matrix] by LU
+   * factorization with partial pivoting.
+   */
+  void lu_solve (const std::vector<DenseVector<T>> & b,
+                 std::vector<DenseVector<T>> & x);
+
+  /**
+   * Solves each system \p matrix \p x[matrix] = \p b[matrix] by
+   * Cholesky factorization, for symmetric positive definite
+   * matrices.
+   */
+  void cholesky_solve (const std::vector<DenseVector<T>> & b,
+                       std::vector<DenseVector<T>> & x);
+
+private:
+
+  /**
+   * Index of entry (i,j) of the first matrix in \p _val.
+   */
+  std::size_t index (const unsigned int i,
+                     const unsigned int j) const
+  { return (std::size_t(i)*_n + j)*_n_matrices; }
+
+  /**
+   * Factors every matrix in place into a unit lower triangular L
+   * and an upper triangular U, with the row permutations in
+   * \p _pivots.
+   */
+  void _lu_decompose ();
+
+  /**
+   * Factors every matrix in place into L L^T, with L in the lower
+   * triangle.
+   */
+  void _cholesky_decompose ();
+
+  /**
+   * Copies the right hand sides into interleaved storage.
+   */
+  void _interleave (const std::vector<DenseVector<T>> & b,
+                    std::vector<T> & z) const;
+
+  /**
+   * Copies interleaved solutions out to \p x.
+   */
+  void _deinterleave (const std::vector<T> & z,
+                      std::vector<DenseVector<T>> & x) const;
+
+  /**
+   * The number of matrices.
+   */
+  unsigned int _n_matrices;
+
+  /**
+   * The size of each matrix.
+   */
+  unsigned int _n;
+
+  /**
+   * The interleaved entries of the matrices.
+   */
+  std::vector<T> _val;
+
+  /**
+   * The row swapped with row i of each matrix during LU
+   * factorization, interleaved as the entries are.
+   */
+  std::vector<unsigned int> _pivots;
+
+  /**
+   * The factorization, if any, stored in \p _val.
+   */
+  enum DecompositionType {LU, CHOLESKY, NONE};
+  DecompositionType _decomposition_type;
+};
+
+
+
+// ------------------------------------------------------------
+// DenseMatrixBatch member functions
+template<typename T>
+inline
+T DenseMatrixBatch<T>::operator() (const unsigned int matrix,
+                                   const unsigned int i,
+                                   const unsigned int j) const
+{
+  libmesh_assert_less (matrix, _n_matrices);
+  libmesh_assert_less (i, _n);
+  libmesh_assert_less (j, _n);
+
+  return _val[this->index(i,j) + matrix];
+}
+
+
+
+template<typename T>
+inline
+T & DenseMatrixBatch<T>::operator() (const unsigned int matrix,
+                                     const unsigned int i,
+                                     const unsigned int j)
+{
+  libmesh_assert_less (matrix, _n_matrices);
+  libmesh_assert_less (i, _n);
+  libmesh_assert_less (j, _n);
+
+  return _val[this->index(i,j) + matrix];
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_DENSE_MATRIX_BATCH_H
@@ -46,6 +46,92 @@ MetaPhysicL::DualNumber<T, D, asd> sqrt(MetaPhysicL::DualNumber<T, D, asd> && in
 namespace libMesh
 {
 
+/**
+ * Kernels on the row-major storage of a DenseMatrix, written so that
+ * compilers can vectorize their inner loops, which the element
+ * accessors prevent.  The matrix-vector product is instantiated for
+ * the row lengths of common element matrices, so that those loops
+ * have a length known at compile time.
+ */
+namespace DenseMatrixKernels
+{
+
+// y += A*x for an m x N matrix A
+template <unsigned int N, typename T, typename T2, typename T3>
+inline
+void fixed_matvec (const T * a, unsigned int m, const T2 * x, T3 * y)
+{
+  for (unsigned int i=0; i != m; ++i, a += N)
+    {
+      T3 sum = 0;
+      for (unsigned int j=0; j != N; ++j)
+        sum += a[j]*x[j];
+      y[i] += sum;
+    }
+}
+
+// y += A*x for an m x n matrix A
+template <typename T, typename T2, typename T3>
+inline
+void matvec (const T * a, unsigned int m, unsigned int n, const T2 * x, T3 * y)
+{
+  switch (n)
+    {
+    case 3:  fixed_matvec<3>(a, m, x, y);  return;
+    case 4:  fixed_matvec<4>(a, m, x, y);  return;
+    case 6:  fixed_matvec<6>(a, m, x, y);  return;
+    case 8:  fixed_matvec<8>(a, m, x, y);  return;
+    case 9:  fixed_matvec<9>(a, m, x, y);  return;
+    case 10: fixed_matvec<10>(a, m, x, y); return;
+    case 20: fixed_matvec<20>(a, m, x, y); return;
+    case 27: fixed_matvec<27>(a, m, x, y); return;
+    default:
+      for (unsigned int i=0; i != m; ++i, a += n)
+        {
+          T3 sum = 0;
+          for (unsigned int j=0; j != n; ++j)
+            sum += a[j]*x[j];
+          y[i] += sum;
+        }
+    }
+}
+
+// y += A^T*x for an m x n matrix A
+template <typename T, typename T2, typename T3>
+inline
+void matvec_transpose (const T * a, unsigned int m, unsigned int n, const T2 * x, T3 * y)
+{
+  for (unsigned int i=0; i != m; ++i, a += n)
+    {
+      const T2 x_i = x[i];
+      for (unsigned int j=0; j != n; ++j)
+        y[j] += a[j]*x_i;
+    }
+}
+
+// C += A*B for an m x p matrix A and a p x n matrix B
+template <typename T, typename T2, typename T3>
+inline
+void multiply (T * c, const T2 * a, const T3 * b,
+               unsigned int m, unsigned int p, unsigned int n)
+{
+  for (unsigned int i=0; i != m; ++i, c += n)
+    for (unsigned int k=0; k != p; ++k)
+      {
+        // There is a decent chance (at least for constraint
+        // matrices) that A(i,k) = 0.
+        const T2 a_ik = a[i*p+k];
+        if (a_ik == 0.)
+          continue;
+
+        const T3 * b_k = b + k*n;
+        for (unsigned int j=0; j != n; ++j)
+          c[j] += a_ik*b_k[j];
+      }
+}
+
+} // namespace DenseMatrixKernels
+
 
 
 // ------------------------------------------------------------
@@ -70,8 +156,18 @@ void DenseMatrix<T>::left_multiply (const DenseMatrixBase<T> & M2)
       // Resize *this so that the result can fit
       this->resize (M2.m(), M3.n());
 
-      // Call the multiply function in the base class
-      this->multiply(*this, M2, M3);
+      // Another DenseMatrix lets us work on its storage directly
+      const DenseMatrix<T> * M2_dense = dynamic_cast<const DenseMatrix<T> *>(&M2);
+      if (M2_dense)
+        {
+          libmesh_assert_equal_to (M2.n(), M3.m());
+          if (!_val.empty() && M2.n())
+            DenseMatrixKernels::multiply(_val.data(), M2_dense->_val.data(),
+                                         M3._val.data(), M2.m(), M2.n(), M3.n());
+        }
+      else
+        // Call the multiply function in the base class
+        this->multiply(*this, M2, M3);
     }
 }
 
@@ -243,7 +339,17 @@ void DenseMatrix<T>::right_multiply (const DenseMatrixBase<T> & M3)
       // Resize *this so that the result can fit
       this->resize (M2.m(), M3.n());
 
-      this->multiply(*this, M2, M3);
+      // Another DenseMatrix lets us work on its storage directly
+      const DenseMatrix<T> * M3_dense = dynamic_cast<const DenseMatrix<T> *>(&M3);
+      if (M3_dense)
+        {
+          libmesh_assert_equal_to (M2.n(), M3.m());
+          if (!_val.empty() && M2.n())
+            DenseMatrixKernels::multiply(_val.data(), M2._val.data(),
+                                         M3_dense->_val.data(), M2.m(), M2.n(), M3.n());
+        }
+      else
+        this->multiply(*this, M2, M3);
     }
 }
 
@@ -415,12 +521,9 @@ void DenseMatrix<T>::vector_mult (DenseVector<T> & dest,
     this->_matvec_blas(1., 0., dest, arg);
   else
     {
-      const unsigned int n_rows = this->m();
-      const unsigned int n_cols = this->n();
-
-      for (unsigned int i=0; i<n_rows; i++)
-        for (unsigned int j=0; j<n_cols; j++)
-          dest(i) += (*this)(i,j)*arg(j);
+      DenseMatrixKernels::matvec(_val.data(), this->m(), this->n(),
+                                 arg.get_values().data(),
+                                 dest.get_values().data());
     }
 }
 
@@ -442,12 +545,9 @@ void DenseMatrix<T>::vector_mult (DenseVector<typename CompareTypes<T,T2>::super
   if (this->m() == 0 || this->n() == 0)
     return;
 
-  const unsigned int n_rows = this->m();
-  const unsigned int n_cols = this->n();
-
-  for (unsigned int i=0; i<n_rows; i++)
-    for (unsigned int j=0; j<n_cols; j++)
-      dest(i) += (*this)(i,j)*arg(j);
+  DenseMatrixKernels::matvec(_val.data(), this->m(), this->n(),
+                             arg.get_values().data(),
+                             dest.get_values().data());
 }
 
 
@@ -473,18 +573,9 @@ void DenseMatrix<T>::vector_mult_transpose (DenseVector<T> & dest,
     }
   else
     {
-      const unsigned int n_rows = this->m();
-      const unsigned int n_cols = this->n();
-
-      // WORKS
-      // for (unsigned int j=0; j<n_cols; j++)
-      //   for (unsigned int i=0; i<n_rows; i++)
-      //     dest(j) += (*this)(i,j)*arg(i);
-
-      // ALSO WORKS, (i,j) just swapped
-      for (unsigned int i=0; i<n_cols; i++)
-        for (unsigned int j=0; j<n_rows; j++)
-          dest(i) += (*this)(j,i)*arg(j);
+      DenseMatrixKernels::matvec_transpose(_val.data(), this->m(), this->n(),
+                                           arg.get_values().data(),
+                                           dest.get_values().data());
     }
 }
 
@@ -506,18 +597,9 @@ void DenseMatrix<T>::vector_mult_transpose (DenseVector<typename CompareTypes<T,
   if (this->m() == 0)
     return;
 
-  const unsigned int n_rows = this->m();
-  const unsigned int n_cols = this->n();
-
-  // WORKS
-  // for (unsigned int j=0; j<n_cols; j++)
-  //   for (unsigned int i=0; i<n_rows; i++)
-  //     dest(j) += (*this)(i,j)*arg(i);
-
-  // ALSO WORKS, (i,j) just swapped
-  for (unsigned int i=0; i<n_cols; i++)
-    for (unsigned int j=0; j<n_rows; j++)
-      dest(i) += (*this)(j,i)*arg(j);
+  DenseMatrixKernels::matvec_transpose(_val.data(), this->m(), this->n(),
+                                       arg.get_values().data(),
+                                       dest.get_values().data());
 }
 
 
@@ -696,6 +778,8 @@ void DenseMatrix<T>::_lu_back_substitute (const DenseVector<T> & b,
   // modifying the RHS.
   DenseVector<T> z = b;
 
+  std::vector<T> & x_vals = x.get_values();
+
   // Lower-triangular "top to bottom" solve step, taking into account pivots
   for (unsigned int i=0; i<n_cols; ++i)
     {
@@ -703,12 +787,12 @@ void DenseMatrix<T>::_lu_back_substitute (const DenseVector<T> & b,
       if (_pivots[i] != static_cast<pivot_index_t>(i))
         std::swap( z(i), z(_pivots[i]) );
 
-      x(i) = z(i);
-
+      const T * row_i = &_val[i*n_cols];
+      T x_i = z(i);
       for (unsigned int j=0; j<i; ++j)
-        x(i) -= A(i,j)*x(j);
+        x_i -= row_i[j]*x_vals[j];
 
-      x(i) /= A(i,i);
+      x_vals[i] = x_i / A(i,i);
     }
 
   // Upper-triangular "bottom to top" solve step
@@ -716,8 +800,11 @@ void DenseMatrix<T>::_lu_back_substitute (const DenseVector<T> & b,
 
   for (int i=last_row; i>=0; --i)
     {
+      const T * row_i = &_val[i*n_cols];
+      T x_i = x_vals[i];
       for (int j=i+1; j<static_cast<int>(n_cols); ++j)
-        x(i) -= A(i,j)*x(j);
+        x_i -= row_i[j]*x_vals[j];
+      x_vals[i] = x_i;
     }
 }
 
@@ -780,8 +867,9 @@ void DenseMatrix<T>::_lu_decompose ()
       // Scale upper triangle entries of row i by the diagonal entry
       // Note: don't scale the diagonal entry itself!
       const T diag_inv = 1. / A(i,i);
+      T * row_i = &_val[i*n_rows];
       for (unsigned int j=i+1; j<n_rows; ++j)
-        A(i,j) *= diag_inv;
+        row_i[j] *= diag_inv;
 
       // Update the remaining sub-matrix A[i+1:m][i+1:m]
       // by subtracting off (the diagonal-scaled)
@@ -795,8 +883,12 @@ void DenseMatrix<T>::_lu_decompose ()
       // in Gaussian elimination, this would 'zero' the
       // entry in the i'th column.
       for (unsigned int row=i+1; row<n_rows; ++row)
-        for (unsigned int col=i+1; col<n_rows; ++col)
-          A(row,col) -= A(row,i) * A(i,col);
+        {
+          T * row_r = &_val[row*n_rows];
+          const T a_ri = row_r[i];
+          for (unsigned int col=i+1; col<n_rows; ++col)
+            row_r[col] -= a_ri * row_i[col];
+        }
 
     } // end i loop
 
@@ -137,6 +137,21 @@ public:
    */
   void resize (const unsigned int n);
 
+  /**
+   * Makes room for \p n entries without changing the size of the
+   * vector, so that later resize() calls up to that size won't
+   * allocate memory.
+   */
+  void reserve (const unsigned int n)
+  { _val.reserve(n); }
+
+  /**
+   * \returns The number of entries the vector can hold without
+   * allocating more memory.
+   */
+  unsigned int capacity() const
+  { return cast_int<unsigned int>(_val.capacity()); }
+
   /**
    * Append additional entries to (resizing, but unchanging) the
    * vector.
@@ -0,0 +1,268 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
+#define LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
+
+// Local includes
+#include "libmesh/sparse_matrix.h"
+
+// C++ includes
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+template <typename T> class DistributedVector;
+
+/**
+ * This class provides a simple distributed compressed sparse row
+ * matrix which needs no external linear algebra package.  Each
+ * processor stores the rows it owns; entries added to rows owned
+ * elsewhere are sent to their owners by \p close().  Products with
+ * a \p DistributedVector are threaded over the local rows.  All
+ * overridden virtual functions are documented in sparse_matrix.h.
+ */
+template <typename T>
+class DistributedSparseMatrix final : public SparseMatrix<T>
+{
+public:
+  /**
+   * Constructor; initializes the matrix to be empty, without any
+   * structure, i.e.  the matrix is not usable at all.
+   *
+   * You have to initialize the matrix before usage with \p init(...).
+   */
+  DistributedSparseMatrix (const Parallel::Communicator & comm);
+
+  /**
+   * This class only holds standard containers, so the 5 special
+   * functions can be defaulted.
+   */
+  DistributedSparseMatrix (DistributedSparseMatrix &&) = default;
+  DistributedSparseMatrix (const DistributedSparseMatrix &) = default;
+  DistributedSparseMatrix & operator= (const DistributedSparseMatrix &) = default;
+  DistributedSparseMatrix & operator= (DistributedSparseMatrix &&) = default;
+  virtual ~DistributedSparseMatrix () = default;
+
+  /**
+   * The \p DistributedSparseMatrix preallocates its rows from the
+   * full sparsity pattern.  Entries outside of it are still allowed,
+   * but they are merged in more slowly by \p close().
+   */
+  virtual bool need_full_sparsity_pattern() const override
+  { return true; }
+
+  /**
+   * Allocates the local rows of the matrix with the columns of
+   * \p sparsity_pattern, whose rows are the local rows of the
+   * \p DofMap.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::Graph & sparsity_pattern) override;
+
+  virtual void init (const numeric_index_type m,
+                     const numeric_index_type n,
+                     const numeric_index_type m_l,
+                     const numeric_index_type n_l,
+                     const numeric_index_type nnz=30,
+                     const numeric_index_type noz=10,
+                     const numeric_index_type blocksize=1) override;
+
+  virtual void init (ParallelType = PARALLEL) override;
+
+  virtual void clear () override;
+
+  virtual void zero () override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> zero_clone () const override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> clone () const override;
+
+  virtual void zero_rows (std::vector<numeric_index_type> & rows, T diag_value = 0.0) override;
+
+  virtual void close () override;
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual numeric_index_type row_start () const override;
+
+  virtual numeric_index_type row_stop () const override;
+
+  virtual void set (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & dof_indices) override;
+
+  virtual void add (const T a, const SparseMatrix<T> & X) override;
+
+  /**
+   * \returns The \f$ (i,j) \f$ entry, which must be in a local row.
+   */
+  virtual T operator () (const numeric_index_type i,
+                         const numeric_index_type j) const override;
+
+  virtual Real l1_norm () const override;
+
+  virtual Real linfty_norm () const override;
+
+  virtual bool closed() const override { return _closed; }
+
+  virtual void print_personal(std::ostream & os=libMesh::out) const override;
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+  virtual void get_transpose (SparseMatrix<T> & dest) const override;
+
+  /**
+   * Computes P^T A P, fetching the rows of \p P which our rows
+   * refer to from their owners.  The product is always rebuilt from
+   * scratch, whatever \p reuse says.
+   */
+  virtual void get_ptap (const SparseMatrix<T> & P,
+                         SparseMatrix<T> & dest,
+                         bool reuse = false) const override;
+
+  /**
+   * Gets a row, which must be local, from the matrix.
+   */
+  virtual void get_row(numeric_index_type i,
+                       std::vector<numeric_index_type> & indices,
+                       std::vector<T> & values) const override;
+
+private:
+
+  /**
+   * Computes \p dest += \p this * \p arg; this is the implementation
+   * of \p DistributedVector::add_vector() for our matrices.
+   */
+  void _vector_mult_add (DistributedVector<T> & dest,
+                         const NumericVector<T> & arg) const;
+
+  /**
+   * \returns The position of the \f$ (i,j) \f$ entry, in a local
+   * row, within \p _values, or \p invalid_pos if the row has no such
+   * entry.
+   */
+  numeric_index_type _pos (const numeric_index_type i,
+                           const numeric_index_type j) const;
+
+  /**
+   * \returns The processor which owns row \p i.
+   */
+  processor_id_type _row_owner (const numeric_index_type i) const;
+
+  /**
+   * Merges the entries of \p _new_entries into the compressed rows,
+   * and rebuilds the column maps used for products.
+   */
+  void _compress ();
+
+  /**
+   * The value of \p _pos() for entries we have no room for.
+   */
+  static const numeric_index_type invalid_pos;
+
+  /**
+   * The global dimensions.
+   */
+  numeric_index_type _m, _n;
+
+  /**
+   * The ranges of local rows, and of the columns corresponding to
+   * the local entries of vectors.
+   */
+  numeric_index_type _first_row, _last_row, _first_col, _last_col;
+
+  /**
+   * The end of the range of rows of every processor.
+   */
+  std::vector<numeric_index_type> _row_ends;
+
+  /**
+   * The start of each local row in \p _columns and \p _values, with
+   * a final entry for the end of the last row.
+   */
+  std::vector<numeric_index_type> _row_offsets;
+
+  /**
+   * The sorted global column indices of each local row.
+   */
+  std::vector<numeric_index_type> _columns;
+
+  /**
+   * The entries of the local rows.
+   */
+  std::vector<T> _values;
+
+  /**
+   * Entries of local rows which are not yet in the compressed rows.
+   */
+  std::map<std::pair<numeric_index_type, numeric_index_type>, T> _new_entries;
+
+  /**
+   * Entries added to and set in rows owned by other processors,
+   * waiting for \p close() to send them.
+   */
+  std::map<processor_id_type, std::vector<std::pair<numeric_index_type, numeric_index_type>>>
+    _added_indices, _set_indices;
+  std::map<processor_id_type, std::vector<T>> _added_values, _set_values;
+
+  /**
+   * The sorted global indices of the columns outside the local range
+   * which local rows refer to.
+   */
+  std::vector<numeric_index_type> _ghost_columns;
+
+  /**
+   * The column of each entry, numbered with the local columns first
+   * and then the ghost columns in order.
+   */
+  std::vector<numeric_index_type> _product_columns;
+
+  /**
+   * Flag indicating if the matrix has been closed yet.
+   */
+  bool _closed;
+
+  /**
+   * Make other native datatypes friends
+   */
+  friend class DistributedVector<T>;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
@@ -37,11 +37,20 @@
 namespace libMesh
 {
 
+// Forward declarations
+template <typename T> class DistributedSparseMatrix;
+
 /**
  * This class provides a simple parallel, distributed vector datatype
  * which is specific to libmesh. Offers some collective communication
  * capabilities.
  *
+ * A \p GHOSTED vector stores copies of the ghost entries it was
+ * initialized with next to its local entries.  The copies are read
+ * by operator(); they are refreshed from their owners by close() and
+ * by localizing a vector into this one with a send list.  Only local
+ * entries may be set or added to.
+ *
  * \note The class will sill function without MPI, but only on one
  * processor. All overridden virtual functions are documented in
  * numeric_vector.h.
@@ -175,8 +184,17 @@ public:
 
   virtual void conjugate() override;
 
+  /**
+   * Sets local entry \p i; ghost entries are refreshed by close().
+   */
   virtual void set (const numeric_index_type i, const T value) override;
 
+  /**
+   * Each entry is stored separately, so adding to distinct
+   * entries from different threads is safe.
+   */
+  virtual bool supports_concurrent_add() const override { return true; }
+
   virtual void add (const numeric_index_type i, const T value) override;
 
   virtual void add (const T s) override;
@@ -185,15 +203,27 @@ public:
 
   virtual void add (const T a, const NumericVector<T> & v) override;
 
+  virtual void axpbypcz (const T alpha,
+                         const T beta,
+                         const T gamma,
+                         const NumericVector<T> & x,
+                         const NumericVector<T> & y) override;
+
+  virtual void add (const std::vector<T> & a,
+                    const std::vector<const NumericVector<T> *> & v) override;
+
   /**
    * We override one NumericVector<T>::add_vector() method but don't
    * want to hide the other defaults.
    */
   using NumericVector<T>::add_vector;
 
-  virtual void add_vector (const NumericVector<T> &,
-                           const SparseMatrix<T> &) override
-  { libmesh_not_implemented(); }
+  /**
+   * Computes \f$ \vec{u} \leftarrow \vec{u} + A \vec{v} \f$; \p A
+   * must be a \p DistributedSparseMatrix.
+   */
+  virtual void add_vector (const NumericVector<T> & v,
+                           const SparseMatrix<T> & A) override;
 
   virtual void add_vector_transpose (const NumericVector<T> &,
                                      const SparseMatrix<T> &) override
@@ -205,6 +235,11 @@ public:
 
   virtual T dot(const NumericVector<T> & V) const override;
 
+  virtual void dot (const std::vector<const NumericVector<T> *> & v,
+                    std::vector<T> & results) const override;
+
+  virtual std::pair<T, Real> dot_and_l2_norm (const NumericVector<T> & V) const override;
+
   virtual void localize (std::vector<T> & v_local) const override;
 
   virtual void localize (NumericVector<T> & v_local) const override;
@@ -253,6 +288,22 @@ private:
    * The last component (+1) stored locally.
    */
   numeric_index_type _last_local_index;
+
+  /**
+   * The sorted global indices of the ghost entries of a \p GHOSTED
+   * vector.
+   */
+  std::vector<numeric_index_type> _ghost_indices;
+
+  /**
+   * Our copies of the ghost entries, in the order of \p _ghost_indices.
+   */
+  std::vector<T> _ghost_values;
+
+  /**
+   * Make other native datatypes friends
+   */
+  friend class DistributedSparseMatrix<T>;
 };
 
 
@@ -350,29 +401,34 @@ void DistributedVector<T>::init (const numeric_index_type n,
 
 #ifdef LIBMESH_HAVE_MPI
 
-  std::vector<numeric_index_type> local_sizes (this->n_processors(), 0);
+  // A serial vector holds every entry on every processor, so only
+  // a parallel vector needs to find its place
+  if (this->_type == PARALLEL)
+    {
+      std::vector<numeric_index_type> local_sizes (this->n_processors(), 0);
 
-  local_sizes[this->processor_id()] = n_local;
+      local_sizes[this->processor_id()] = n_local;
 
-  this->comm().sum(local_sizes);
+      this->comm().sum(local_sizes);
 
-  // _first_local_index is the sum of _local_size
-  // for all processor ids less than ours
-  for (auto p : make_range(this->processor_id()))
-    _first_local_index += local_sizes[p];
+      // _first_local_index is the sum of _local_size
+      // for all processor ids less than ours
+      for (auto p : make_range(this->processor_id()))
+        _first_local_index += local_sizes[p];
 
 
 #  ifdef DEBUG
-  // Make sure all the local sizes sum up to the global
-  // size, otherwise there is big trouble!
-  numeric_index_type dbg_sum=0;
+      // Make sure all the local sizes sum up to the global
+      // size, otherwise there is big trouble!
+      numeric_index_type dbg_sum=0;
 
-  for (auto p : make_range(this->n_processors()))
-    dbg_sum += local_sizes[p];
+      for (auto p : make_range(this->n_processors()))
+        dbg_sum += local_sizes[p];
 
-  libmesh_assert_equal_to (dbg_sum, n);
+      libmesh_assert_equal_to (dbg_sum, n);
 
 #  endif
+    }
 
 #else
 
@@ -397,23 +453,51 @@ template <typename T>
 inline
 void DistributedVector<T>::init (const numeric_index_type n,
                                  const numeric_index_type n_local,
-                                 const std::vector<numeric_index_type> & /*ghost*/,
+                                 const std::vector<numeric_index_type> & ghost,
                                  const bool fast,
                                  const ParallelType ptype)
 {
-  // TODO: we shouldn't ignore the ghost sparsity pattern
-  this->init(n, n_local, fast, ptype);
+  if (ptype != GHOSTED)
+    {
+      this->init(n, n_local, fast, ptype);
+      return;
+    }
+
+  this->init(n, n_local, fast, PARALLEL);
+  this->_type = GHOSTED;
+
+  // Send lists are usually sorted already, but lookups in
+  // operator() depend on it
+  _ghost_indices = ghost;
+  std::sort(_ghost_indices.begin(), _ghost_indices.end());
+  _ghost_indices.erase(std::unique(_ghost_indices.begin(), _ghost_indices.end()),
+                       _ghost_indices.end());
+
+#ifndef NDEBUG
+  for (auto i : _ghost_indices)
+    {
+      libmesh_assert_less (i, n);
+      libmesh_assert (i < _first_local_index || i >= _last_local_index);
+    }
+#endif
+
+  _ghost_values.assign(_ghost_indices.size(), 0);
 }
 
 
 
-/* Default implementation for solver packages for which ghosted
-   vectors are not yet implemented.  */
 template <class T>
 void DistributedVector<T>::init (const NumericVector<T> & other,
                                  const bool fast)
 {
-  this->init(other.size(),other.local_size(),fast,other.type());
+  const DistributedVector<T> * v =
+    dynamic_cast<const DistributedVector<T> *>(&other);
+
+  if (v && other.type() == GHOSTED)
+    this->init(other.size(), other.local_size(), v->_ghost_indices,
+               fast, GHOSTED);
+  else
+    this->init(other.size(), other.local_size(), fast, other.type());
 }
 
 
@@ -435,6 +519,10 @@ void DistributedVector<T>::close ()
 {
   libmesh_assert (this->initialized());
 
+  // Ghost copies are refreshed from their owners
+  if (this->type() == GHOSTED)
+    this->localize(_ghost_values, _ghost_indices);
+
   this->_is_closed = true;
 }
 
@@ -445,6 +533,8 @@ inline
 void DistributedVector<T>::clear ()
 {
   _values.clear();
+  _ghost_indices.clear();
+  _ghost_values.clear();
 
   _global_size =
     _local_size =
@@ -468,6 +558,9 @@ void DistributedVector<T>::zero ()
   std::fill (_values.begin(),
              _values.end(),
              0.);
+  std::fill (_ghost_values.begin(),
+             _ghost_values.end(),
+             0.);
 }
 
 
@@ -554,10 +647,16 @@ T DistributedVector<T>::operator() (const numeric_index_type i) const
   libmesh_assert (this->initialized());
   libmesh_assert_equal_to (_values.size(), _local_size);
   libmesh_assert_equal_to ((_last_local_index - _first_local_index), _local_size);
-  libmesh_assert ( ((i >= first_local_index()) &&
-                    (i <  last_local_index())) );
 
-  return _values[i - _first_local_index];
+  if (i >= _first_local_index && i < _last_local_index)
+    return _values[i - _first_local_index];
+
+  libmesh_assert_equal_to (this->type(), GHOSTED);
+  const auto it = std::lower_bound(_ghost_indices.begin(),
+                                   _ghost_indices.end(), i);
+  libmesh_assert (it != _ghost_indices.end() && *it == i);
+
+  return _ghost_values[std::distance(_ghost_indices.begin(), it)];
 }
 
 
@@ -648,6 +747,8 @@ void DistributedVector<T>::swap (NumericVector<T> & other)
 
   // This should be O(1) with any reasonable STL implementation
   std::swap(_values, v._values);
+  std::swap(_ghost_indices, v._ghost_indices);
+  std::swap(_ghost_values, v._ghost_values);
 }
 
 } // namespace libMesh
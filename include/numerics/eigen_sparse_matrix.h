@@ -33,6 +33,7 @@
 // C++ includes
 #include <algorithm>
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -101,7 +102,11 @@ public:
 
   virtual std::unique_ptr<SparseMatrix<T>> clone () const override;
 
-  virtual void close () override { this->_closed = true; }
+  /**
+   * Builds the matrix from any entries added since it was
+   * initialized; see \p add().
+   */
+  virtual void close () override;
 
   virtual numeric_index_type m () const override;
 
@@ -115,6 +120,13 @@ public:
                     const numeric_index_type j,
                     const T value) override;
 
+  /**
+   * Until the matrix has any structure, which it first gets when it
+   * is closed, added entries are only collected, and \p close()
+   * builds the matrix from them in one pass.  After that, entries are
+   * added in place, and the structure is kept by \p zero().  In
+   * either case the matrix can't be read before it is closed.
+   */
   virtual void add (const numeric_index_type i,
                     const numeric_index_type j,
                     const T value) override;
@@ -143,6 +155,10 @@ public:
 
   virtual void get_transpose (SparseMatrix<T> & dest) const override;
 
+  virtual void get_row(numeric_index_type i,
+                       std::vector<numeric_index_type> & indices,
+                       std::vector<T> & values) const override;
+
 private:
 
   /**
@@ -150,11 +166,28 @@ private:
    */
   DataType _mat;
 
+  /**
+   * Entries added before the matrix had any structure, waiting for
+   * \p close().
+   */
+  std::vector<TripletType> _triplets;
+
   /**
    * Flag indicating if the matrix has been closed yet.
    */
   bool _closed;
 
+  /**
+   * \returns \p true if added entries still go to \p _triplets.
+   */
+  bool collecting_triplets () const
+  { return _mat.nonZeros() == 0; }
+
+  /**
+   * Adds any collected entries to \p _mat.
+   */
+  void assemble_triplets ();
+
   /**
    * Make other Eigen datatypes friends
    */
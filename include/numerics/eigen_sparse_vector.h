@@ -186,6 +186,19 @@ public:
 
   virtual void add (const T a, const NumericVector<T> & v) override;
 
+  virtual void axpbypcz (const T alpha,
+                         const T beta,
+                         const T gamma,
+                         const NumericVector<T> & x,
+                         const NumericVector<T> & y) override;
+
+  /**
+   * The serial multi-vector NumericVector<T>::add() and dot()
+   * defaults lose nothing here; don't hide them.
+   */
+  using NumericVector<T>::add;
+  using NumericVector<T>::dot;
+
   /**
    * We override one NumericVector<T>::add_vector() method but don't
    * want to hide the other defaults.
@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -125,6 +126,35 @@ public:
                            unsigned int i,
                            const Point & p,
                            Real time=0.);
+
+  /**
+   * Evaluation function for scalar functions at many points, e.g.
+   * all the quadrature points of the current element; sets \p
+   * output[i] to the function value at \p points[i] and time \p
+   * time, resizing \p output to match.
+   *
+   * \note Subclasses aren't required to override this, since the
+   * default implementation evaluates each point separately.
+   */
+  virtual void evaluate (const FEMContext &,
+                         const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<Output> & output);
+
+  /**
+   * Evaluation function for vector-valued functions at many points;
+   * sets \p output[i] to the function value at \p points[i] and time
+   * \p time.  As with the single point evaluation, \p output should
+   * already hold one DenseVector per point, each sized to the number
+   * of components wanted.
+   *
+   * \note Subclasses aren't required to override this, since the
+   * default implementation evaluates each point separately.
+   */
+  virtual void evaluate (const FEMContext &,
+                         const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<DenseVector<Output>> & output);
 };
 
 template <typename Output>
@@ -149,6 +179,30 @@ void FEMFunctionBase<Output>::operator() (const FEMContext & context,
   this->operator()(context, p, 0., output);
 }
 
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::evaluate (const FEMContext & context,
+                                        const std::vector<Point> & points,
+                                        const Real time,
+                                        std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t i = 0; i != points.size(); ++i)
+    output[i] = (*this)(context, points[i], time);
+}
+
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::evaluate (const FEMContext & context,
+                                        const std::vector<Point> & points,
+                                        const Real time,
+                                        std::vector<DenseVector<Output>> & output)
+{
+  libmesh_assert_equal_to (output.size(), points.size());
+  for (std::size_t i = 0; i != points.size(); ++i)
+    (*this)(context, points[i], time, output[i]);
+}
+
 } // namespace libMesh
 
 #endif // LIBMESH_FEM_FUNCTION_BASE_H
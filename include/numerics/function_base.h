@@ -27,6 +27,7 @@
 // C++ includes
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -141,6 +142,36 @@ public:
                            const Point & p,
                            Real time=0.);
 
+  /**
+   * Evaluation function for scalar functions at many points; sets
+   * \p output[i] to the function value at \p points[i] and time \p
+   * time, resizing \p output to match.
+   *
+   * \note Subclasses aren't required to override this, since the
+   * default implementation evaluates each point separately.
+   *
+   * \note Subclasses are recommended to override this when they can
+   * hoist per-call setup and virtual dispatch out of the loop over
+   * points.
+   */
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<Output> & output);
+
+  /**
+   * Evaluation function for vector-valued functions at many points;
+   * sets \p output[i] to the function value at \p points[i] and time
+   * \p time.  As with the single point evaluation, \p output should
+   * already hold one DenseVector per point, each sized to the number
+   * of components wanted.
+   *
+   * \note Subclasses aren't required to override this, since the
+   * default implementation evaluates each point separately.
+   */
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<DenseVector<Output>> & output);
+
 
   /**
    * \returns \p true when this object is properly initialized
@@ -244,6 +275,32 @@ void FunctionBase<Output>::operator() (const Point & p,
   this->operator()(p, 0., output);
 }
 
+
+
+template <typename Output>
+inline
+void FunctionBase<Output>::evaluate (const std::vector<Point> & points,
+                                     const Real time,
+                                     std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t i = 0; i != points.size(); ++i)
+    output[i] = (*this)(points[i], time);
+}
+
+
+
+template <typename Output>
+inline
+void FunctionBase<Output>::evaluate (const std::vector<Point> & points,
+                                     const Real time,
+                                     std::vector<DenseVector<Output>> & output)
+{
+  libmesh_assert_equal_to (output.size(), points.size());
+  for (std::size_t i = 0; i != points.size(); ++i)
+    (*this)(points[i], time, output[i]);
+}
+
 } // namespace libMesh
 
 #endif // LIBMESH_FUNCTION_BASE_H
@@ -86,6 +86,13 @@ public:
   virtual bool need_full_sparsity_pattern() const override
   { return true; }
 
+  /**
+   * Adding to distinct entries of a \p LaspackMatrix touches
+   * distinct, already allocated values.
+   */
+  virtual bool supports_concurrent_add() const override
+  { return true; }
+
   /**
    * Updates the matrix sparsity pattern.  This will tell the
    * underlying matrix storage scheme how to map the \f$ (i,j) \f$
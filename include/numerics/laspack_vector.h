@@ -179,6 +179,15 @@ public:
 
   virtual void set (const numeric_index_type i, const T value) override;
 
+  /**
+   * Each entry is stored separately, so adding to distinct
+   * entries from different threads is safe.  Hence setting or adding
+   * to a single entry leaves the \p closed() flag alone, as it does
+   * for a \p DistributedVector; only operations on the whole vector
+   * clear it.
+   */
+  virtual bool supports_concurrent_add() const override { return true; }
+
   virtual void add (const numeric_index_type i, const T value) override;
 
   virtual void add (const T s) override;
@@ -187,6 +196,13 @@ public:
 
   virtual void add (const T a, const NumericVector<T> & v) override;
 
+  /**
+   * The fused multi-vector NumericVector<T>::add() and dot() defaults
+   * are used as-is; don't hide them.
+   */
+  using NumericVector<T>::add;
+  using NumericVector<T>::dot;
+
   /**
    * We override one NumericVector<T>::add_vector() method but don't
    * want to hide the other defaults.
@@ -499,10 +515,6 @@ void LaspackVector<T>::set (const numeric_index_type i, const T value)
   libmesh_assert_less (i, this->size());
 
   V_SetCmp (&_vec, i+1, value);
-
-#ifndef NDEBUG
-  this->_is_closed = false;
-#endif
 }
 
 
@@ -515,10 +527,6 @@ void LaspackVector<T>::add (const numeric_index_type i, const T value)
   libmesh_assert_less (i, this->size());
 
   V_AddCmp (&_vec, i+1, value);
-
-#ifndef NDEBUG
-  this->_is_closed = false;
-#endif
 }
 
 
@@ -45,6 +45,7 @@ enum SolverPackage : int;
 #include <set>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace libMesh
 {
@@ -170,6 +171,24 @@ public:
    */
   virtual bool closed() const { return _is_closed; }
 
+  /**
+   * \returns \p true if \p add() and \p add_vector() may be called
+   * from several threads at once, as long as no two threads add to
+   * the same entry.  Otherwise callers must serialize their
+   * insertions.
+   */
+  virtual bool supports_concurrent_add() const { return false; }
+
+  /**
+   * Tells the vector whether to collect values set or added at
+   * indices owned by other processors in buffers of its own, to be
+   * sent to their owners all at once by \p close(), rather than
+   * leaving them to the underlying library.  When your \p
+   * NumericVector<T> implementation has nothing to gain from this,
+   * simply do not override this method.
+   */
+  virtual void buffer_off_processor_entries (bool) {}
+
   /**
    * Calls the NumericVector's internal assembly routines, ensuring
    * that the values are consistent across processors.
@@ -463,6 +482,26 @@ public:
    */
   virtual void add (const T a, const NumericVector<T> & v) = 0;
 
+  /**
+   * Fused vector addition,
+   * \f$ \vec{u} \leftarrow \alpha\vec{x} + \beta\vec{y} + \gamma\vec{u} \f$,
+   * which reads each vector only once.  This should be overridden in
+   * subclasses for efficiency.
+   */
+  virtual void axpbypcz (const T alpha,
+                         const T beta,
+                         const T gamma,
+                         const NumericVector<T> & x,
+                         const NumericVector<T> & y);
+
+  /**
+   * Fused vector addition of several scalar multiples,
+   * \f$ \vec{u} \leftarrow \vec{u} + \sum_i a_i\vec{v}_i \f$.
+   * This should be overridden in subclasses for efficiency.
+   */
+  virtual void add (const std::vector<T> & a,
+                    const std::vector<const NumericVector<T> *> & v);
+
   /**
    * Computes \f$ \vec{u} \leftarrow \vec{u} + \vec{v} \f$,
    * where \p v is a pointer and each \p dof_indices[i] specifies where
@@ -568,6 +607,23 @@ public:
    */
   virtual T dot(const NumericVector<T> & v) const = 0;
 
+  /**
+   * Computes the dot products of (*this) with each of the vectors
+   * \p v, as \p dot() would, into \p results.  This should be
+   * overridden in subclasses to read (*this) once and to need just
+   * one parallel reduction for all of them.
+   */
+  virtual void dot (const std::vector<const NumericVector<T> *> & v,
+                    std::vector<T> & results) const;
+
+  /**
+   * \returns The dot product of (*this) with \p v, as \p dot()
+   * would give, and the \p l2_norm() of (*this).  This should be
+   * overridden in subclasses to need just one parallel reduction for
+   * both.
+   */
+  virtual std::pair<T, Real> dot_and_l2_norm (const NumericVector<T> & v) const;
+
   /**
    * Creates a copy of the global vector in the local vector \p
    * v_local.
@@ -587,6 +643,24 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const = 0;
 
+  /**
+   * Starts the same update of \p v_local as \p localize(v_local,
+   * send_list) does, but may return before the communication is
+   * complete.  Neither vector may be used until \p end_localize() has
+   * been called with the same \p v_local, but other work can be
+   * done in between.
+   *
+   * The default implementation does all the work here, in \p localize().
+   */
+  virtual void begin_localize (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const;
+
+  /**
+   * Waits for the update of \p v_local started by \p begin_localize()
+   * to complete.
+   */
+  virtual void end_localize (NumericVector<T> & v_local) const;
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".
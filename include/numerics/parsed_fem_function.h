@@ -31,7 +31,7 @@
 
 #ifdef LIBMESH_HAVE_FPARSER
 // FParser includes
-#include "libmesh/fparser.hh"
+#include "libmesh/fparser_ad.hh"
 #endif
 
 // C++ includes
@@ -111,6 +111,21 @@ public:
 
   const std::string & expression() { return _expression; }
 
+  /**
+   * Turns just-in-time compilation of the parsed expression on or
+   * off, as in ParsedFunction::set_jit().  Clones of this function
+   * inherit the setting.
+   *
+   * \returns \p true if every subexpression is now compiled.
+   */
+  bool set_jit (bool jit = true);
+
+  /**
+   * \returns \p true if JIT compilation was requested by set_jit()
+   * and succeeded for every subexpression.
+   */
+  bool jit_compiled () const { return _jit_compiled; }
+
   /**
    * \returns The value of an inline variable.
    *
@@ -149,7 +164,7 @@ protected:
 
   // Evaluate the ith FunctionParser and check the result
 #ifdef LIBMESH_HAVE_FPARSER
-  inline Output eval(FunctionParserBase<Output> & parser,
+  inline Output eval(FunctionParserADBase<Output> & parser,
                      const std::string & libmesh_dbg_var(function_name),
                      unsigned int libmesh_dbg_var(component_idx)) const;
 #else // LIBMESH_HAVE_FPARSER
@@ -168,7 +183,7 @@ private:
     _n_requested_hess_components;
   bool _requested_normals;
 #ifdef LIBMESH_HAVE_FPARSER
-  std::vector<FunctionParserBase<Output>> parsers;
+  std::vector<FunctionParserADBase<Output>> parsers;
 #else
   std::vector<char> parsers;
 #endif
@@ -192,6 +207,10 @@ private:
   std::string variables;
   std::vector<std::string> _additional_vars;
   std::vector<Output> _initial_vals;
+
+  // Whether JIT compilation is requested, and whether it succeeded
+  bool _jit;
+  bool _jit_compiled;
 };
 
 
@@ -216,7 +235,9 @@ ParsedFEMFunction<Output>::ParsedFEMFunction (const System & sys,
   _need_var_hess(_n_vars*LIBMESH_DIM*LIBMESH_DIM, false),
 #endif // LIBMESH_ENABLE_SECOND_DERIVATIVES
   _additional_vars (additional_vars ? *additional_vars : std::vector<std::string>()),
-  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>())
+  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>()),
+  _jit (false),
+  _jit_compiled (false)
 {
   this->reparse(expression);
 }
@@ -388,8 +409,38 @@ inline
 std::unique_ptr<FEMFunctionBase<Output>>
 ParsedFEMFunction<Output>::clone () const
 {
-  return libmesh_make_unique<ParsedFEMFunction>
+  auto returnval = libmesh_make_unique<ParsedFEMFunction>
     (_sys, _expression, &_additional_vars, &_initial_vals);
+
+  // Compiled kernels are cached, so this is cheap after the first time
+  if (_jit)
+    returnval->set_jit();
+
+  return std::unique_ptr<FEMFunctionBase<Output>>(returnval.release());
+}
+
+template <typename Output>
+inline
+bool
+ParsedFEMFunction<Output>::set_jit (bool jit)
+{
+  const bool was_jit = _jit;
+  _jit = jit;
+
+  // Fresh parsers are the only way to drop compiled kernels
+  if (was_jit && !jit)
+    this->partial_reparse(_expression);
+#ifdef LIBMESH_HAVE_FPARSER
+  else if (jit)
+    {
+      // An already compiled parser just reloads its kernel
+      _jit_compiled = true;
+      for (auto & parser : parsers)
+        _jit_compiled = parser.JITCompile() && _jit_compiled;
+    }
+#endif
+
+  return _jit_compiled;
 }
 
 template <typename Output>
@@ -479,7 +530,7 @@ ParsedFEMFunction<Output>::get_inline_value(const std::string & inline_var_name)
 #ifdef LIBMESH_HAVE_FPARSER
       // Parse and evaluate the new subexpression.
       // Add the same constants as we used originally.
-      FunctionParserBase<Output> fp;
+      FunctionParserADBase<Output> fp;
       fp.AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
       fp.AddConstant("pi", std::acos(Real(-1)));
       fp.AddConstant("e", std::exp(Real(1)));
@@ -586,6 +637,7 @@ ParsedFEMFunction<Output>::partial_reparse (const std::string & expression)
   _expression = expression;
   _subexpressions.clear();
   parsers.clear();
+  _jit_compiled = _jit;
 
   size_t nextstart = 0, end = 0;
 
@@ -621,7 +673,7 @@ ParsedFEMFunction<Output>::partial_reparse (const std::string & expression)
 #ifdef LIBMESH_HAVE_FPARSER
       // Parse (and optimize if possible) the subexpression.
       // Add some basic constants, to Real precision.
-      FunctionParserBase<Output> fp;
+      FunctionParserADBase<Output> fp;
       fp.AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
       fp.AddConstant("pi", std::acos(Real(-1)));
       fp.AddConstant("e", std::exp(Real(1)));
@@ -631,6 +683,9 @@ ParsedFEMFunction<Output>::partial_reparse (const std::string & expression)
            << _subexpressions.back() << '\n' << fp.ErrorMsg());
       fp.Optimize();
       parsers.push_back(fp);
+
+      if (_jit)
+        _jit_compiled = parsers.back().JITCompile() && _jit_compiled;
 #else
       libmesh_error_msg("ERROR: This functionality requires fparser!");
 #endif
@@ -800,7 +855,7 @@ ParsedFEMFunction<Output>::eval_args (const FEMContext & c,
 template <typename Output>
 inline
 Output
-ParsedFEMFunction<Output>::eval (FunctionParserBase<Output> & parser,
+ParsedFEMFunction<Output>::eval (FunctionParserADBase<Output> & parser,
                                  const std::string & libmesh_dbg_var(function_name),
                                  unsigned int libmesh_dbg_var(component_idx)) const
 {
@@ -118,8 +118,73 @@ public:
                             const Point & p,
                             Real time) override;
 
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<Output> & output) override;
+
+  virtual void evaluate (const std::vector<Point> & points,
+                         const Real time,
+                         std::vector<DenseVector<Output>> & output) override;
+
   const std::string & expression() { return _expression; }
 
+  /**
+   * \returns The number of arguments each parsed expression takes:
+   * the spatial coordinates, time, and any additional variables.
+   * This is the size of the scratch space reentrant_value() needs.
+   */
+  std::size_t n_args () const { return _spacetime.size(); }
+
+  /**
+   * Reentrant evaluation of vector component \p i at coordinate \p p
+   * and time \p time.  Rather than in the argument buffer shared by
+   * the other evaluation functions, the arguments are assembled in
+   * \p args, caller-owned scratch space for n_args() values (e.g. a
+   * local array), so one ParsedFunction may be evaluated by several
+   * threads at once, without cloning it and without allocating.
+   * Additional variables take the values they have when called.
+   *
+   * \note FunctionParser evaluation errors are flagged in data shared
+   * by every thread, so they are not checked here.
+   */
+  Output reentrant_value (const Point & p,
+                          const Real time,
+                          Output * args,
+                          unsigned int i = 0);
+
+  /**
+   * Reentrant evaluation of every vector component, as in
+   * reentrant_value(), setting output values in the passed-in \p
+   * output DenseVector.
+   */
+  void reentrant_value (const Point & p,
+                        const Real time,
+                        Output * args,
+                        DenseVector<Output> & output);
+
+  /**
+   * Turns just-in-time compilation of the parsed expression on or
+   * off.  When on, each subexpression is compiled to native code
+   * (or, if the same expression has been compiled before, loaded
+   * from fparser's on-disk cache in ./.jitcache, keyed by a hash of
+   * its bytecode) and then evaluated at native speed, which is
+   * intended for functions evaluated many times within assembly
+   * loops.  Clones of this function inherit the setting.
+   *
+   * Derivative expressions are still interpreted.  Expressions which
+   * cannot be compiled, e.g. for complex-valued functions or when
+   * fparser was built without JIT support, remain interpreted too.
+   *
+   * \returns \p true if every subexpression is now compiled.
+   */
+  bool set_jit (bool jit = true);
+
+  /**
+   * \returns \p true if JIT compilation was requested by set_jit()
+   * and succeeded for every subexpression.
+   */
+  bool jit_compiled () const { return _jit_compiled; }
+
   /**
    * \returns The address of a parsed variable so you can supply a parameterized value.
    */
@@ -174,6 +239,19 @@ private:
   void set_spacetime(const Point & p,
                      const Real time = 0);
 
+  /**
+   * Set just the spatial part of the _spacetime argument vector.
+   */
+  void set_point(const Point & p);
+
+  /**
+   * Fill \p args, scratch space for n_args() values, as
+   * set_spacetime() would fill _spacetime.
+   */
+  void fill_args(const Point & p,
+                 const Real time,
+                 Output * args) const;
+
   /**
    * Evaluate the ith FunctionParser and check the result.
    */
@@ -201,6 +279,10 @@ private:
   std::string variables;
   std::vector<std::string> _additional_vars;
   std::vector<Output> _initial_vals;
+
+  // Whether JIT compilation is requested, and whether it succeeded
+  bool _jit;
+  bool _jit_compiled;
 };
 
 
@@ -217,7 +299,9 @@ ParsedFunction<Output,OutputGradient>::ParsedFunction (const std::string & expre
   _spacetime (LIBMESH_DIM+1 + (additional_vars ? additional_vars->size() : 0)),
   _valid_derivatives (true),
   _additional_vars (additional_vars ? *additional_vars : std::vector<std::string>()),
-  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>())
+  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>()),
+  _jit (false),
+  _jit_compiled (false)
 {
   // time-dependence established in reparse function
   this->reparse(expression);
@@ -333,6 +417,78 @@ ParsedFunction<Output,OutputGradient>::component (unsigned int i,
   return eval(parsers[i], "f", i);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::evaluate
+  (const std::vector<Point> & points,
+   const Real time,
+   std::vector<Output> & output)
+{
+  output.resize(points.size());
+
+  // Only the point changes within the loop
+  _spacetime[LIBMESH_DIM] = time;
+  for (auto p : index_range(points))
+    {
+      set_point(points[p]);
+      output[p] = eval(parsers[0], "f", 0);
+    }
+}
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::evaluate
+  (const std::vector<Point> & points,
+   const Real time,
+   std::vector<DenseVector<Output>> & output)
+{
+  libmesh_assert_equal_to (output.size(), points.size());
+
+  _spacetime[LIBMESH_DIM] = time;
+  for (auto p : index_range(points))
+    {
+      set_point(points[p]);
+
+      DenseVector<Output> & point_output = output[p];
+      const unsigned int size = point_output.size();
+      libmesh_assert_equal_to (size, parsers.size());
+
+      for (unsigned int i=0; i != size; ++i)
+        point_output(i) = eval(parsers[i], "f", i);
+    }
+}
+
+template <typename Output, typename OutputGradient>
+inline
+Output
+ParsedFunction<Output,OutputGradient>::reentrant_value (const Point & p,
+                                                        const Real time,
+                                                        Output * args,
+                                                        unsigned int i)
+{
+  libmesh_assert_less (i, parsers.size());
+  fill_args(p, time, args);
+  return parsers[i].Eval(args);
+}
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::reentrant_value (const Point & p,
+                                                        const Real time,
+                                                        Output * args,
+                                                        DenseVector<Output> & output)
+{
+  const unsigned int size = output.size();
+  libmesh_assert_equal_to (size, parsers.size());
+
+  fill_args(p, time, args);
+  for (unsigned int i=0; i != size; ++i)
+    output(i) = parsers[i].Eval(args);
+}
+
 /**
  * \returns The address of a parsed variable so you can supply a parameterized value
  */
@@ -357,9 +513,37 @@ inline
 std::unique_ptr<FunctionBase<Output>>
 ParsedFunction<Output,OutputGradient>::clone() const
 {
-  return libmesh_make_unique<ParsedFunction>(_expression,
-                                             &_additional_vars,
-                                             &_initial_vals);
+  auto returnval = libmesh_make_unique<ParsedFunction>(_expression,
+                                                       &_additional_vars,
+                                                       &_initial_vals);
+
+  // Compiled kernels are cached, so this is cheap after the first time
+  if (_jit)
+    returnval->set_jit();
+
+  return std::unique_ptr<FunctionBase<Output>>(returnval.release());
+}
+
+template <typename Output, typename OutputGradient>
+inline
+bool
+ParsedFunction<Output,OutputGradient>::set_jit (bool jit)
+{
+  const bool was_jit = _jit;
+  _jit = jit;
+
+  // Fresh parsers are the only way to drop compiled kernels
+  if (was_jit && !jit)
+    this->partial_reparse(_expression);
+  else if (jit)
+    {
+      // An already compiled parser just reloads its kernel
+      _jit_compiled = true;
+      for (auto & parser : parsers)
+        _jit_compiled = parser.JITCompile() && _jit_compiled;
+    }
+
+  return _jit_compiled;
 }
 
 template <typename Output, typename OutputGradient>
@@ -508,6 +692,15 @@ ParsedFunction<Output,OutputGradient>::partial_reparse (const std::string & expr
   _expression = expression;
   _subexpressions.clear();
   parsers.clear();
+  dx_parsers.clear();
+#if LIBMESH_DIM > 1
+  dy_parsers.clear();
+#endif
+#if LIBMESH_DIM > 2
+  dz_parsers.clear();
+#endif
+  dt_parsers.clear();
+  _jit_compiled = _jit;
 
   size_t nextstart = 0, end = 0;
 
@@ -582,6 +775,11 @@ ParsedFunction<Output,OutputGradient>::partial_reparse (const std::string & expr
         _valid_derivatives = false;
       dt_parsers.push_back(dt_fp);
 
+      // Compile only now, since copies for differentiation would
+      // otherwise keep the compiled kernel of the original
+      if (_jit)
+        _jit_compiled = parsers.back().JITCompile() && _jit_compiled;
+
       // If at end, use nextstart=maxSize.  Else start at next
       // character.
       nextstart = (end == std::string::npos) ?
@@ -633,6 +831,39 @@ inline
 void
 ParsedFunction<Output,OutputGradient>::set_spacetime (const Point & p,
                                                       const Real time)
+{
+  set_point(p);
+  _spacetime[LIBMESH_DIM] = time;
+
+  // The remaining locations in _spacetime are currently fixed at construction
+  // but could potentially be made dynamic
+}
+
+// Fill caller-owned arguments as set_spacetime() fills _spacetime
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::fill_args (const Point & p,
+                                                  const Real time,
+                                                  Output * args) const
+{
+  args[0] = p(0);
+#if LIBMESH_DIM > 1
+  args[1] = p(1);
+#endif
+#if LIBMESH_DIM > 2
+  args[2] = p(2);
+#endif
+  args[LIBMESH_DIM] = time;
+  std::copy(_spacetime.begin() + LIBMESH_DIM + 1, _spacetime.end(),
+            args + LIBMESH_DIM + 1);
+}
+
+// Set the spatial part of the _spacetime argument vector
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::set_point (const Point & p)
 {
   _spacetime[0] = p(0);
 #if LIBMESH_DIM > 1
@@ -641,10 +872,6 @@ ParsedFunction<Output,OutputGradient>::set_spacetime (const Point & p,
 #if LIBMESH_DIM > 2
   _spacetime[2] = p(2);
 #endif
-  _spacetime[LIBMESH_DIM] = time;
-
-  // The remaining locations in _spacetime are currently fixed at construction
-  // but could potentially be made dynamic
 }
 
 // Evaluate the ith FunctionParser and check the result
@@ -743,6 +970,13 @@ public:
   virtual void init() {}
   virtual void clear() {}
   virtual Output & getVarAddress(const std::string & /*variable_name*/) { return _dummy; }
+  bool set_jit (bool = true) { return false; }
+  bool jit_compiled () const { return false; }
+  std::size_t n_args () const { return 0; }
+  Output reentrant_value (const Point &, const Real, Output *,
+                          unsigned int = 0) { return 0.; }
+  void reentrant_value (const Point &, const Real, Output *,
+                        DenseVector<Output> &) {}
   virtual std::unique_ptr<FunctionBase<Output>> clone() const
   {
     return libmesh_make_unique<ParsedFunction<Output>>("");
@@ -30,6 +30,9 @@
 
 // C++ includes
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
 #ifdef LIBMESH_HAVE_CXX11_THREAD
 #include <atomic>
 #include <mutex>
@@ -69,9 +72,18 @@ namespace libMesh
 // Forward Declarations
 template <typename T> class DenseMatrix;
 
+/**
+ * The PETSc storage formats a PetscMatrix can use.  BAIJ stores
+ * dense blocks of the DofMap::block_size() coupled dofs of each node,
+ * and SBAIJ stores only the upper triangle of those blocks, for
+ * symmetric matrices.  They can also be chosen with the
+ * --use-petsc-baij and --use-petsc-sbaij command line options.
+ */
 enum PetscMatrixType : int {
                  AIJ=0,
-                 HYPRE};
+                 HYPRE,
+                 BAIJ,
+                 SBAIJ};
 
 
 /**
@@ -151,6 +163,13 @@ public:
              const std::vector<numeric_index_type> & n_oz,
              const numeric_index_type blocksize=1);
 
+  /**
+   * Initialize a PETSc matrix using the sparsity pattern computed by
+   * the attached \p DofMap.  If the \p DofMap kept the exact columns
+   * of each row (see DofMap::set_csr_sparsity()), an \p AIJ matrix is
+   * preallocated with exactly those columns, so that the first
+   * assembly doesn't allocate anything.
+   */
   virtual void init (ParallelType = PARALLEL) override;
 
   /**
@@ -165,6 +184,44 @@ public:
    */
   void reset_preallocation();
 
+  virtual void reuse_nonzero_pattern (bool reuse) override;
+
+  /**
+   * While buffering, entries of other processors' rows are kept in
+   * per-processor arrays and exchanged, in a single round with only
+   * the processors which take part, by \p close() and \p flush(), and
+   * PETSc is told with \p MAT_NO_OFF_PROC_ENTRIES that its own stash
+   * has nothing to communicate.
+   *
+   * As with PETSc's own stash, entries may only be set or only be
+   * added, on every processor, between one \p close() or \p flush()
+   * and the next; mixing the two is an error.
+   *
+   * \note PETSc keeps ignoring off-processor entries until buffering
+   * is turned off again, so while buffering every entry must be
+   * passed through this object: an entry of another processor's row
+   * given to \p MatSetValues() on \p mat() directly is dropped.
+   */
+  virtual void buffer_off_processor_entries (bool buffer) override;
+
+  /**
+   * Direct insertion is supported for assembled AIJ matrices, whose
+   * diagonal and off-diagonal block values are then written through
+   * \p MatSeqAIJGetArray() rather than with \p MatSetValues().
+   */
+  virtual bool begin_direct_insertion () override;
+
+  virtual void end_direct_insertion () override;
+
+  virtual void compute_insertion_offsets (const std::vector<numeric_index_type> & rows,
+                                          const std::vector<numeric_index_type> & cols,
+                                          std::vector<numeric_index_type> & offsets) const override;
+
+  virtual void add_matrix_at_offsets (const DenseMatrix<T> & dm,
+                                      const std::vector<numeric_index_type> & rows,
+                                      const std::vector<numeric_index_type> & cols,
+                                      const std::vector<numeric_index_type> & offsets) override;
+
   virtual void clear () override;
 
   virtual void zero () override;
@@ -268,6 +325,14 @@ public:
 
   virtual void get_transpose (SparseMatrix<T> & dest) const override;
 
+  /**
+   * Computes P^T A P with MatPtAP(), reusing the symbolic product in
+   * \p dest when \p reuse is true.
+   */
+  virtual void get_ptap (const SparseMatrix<T> & P,
+                         SparseMatrix<T> & dest,
+                         bool reuse = false) const override;
+
   /**
    * Swaps the internal data pointers of two PetscMatrices, no actual
    * values are swapped.
@@ -281,6 +346,9 @@ public:
    *
    * \note Don't do anything crazy like calling MatDestroy() on
    * it, or very bad things will likely happen!
+   *
+   * \note While buffer_off_processor_entries() is on, PETSc drops
+   * entries of other processors' rows set on this Mat directly.
    */
   Mat mat () { libmesh_assert (_mat); return _mat; }
 
@@ -319,6 +387,114 @@ private:
 
   PetscMatrixType _mat_type;
 
+  /**
+   * The block size of our block storage, or 1 if we aren't using
+   * block storage.
+   */
+  numeric_index_type _block_size;
+
+  /**
+   * \returns \p true if we should store blocks of size \p blocksize,
+   * rather than using AIJ or HYPRE storage.
+   */
+  bool use_block_storage(const PetscInt blocksize) const;
+
+  /**
+   * Adds \p dm with \p MatSetValuesBlocked() if its \p rows and \p
+   * cols are whole blocks, in the order \p DofMap::dof_indices() gives
+   * a single VariableGroup.
+   *
+   * \returns \p false, having added nothing, otherwise.
+   */
+  bool _add_matrix_blocked(const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols);
+
+  /**
+   * Sets or adds, according to \p mode, the \p n_cols values of a
+   * single \p row, buffering them if the row is owned elsewhere and
+   * we are buffering off-processor entries.
+   */
+  void _set_row_values(numeric_index_type row,
+                       numeric_index_type n_cols,
+                       const numeric_index_type * cols,
+                       const T * values,
+                       InsertMode mode);
+
+  /**
+   * Sends the buffered entries to the processors owning their rows,
+   * and sets or adds those we receive.
+   */
+  void _exchange_buffered_entries();
+
+  /**
+   * Records that entries are set or added, according to \p mode,
+   * before the next assembly, and throws an error if the other kind
+   * already were.
+   */
+  void _note_insert_mode(InsertMode mode);
+
+  /**
+   * Whether we buffer entries of other processors' rows ourselves
+   */
+  bool _buffer_off_processor;
+
+  /**
+   * Whether we were asked to reuse the nonzero pattern from one
+   * assembly to the next.
+   */
+  bool _reuse_nonzero_pattern;
+
+  /**
+   * Whether the nonzero pattern is known to be complete: we were
+   * preallocated with the exact sparsity, or an assembly has been
+   * closed since we were asked to reuse the pattern.  Only then can
+   * new nonzero locations be made an error.
+   */
+  bool _pattern_is_exact;
+
+  /**
+   * Tells PETSc to treat new nonzero locations as errors, if we are
+   * reusing a complete nonzero pattern.
+   */
+  void _set_new_nonzero_location_err();
+
+  /**
+   * Whether entries have been set or added since the last assembly,
+   * or \p NOT_SET_VALUES if neither, while buffering.
+   */
+  InsertMode _insert_mode;
+
+  /**
+   * The buffered (row, column) entries and their values, for each
+   * processor owning the rows, in the order they were given.
+   */
+  typedef std::pair<std::pair<numeric_index_type, numeric_index_type>, T>
+    buffered_entry;
+
+  std::map<processor_id_type, std::vector<buffered_entry>> _buffered_entries;
+
+  /**
+   * The local storage of an AIJ matrix during direct insertion: the
+   * sparsity structure and values of its diagonal block and, in
+   * parallel, of its off-diagonal block, whose columns are numbered
+   * by their position in \p garray.
+   */
+  struct DirectInsertion
+  {
+    Mat diag, offdiag;
+    const PetscInt * diag_ia, * diag_ja, * offdiag_ia, * offdiag_ja;
+    const PetscInt * garray;
+    PetscScalar * diag_values, * offdiag_values;
+    PetscInt n_rows, n_offdiag_cols, diag_nnz;
+    PetscInt row_start, row_stop, col_start, col_stop;
+  };
+
+  /**
+   * Set during direct insertion, null otherwise.
+   */
+  std::unique_ptr<DirectInsertion> _direct_insertion;
+
 #ifdef LIBMESH_HAVE_CXX11_THREAD
   mutable std::mutex _petsc_matrix_mutex;
 #else
@@ -46,6 +46,7 @@
 // C++ includes
 #include <cstddef>
 #include <cstring>
+#include <map>
 #include <vector>
 #include <unordered_map>
 
@@ -137,6 +138,24 @@ public:
 
   virtual void close () override;
 
+  /**
+   * While buffering, values at other processors' indices are kept in
+   * per-processor arrays and exchanged, in a single round with only
+   * the processors which take part, by \p close(), and PETSc is told
+   * with \p VEC_IGNORE_OFF_PROC_ENTRIES that its own stash has nothing
+   * to communicate.
+   *
+   * As with PETSc's own stash, values may only be set or only be
+   * added, on every processor, between one \p close() and the next;
+   * mixing the two is an error.
+   *
+   * \note PETSc keeps ignoring off-processor entries until buffering
+   * is turned off again, so while buffering every value must be
+   * passed through this object: a value at another processor's index
+   * given to \p VecSetValues() on \p vec() directly is dropped.
+   */
+  virtual void buffer_off_processor_entries (bool buffer) override;
+
   virtual void clear () override;
 
   virtual void zero () override;
@@ -247,6 +266,15 @@ public:
 
   virtual void add (const T a, const NumericVector<T> & v) override;
 
+  virtual void axpbypcz (const T alpha,
+                         const T beta,
+                         const T gamma,
+                         const NumericVector<T> & x,
+                         const NumericVector<T> & y) override;
+
+  virtual void add (const std::vector<T> & a,
+                    const std::vector<const NumericVector<T> *> & v) override;
+
   /**
    * We override two NumericVector<T>::add_vector() methods but don't
    * want to hide the other defaults.
@@ -290,6 +318,11 @@ public:
 
   virtual T dot(const NumericVector<T> & v) const override;
 
+  virtual void dot (const std::vector<const NumericVector<T> *> & v,
+                    std::vector<T> & results) const override;
+
+  virtual std::pair<T, Real> dot_and_l2_norm (const NumericVector<T> & v) const override;
+
   /**
    * \returns The dot product of (*this) with the vector \p v.
    *
@@ -304,6 +337,15 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const override;
 
+  /**
+   * Begins the scatter into \p v_local, or the update of its ghost
+   * values if it is GHOSTED, without waiting for it to finish.
+   */
+  virtual void begin_localize (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const override;
+
+  virtual void end_localize (NumericVector<T> & v_local) const override;
+
   virtual void localize (std::vector<T> & v_local,
                          const std::vector<numeric_index_type> & indices) const override;
 
@@ -331,6 +373,9 @@ public:
    *
    * \note Don't do anything crazy like calling VecDestroy() on
    * it, or very bad things will likely happen!
+   *
+   * \note While buffer_off_processor_entries() is on, PETSc drops
+   * values at other processors' indices set on this Vec directly.
    */
   Vec vec () { libmesh_assert (_vec); return _vec; }
 
@@ -454,6 +499,60 @@ private:
    * Whether or not the data array is for read only access
    */
   mutable bool _values_read_only;
+
+  /**
+   * Whether a begin_localize() into this vector is awaiting its
+   * end_localize()
+   */
+  bool _localize_in_progress;
+
+  /**
+   * The scatter of a localize into this vector which is in progress,
+   * or nullptr if there is none or if it is just updating our own
+   * ghost values.
+   */
+  VecScatter _localize_scatter;
+
+  /**
+   * Sets or adds, according to \p mode, the \p n values at \p
+   * indices, buffering those owned elsewhere if we are buffering
+   * off-processor entries.
+   */
+  void _set_values(numeric_index_type n,
+                   const numeric_index_type * indices,
+                   const T * values,
+                   InsertMode mode);
+
+  /**
+   * Sends the buffered values to the processors owning their
+   * indices, and sets or adds those we receive.
+   */
+  void _exchange_buffered_entries();
+
+  /**
+   * Records that values are set or added, according to \p mode,
+   * before the next \p close(), and throws an error if the other kind
+   * already were.
+   */
+  void _note_insert_mode(InsertMode mode);
+
+  /**
+   * Whether we buffer values at other processors' indices ourselves
+   */
+  bool _buffer_off_processor;
+
+  /**
+   * Whether values have been set or added since the last \p close(),
+   * or \p NOT_SET_VALUES if neither, while buffering.
+   */
+  InsertMode _insert_mode;
+
+  /**
+   * The buffered indices and their values, for each processor
+   * owning them.
+   */
+  std::map<processor_id_type, std::vector<std::pair<numeric_index_type, T>>>
+    _buffered_entries;
 };
 
 
@@ -473,7 +572,11 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in, const Paral
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _localize_in_progress(false),
+  _localize_scatter(nullptr),
+  _buffer_off_processor(false),
+  _insert_mode(NOT_SET_VALUES)
 {
   this->_type = ptype;
 }
@@ -492,7 +595,11 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in,
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _localize_in_progress(false),
+  _localize_scatter(nullptr),
+  _buffer_off_processor(false),
+  _insert_mode(NOT_SET_VALUES)
 {
   this->init(n, n, false, ptype);
 }
@@ -512,7 +619,11 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in,
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _localize_in_progress(false),
+  _localize_scatter(nullptr),
+  _buffer_off_processor(false),
+  _insert_mode(NOT_SET_VALUES)
 {
   this->init(n, n_local, false, ptype);
 }
@@ -533,7 +644,11 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in,
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _localize_in_progress(false),
+  _localize_scatter(nullptr),
+  _buffer_off_processor(false),
+  _insert_mode(NOT_SET_VALUES)
 {
   this->init(n, n_local, ghost, false, ptype);
 }
@@ -553,7 +668,11 @@ PetscVector<T>::PetscVector (Vec v,
   _global_to_local_map(),
   _destroy_vec_on_exit(false),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _localize_in_progress(false),
+  _localize_scatter(nullptr),
+  _buffer_off_processor(false),
+  _insert_mode(NOT_SET_VALUES)
 {
   this->_vec = v;
   this->_is_closed = true;
@@ -571,7 +690,8 @@ PetscVector<T>::PetscVector (Vec v,
   ierr = VecGetType(_vec, &ptype);
   LIBMESH_CHKERR(ierr);
 
-  if ((std::strcmp(ptype,VECSHARED) == 0) || (std::strcmp(ptype,VECMPI) == 0))
+  // The device types (mpicuda, mpikokkos, ...) are parallel too
+  if ((std::strcmp(ptype,VECSHARED) == 0) || (std::strncmp(ptype,VECMPI,3) == 0))
     {
       ISLocalToGlobalMapping mapping;
       ierr = VecGetLocalToGlobalMapping(_vec, &mapping);
@@ -653,10 +773,18 @@ void PetscVector<T>::init (const numeric_index_type n,
   libmesh_assert ((this->_type==SERIAL && n==n_local) ||
                   this->_type==PARALLEL);
 
+  // We leave the type of the Vec to VecSetFromOptions(), rather than
+  // creating a VECSEQ or VECMPI and then converting it, so that a
+  // -vec_type like cuda or kokkos gets its storage allocated on the
+  // device from the start.
+
   // create a sequential vector if on only 1 processor
   if (this->_type == SERIAL)
     {
-      ierr = VecCreateSeq (PETSC_COMM_SELF, petsc_n, &_vec);
+      ierr = VecCreate (PETSC_COMM_SELF, &_vec);
+      CHKERRABORT(PETSC_COMM_SELF,ierr);
+
+      ierr = VecSetSizes (_vec, petsc_n, petsc_n);
       CHKERRABORT(PETSC_COMM_SELF,ierr);
 
       ierr = VecSetFromOptions (_vec);
@@ -668,15 +796,18 @@ void PetscVector<T>::init (const numeric_index_type n,
 #ifdef LIBMESH_HAVE_MPI
       PetscInt petsc_n_local=cast_int<PetscInt>(n_local);
       libmesh_assert_less_equal (n_local, n);
-      ierr = VecCreateMPI (this->comm().get(), petsc_n_local, petsc_n,
-                           &_vec);
+      ierr = VecCreate (this->comm().get(), &_vec);
       LIBMESH_CHKERR(ierr);
 #else
+      PetscInt petsc_n_local=petsc_n;
       libmesh_assert_equal_to (n_local, n);
-      ierr = VecCreateSeq (PETSC_COMM_SELF, petsc_n, &_vec);
+      ierr = VecCreate (PETSC_COMM_SELF, &_vec);
       CHKERRABORT(PETSC_COMM_SELF,ierr);
 #endif
 
+      ierr = VecSetSizes (_vec, petsc_n_local, petsc_n);
+      LIBMESH_CHKERR(ierr);
+
       ierr = VecSetFromOptions (_vec);
       LIBMESH_CHKERR(ierr);
     }
@@ -813,6 +944,9 @@ void PetscVector<T>::close ()
 
   this->_restore_array();
 
+  if (_buffer_off_processor)
+    this->_exchange_buffered_entries();
+
   PetscErrorCode ierr=0;
 
   ierr = VecAssemblyBegin(_vec);
@@ -820,6 +954,8 @@ void PetscVector<T>::close ()
   ierr = VecAssemblyEnd(_vec);
   LIBMESH_CHKERR(ierr);
 
+  _insert_mode = NOT_SET_VALUES;
+
   if (this->type() == GHOSTED)
     {
       ierr = VecGhostUpdateBegin(_vec,INSERT_VALUES,SCATTER_FORWARD);
@@ -842,6 +978,13 @@ void PetscVector<T>::clear ()
   if (this->initialized())
     this->_restore_array();
 
+  if (_localize_scatter)
+    {
+      PetscErrorCode ierr = VecScatterDestroy(&_localize_scatter);
+      LIBMESH_CHKERR(ierr);
+    }
+  _localize_in_progress = false;
+
   if ((this->initialized()) && (this->_destroy_vec_on_exit))
     {
       PetscErrorCode ierr=0;
@@ -853,6 +996,9 @@ void PetscVector<T>::clear ()
   this->_is_closed = this->_is_initialized = false;
 
   _global_to_local_map.clear();
+
+  _insert_mode = NOT_SET_VALUES;
+  _buffered_entries.clear();
 }
 
 
@@ -0,0 +1,173 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_SINGLE_PRECISION_SHELL_MATRIX_H
+#define LIBMESH_SINGLE_PRECISION_SHELL_MATRIX_H
+
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+#include "libmesh/sparse_matrix.h"
+
+// C++ includes
+#include <complex>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The single precision counterpart of a scalar type: \p float for
+ * real types and \p std::complex<float> for complex types.
+ */
+template <typename T>
+struct SinglePrecision
+{
+  typedef float type;
+};
+
+template <typename T>
+struct SinglePrecision<std::complex<T>>
+{
+  typedef std::complex<float> type;
+};
+
+
+
+/**
+ * This class keeps a single precision copy of the local rows of a
+ * SparseMatrix and uses it as a shell matrix.  Storing the values in
+ * half the bytes halves the memory traffic of a matrix-vector
+ * product, which is what bounds its cost, at the price of the accuracy
+ * of that product.  It is meant for the inner solves of an iterative
+ * refinement whose residuals are computed with the original matrix at
+ * full precision.  All overridden virtual functions are documented
+ * in shell_matrix.h.
+ */
+template <typename T>
+class SinglePrecisionShellMatrix : public ShellMatrix<T>
+{
+public:
+  typedef typename SinglePrecision<T>::type single_type;
+
+  /**
+   * Constructor; copies the local rows of \p new_m, which must be
+   * closed and must implement \p get_row().  The sparse matrix itself
+   * has to be stored elsewhere, for later calls to \p update().
+   */
+  explicit
+  SinglePrecisionShellMatrix (const SparseMatrix<T> & new_m);
+
+  /**
+   * Destructor.
+   */
+  virtual ~SinglePrecisionShellMatrix ();
+
+  /**
+   * Copies the values of the sparse matrix again, after it has been
+   * reassembled.
+   */
+  void update ();
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<T> & dest,
+                            const NumericVector<T> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<T> & dest,
+                                const NumericVector<T> & arg) const override;
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+protected:
+  /**
+   * Computes the local rows of the product with \p arg.
+   */
+  void local_product (const NumericVector<T> & arg,
+                      std::vector<T> & result) const;
+
+  /**
+   * The sparse matrix.
+   */
+  const SparseMatrix<T> & _m;
+
+  /**
+   * The global indices of the local rows.
+   */
+  std::vector<numeric_index_type> _rows;
+
+  /**
+   * The offsets of each local row into \p _column_indices and
+   * \p _values, compressed sparse row style.
+   */
+  std::vector<numeric_index_type> _row_offsets;
+
+  /**
+   * The sorted global indices of every column the local rows refer
+   * to; these are all the entries of a vector a product needs.
+   */
+  std::vector<numeric_index_type> _columns;
+
+  /**
+   * The position in \p _columns of the column of each entry.
+   */
+  std::vector<numeric_index_type> _column_indices;
+
+  /**
+   * The entries, in single precision.
+   */
+  std::vector<single_type> _values;
+};
+
+
+
+//-----------------------------------------------------------------------
+// SinglePrecisionShellMatrix inline members
+template <typename T>
+inline
+SinglePrecisionShellMatrix<T>::~SinglePrecisionShellMatrix ()
+{}
+
+
+
+template <typename T>
+inline
+numeric_index_type SinglePrecisionShellMatrix<T>::m () const
+{
+  return _m.m();
+}
+
+
+
+template <typename T>
+inline
+numeric_index_type SinglePrecisionShellMatrix<T>::n () const
+{
+  return _m.n();
+}
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_SINGLE_PRECISION_SHELL_MATRIX_H
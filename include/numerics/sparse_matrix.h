@@ -121,6 +121,19 @@ public:
   virtual bool need_full_sparsity_pattern() const
   { return false; }
 
+  /**
+   * \returns \p true if \p add() and \p add_matrix() may be called
+   * from several threads at once, as long as no two threads add to
+   * the same entry.  Otherwise callers must serialize their
+   * insertions.
+   *
+   * This is true for \p LaspackMatrix, whose sparsity pattern is
+   * fixed, but not for formats which may allocate or stash entries
+   * on insertion.
+   */
+  virtual bool supports_concurrent_add() const
+  { return false; }
+
   /**
    * Updates the matrix sparsity pattern. When your \p SparseMatrix<T>
    * implementation does not need this data, simply do not override
@@ -128,6 +141,74 @@ public:
    */
   virtual void update_sparsity_pattern (const SparsityPattern::Graph &) {}
 
+  /**
+   * Tells the matrix whether subsequent assemblies will only touch
+   * entries within its current nonzero pattern, so that it can treat
+   * any new entry as an error and reuse what it learns from one
+   * assembly in the next.  Unless the matrix was preallocated with
+   * the exact sparsity pattern, its pattern is only complete once the
+   * first such assembly is closed.  When your \p SparseMatrix<T>
+   * implementation cannot use this hint, simply do not override this
+   * method.
+   */
+  virtual void reuse_nonzero_pattern (bool) {}
+
+  /**
+   * Tells the matrix whether to collect entries added to rows owned
+   * by other processors in buffers of its own, to be sent to their
+   * owners all at once by \p close(), rather than leaving them to the
+   * underlying library.  When your \p SparseMatrix<T> implementation
+   * has nothing to gain from this, simply do not override this
+   * method.
+   */
+  virtual void buffer_off_processor_entries (bool) {}
+
+  /**
+   * Prepares an assembled matrix for add_matrix_at_offsets(), which
+   * adds element matrices straight into the local storage at offsets
+   * from compute_insertion_offsets().  Each successful call must be
+   * followed by end_direct_insertion() before the matrix is used or
+   * closed, and the sparsity pattern must not change in between.
+   *
+   * \returns \p false if this matrix type or state does not support
+   * direct insertion, in which case add_matrix_at_offsets() simply
+   * calls add_matrix().  When your \p SparseMatrix<T> implementation
+   * cannot insert directly, simply do not override these methods.
+   */
+  virtual bool begin_direct_insertion () { return false; }
+
+  /**
+   * Ends the direct insertion begun by begin_direct_insertion().
+   */
+  virtual void end_direct_insertion () {}
+
+  /**
+   * Fills \p offsets with the position in local storage of each entry,
+   * in row-major order, of a dense matrix to be added at global \p
+   * rows and \p cols.  Entries of rows stored on other processors get
+   * invalid offsets, and are passed on to add_matrix() instead.  The
+   * offsets remain valid, between direct insertions, for as long as
+   * the sparsity pattern does not change.
+   *
+   * This leaves \p offsets empty when direct insertion is not under
+   * way.  It may be called from several threads at once.
+   */
+  virtual void compute_insertion_offsets (const std::vector<numeric_index_type> & /*rows*/,
+                                          const std::vector<numeric_index_type> & /*cols*/,
+                                          std::vector<numeric_index_type> & offsets) const
+  { offsets.clear(); }
+
+  /**
+   * Adds \p dm, as add_matrix() does, at the \p offsets which
+   * compute_insertion_offsets() found for \p rows and \p cols.  This
+   * has the same thread safety as add_matrix().
+   */
+  virtual void add_matrix_at_offsets (const DenseMatrix<T> & dm,
+                                      const std::vector<numeric_index_type> & rows,
+                                      const std::vector<numeric_index_type> & cols,
+                                      const std::vector<numeric_index_type> & /*offsets*/)
+  { this->add_matrix (dm, rows, cols); }
+
   /**
    * Initialize SparseMatrix with the specified sizes.
    *
@@ -423,6 +504,22 @@ public:
    */
   virtual void get_transpose (SparseMatrix<T> & dest) const = 0;
 
+  /**
+   * Computes the triple product P^T A P of this matrix A and \p P
+   * into \p dest, which must not be either of them.
+   *
+   * If \p reuse is true and \p dest already holds the result of an
+   * earlier product with matrices of the same sparsity patterns,
+   * implementations may reuse its structure and recompute only its
+   * values.
+   */
+  virtual void get_ptap (const SparseMatrix<T> & /*P*/,
+                         SparseMatrix<T> & /*dest*/,
+                         bool /*reuse*/ = false) const
+  {
+    libmesh_not_implemented();
+  }
+
   /**
    * Get a row from the matrix
    * @param i The matrix row to get
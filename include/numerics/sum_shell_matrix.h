@@ -27,6 +27,7 @@
 #include "libmesh/shell_matrix.h"
 
 // C++ includes
+#include <memory>
 #include <vector>
 
 namespace libMesh
@@ -82,6 +83,14 @@ public:
    * A vector of pointers to the summands.
    */
   std::vector<ShellMatrix<T> *> matrices;
+
+private:
+
+  /**
+   * Holds each summand's diagonal in \p get_diagonal(), and is kept
+   * for later calls with compatible vectors.
+   */
+  mutable std::unique_ptr<NumericVector<T>> _diagonal_work;
 };
 
 
@@ -107,12 +116,6 @@ SumShellMatrix<T>::SumShellMatrix (const std::vector<ShellMatrix<T> *> & mat,
 
 
 
-template <typename T>
-inline
-SumShellMatrix<T>::~SumShellMatrix ()
-{}
-
-
 } // namespace libMesh
 
 
@@ -198,6 +198,13 @@ public:
 
   virtual void add (const T a, const NumericVector<T> & v) override;
 
+  /**
+   * The fused multi-vector NumericVector<T>::add() and dot() defaults
+   * are used as-is; don't hide them.
+   */
+  using NumericVector<T>::add;
+  using NumericVector<T>::dot;
+
   /**
    * We override two NumericVector<T>::add_vector() methods but don't
    * want to hide the other defaults.
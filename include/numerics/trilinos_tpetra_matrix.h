@@ -0,0 +1,234 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_TRILINOS_TPETRA_MATRIX_H
+#define LIBMESH_TRILINOS_TPETRA_MATRIX_H
+
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_TRILINOS_HAVE_TPETRA_SOLVERS
+
+// Local includes
+#include "libmesh/sparse_matrix.h"
+#include "libmesh/trilinos_tpetra_vector.h"
+
+// Trilinos includes
+#include "libmesh/ignore_warnings.h"
+#include <Tpetra_CrsGraph.hpp>
+#include <Tpetra_CrsMatrix.hpp>
+#include "libmesh/restore_warnings.h"
+
+// C++ includes
+#include <cstddef>
+
+namespace libMesh
+{
+
+// Forward Declarations
+template <typename T> class DenseMatrix;
+
+
+
+/**
+ * This class provides a nice interface to the Tpetra::CrsMatrix, the
+ * Kokkos based successor of Epetra_FECrsMatrix, for parallel, sparse
+ * matrices.  When a \p DofMap provides the sparsity pattern the
+ * matrix is built on a fixed, fill-complete graph, so that assembly
+ * only ever sums into existing entries, and matrix-vector products
+ * run on whatever Kokkos node Trilinos was built with.  All
+ * overridden virtual functions are documented in sparse_matrix.h.
+ */
+template <typename T>
+class TpetraMatrix final : public SparseMatrix<T>
+{
+public:
+
+  /**
+   * The Tpetra types we use.
+   */
+  typedef typename TpetraVector<T>::map_type map_type;
+  typedef typename TpetraVector<T>::local_ordinal_type local_ordinal_type;
+  typedef typename TpetraVector<T>::global_ordinal_type global_ordinal_type;
+  typedef Tpetra::CrsGraph<local_ordinal_type, global_ordinal_type> graph_type;
+  typedef Tpetra::CrsMatrix<T, local_ordinal_type, global_ordinal_type> matrix_type;
+
+  /**
+   * Constructor; initializes the matrix to be empty, without any
+   * structure, i.e.  the matrix is not usable at all. This
+   * constructor is therefore only useful for matrices which are
+   * members of a class. All other matrices should be created at a
+   * point in the data flow where all necessary information is
+   * available.
+   *
+   * You have to initialize the matrix before usage with \p init(...).
+   */
+  TpetraMatrix (const Parallel::Communicator & comm);
+
+  /**
+   * Copying would leave two TpetraMatrices sharing one
+   * Tpetra::CrsMatrix, so we only allow moves.
+   */
+  TpetraMatrix (TpetraMatrix &&) = default;
+  TpetraMatrix (const TpetraMatrix &) = delete;
+  TpetraMatrix & operator= (const TpetraMatrix &) = delete;
+  TpetraMatrix & operator= (TpetraMatrix &&) = default;
+  virtual ~TpetraMatrix () = default;
+
+  /**
+   * The \p TpetraMatrix needs the full sparsity pattern.
+   */
+  virtual bool need_full_sparsity_pattern () const override
+  { return true; }
+
+  /**
+   * Updates the matrix sparsity pattern.  This builds the fixed
+   * graph the matrix is then initialized on.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::Graph &) override;
+
+  virtual void init (const numeric_index_type m,
+                     const numeric_index_type n,
+                     const numeric_index_type m_l,
+                     const numeric_index_type n_l,
+                     const numeric_index_type nnz=30,
+                     const numeric_index_type noz=10,
+                     const numeric_index_type blocksize=1) override;
+
+  virtual void init (ParallelType = PARALLEL) override;
+
+  virtual void clear () override;
+
+  virtual void zero () override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> zero_clone () const override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> clone () const override;
+
+  virtual void close () override;
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual numeric_index_type row_start () const override;
+
+  virtual numeric_index_type row_stop () const override;
+
+  virtual void set (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & dof_indices) override;
+
+  /**
+   * Compute A += a*X for scalar \p a, matrix \p X.
+   *
+   * \note The sparsity pattern of \p X must be contained in that of
+   * \p this.
+   *
+   * \note \p X will be closed, if not already done, before performing
+   * any work.
+   */
+  virtual void add (const T a, const SparseMatrix<T> & X) override;
+
+  virtual T operator () (const numeric_index_type i,
+                         const numeric_index_type j) const override;
+
+  virtual Real l1_norm () const override;
+
+  virtual Real linfty_norm () const override;
+
+  virtual bool closed() const override;
+
+  virtual void print_personal(std::ostream & os=libMesh::out) const override;
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+  virtual void get_transpose (SparseMatrix<T> & dest) const override;
+
+  /**
+   * \returns The underlying Tpetra::CrsMatrix.
+   *
+   * \note This is generally not required in user-level code.
+   */
+  matrix_type & mat () { libmesh_assert(_mat.get()); return *_mat; }
+
+  const matrix_type & mat () const { libmesh_assert(_mat.get()); return *_mat; }
+
+  /**
+   * \returns A reference counted pointer to the underlying
+   * Tpetra::CrsMatrix, for handing to other Trilinos packages.
+   */
+  Teuchos::RCP<matrix_type> mat_ptr () const { return _mat; }
+
+private:
+
+  /**
+   * Builds the row map for \p m_l local rows out of \p m, and our
+   * row range.
+   */
+  void build_map (const numeric_index_type m,
+                  const numeric_index_type m_l);
+
+  /**
+   * Adds the \p n_cols \p values to the entries \p cols of global row
+   * \p row.
+   */
+  void add_to_row (const numeric_index_type row,
+                   const std::size_t n_cols,
+                   const numeric_index_type * cols,
+                   const T * values);
+
+  /**
+   * Lets values be written again if \p _mat has been fill-completed.
+   */
+  void resume_fill ();
+
+  /**
+   * The actual Tpetra matrix.
+   */
+  Teuchos::RCP<matrix_type> _mat;
+
+  /**
+   * The distributed row map.
+   */
+  Teuchos::RCP<const map_type> _map;
+
+  /**
+   * The fixed sparsity pattern, if we've been given one.
+   */
+  Teuchos::RCP<const graph_type> _graph;
+
+  /**
+   * The range of rows we own.
+   */
+  numeric_index_type _row_start, _row_stop;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TRILINOS_HAVE_TPETRA_SOLVERS
+#endif // LIBMESH_TRILINOS_TPETRA_MATRIX_H
@@ -0,0 +1,573 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_TRILINOS_TPETRA_VECTOR_H
+#define LIBMESH_TRILINOS_TPETRA_VECTOR_H
+
+
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_TRILINOS_HAVE_TPETRA_SOLVERS
+
+// Local includes
+#include "libmesh/numeric_vector.h"
+#include "libmesh/parallel.h"
+
+// Trilinos includes
+#include "libmesh/ignore_warnings.h"
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_Map.hpp>
+#include <Tpetra_Vector.hpp>
+#include "libmesh/restore_warnings.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+template <typename T> class SparseMatrix;
+
+/**
+ * \returns A Teuchos communicator wrapping the MPI communicator of \p
+ * comm, for building Tpetra maps.
+ */
+inline
+Teuchos::RCP<const Teuchos::Comm<int>>
+tpetra_comm (const Parallel::Communicator & comm)
+{
+  return Teuchos::rcp(new Teuchos::MpiComm<int>(comm.get()));
+}
+
+
+
+/**
+ * This class provides a nice interface to the Trilinos Tpetra::Vector
+ * object, the Kokkos based successor of Epetra_Vector.  Local
+ * operations (norms, dot products, updates) run through Tpetra on
+ * whatever Kokkos node Trilinos was built with, so they are threaded
+ * whenever Tpetra is.  Global indices are Tpetra's default global
+ * ordinal, which is 64 bits wide in most Trilinos builds.  All
+ * overridden virtual functions are documented in numeric_vector.h.
+ *
+ * As with \p EpetraVector, a GHOSTED vector is currently stored as a
+ * SERIAL one, with every entry available on every processor.
+ */
+template <typename T>
+class TpetraVector final : public NumericVector<T>
+{
+public:
+
+  /**
+   * The Tpetra types we use.
+   */
+  typedef Tpetra::Map<> map_type;
+  typedef map_type::local_ordinal_type local_ordinal_type;
+  typedef map_type::global_ordinal_type global_ordinal_type;
+  typedef Tpetra::Vector<T, local_ordinal_type, global_ordinal_type> vector_type;
+
+  /**
+   *  Dummy-Constructor. Dimension=0
+   */
+  explicit
+  TpetraVector (const Parallel::Communicator & comm,
+                const ParallelType type = AUTOMATIC);
+
+  /**
+   * Constructor. Set dimension to \p n and initialize all elements with zero.
+   */
+  explicit
+  TpetraVector (const Parallel::Communicator & comm,
+                const numeric_index_type n,
+                const ParallelType type = AUTOMATIC);
+
+  /**
+   * Constructor. Set local dimension to \p n_local, the global dimension
+   * to \p n, and initialize all elements with zero.
+   */
+  TpetraVector (const Parallel::Communicator & comm,
+                const numeric_index_type n,
+                const numeric_index_type n_local,
+                const ParallelType type = AUTOMATIC);
+
+  /**
+   * Constructor. Set local dimension to \p n_local, the global
+   * dimension to \p n, but additionally reserve memory for the
+   * indices specified by the \p ghost argument.
+   */
+  TpetraVector (const Parallel::Communicator & comm,
+                const numeric_index_type N,
+                const numeric_index_type n_local,
+                const std::vector<numeric_index_type> & ghost,
+                const ParallelType type = AUTOMATIC);
+
+  /**
+   * Copying would leave two TpetraVectors sharing one
+   * Tpetra::Vector, so we only allow moves.
+   */
+  TpetraVector (TpetraVector &&) = default;
+  TpetraVector (const TpetraVector &) = delete;
+  TpetraVector & operator= (const TpetraVector &) = delete;
+  TpetraVector & operator= (TpetraVector &&) = default;
+  virtual ~TpetraVector () = default;
+
+  virtual void close () override;
+
+  virtual void clear () override;
+
+  virtual void zero () override;
+
+  virtual std::unique_ptr<NumericVector<T>> zero_clone () const override;
+
+  virtual std::unique_ptr<NumericVector<T>> clone () const override;
+
+  virtual void init (const numeric_index_type N,
+                     const numeric_index_type n_local,
+                     const bool fast=false,
+                     const ParallelType type=AUTOMATIC) override;
+
+  virtual void init (const numeric_index_type N,
+                     const bool fast=false,
+                     const ParallelType type=AUTOMATIC) override;
+
+  virtual void init (const numeric_index_type N,
+                     const numeric_index_type n_local,
+                     const std::vector<numeric_index_type> & ghost,
+                     const bool fast = false,
+                     const ParallelType = AUTOMATIC) override;
+
+  virtual void init (const NumericVector<T> & other,
+                     const bool fast = false) override;
+
+  virtual NumericVector<T> & operator= (const T s) override;
+
+  virtual NumericVector<T> & operator= (const NumericVector<T> & v) override;
+
+  virtual NumericVector<T> & operator= (const std::vector<T> & v) override;
+
+  virtual Real min () const override;
+
+  virtual Real max () const override;
+
+  virtual T sum () const override;
+
+  virtual Real l1_norm () const override;
+
+  virtual Real l2_norm () const override;
+
+  virtual Real linfty_norm () const override;
+
+  virtual numeric_index_type size () const override;
+
+  virtual numeric_index_type local_size() const override;
+
+  virtual numeric_index_type first_local_index() const override;
+
+  virtual numeric_index_type last_local_index() const override;
+
+  virtual T operator() (const numeric_index_type i) const override;
+
+  virtual NumericVector<T> & operator += (const NumericVector<T> & v) override;
+
+  virtual NumericVector<T> & operator -= (const NumericVector<T> & v) override;
+
+  virtual NumericVector<T> & operator *= (const NumericVector<T> & v) override;
+
+  virtual NumericVector<T> & operator /= (const NumericVector<T> & v) override;
+
+  virtual void reciprocal() override;
+
+  virtual void conjugate() override;
+
+  virtual void set (const numeric_index_type i, const T value) override;
+
+  virtual void add (const numeric_index_type i, const T value) override;
+
+  virtual void add (const T s) override;
+
+  virtual void add (const NumericVector<T> & v) override;
+
+  virtual void add (const T a, const NumericVector<T> & v) override;
+
+  /**
+   * The fused multi-vector NumericVector<T>::add() and dot() defaults
+   * are used as-is; don't hide them.
+   */
+  using NumericVector<T>::add;
+  using NumericVector<T>::dot;
+
+  /**
+   * We override two NumericVector<T>::add_vector() methods but don't
+   * want to hide the other defaults.
+   */
+  using NumericVector<T>::add_vector;
+
+  virtual void add_vector (const T * v,
+                           const std::vector<numeric_index_type> & dof_indices) override;
+
+  virtual void add_vector (const NumericVector<T> & v,
+                           const SparseMatrix<T> & A) override;
+
+  virtual void add_vector_transpose (const NumericVector<T> & v,
+                                     const SparseMatrix<T> & A) override;
+
+  /**
+   * We override one NumericVector<T>::insert() method but don't want
+   * to hide the other defaults
+   */
+  using NumericVector<T>::insert;
+
+  virtual void insert (const T * v,
+                       const std::vector<numeric_index_type> & dof_indices) override;
+
+  virtual void scale (const T factor) override;
+
+  virtual void abs() override;
+
+  virtual T dot(const NumericVector<T> & v) const override;
+
+  virtual void localize (std::vector<T> & v_local) const override;
+
+  virtual void localize (NumericVector<T> & v_local) const override;
+
+  virtual void localize (NumericVector<T> & v_local,
+                         const std::vector<numeric_index_type> & send_list) const override;
+
+  virtual void localize (std::vector<T> & v_local,
+                         const std::vector<numeric_index_type> & indices) const override;
+
+  virtual void localize (const numeric_index_type first_local_idx,
+                         const numeric_index_type last_local_idx,
+                         const std::vector<numeric_index_type> & send_list) override;
+
+  virtual void localize_to_one (std::vector<T> & v_local,
+                                const processor_id_type proc_id=0) const override;
+
+  virtual void pointwise_mult (const NumericVector<T> & vec1,
+                               const NumericVector<T> & vec2) override;
+
+  virtual void create_subvector (NumericVector<T> & subvector,
+                                 const std::vector<numeric_index_type> & rows) const override;
+
+  virtual void swap (NumericVector<T> & v) override;
+
+  /**
+   * \returns The underlying Tpetra::Vector.
+   *
+   * \note This is generally not required in user-level code.
+   */
+  vector_type & vec () { libmesh_assert(_vec.get()); return *_vec; }
+
+  const vector_type & vec () const { libmesh_assert(_vec.get()); return *_vec; }
+
+  /**
+   * \returns The map distributing this vector.
+   */
+  Teuchos::RCP<const map_type> map () const { return _map; }
+
+private:
+
+  /**
+   * Adds or inserts the values stashed for entries owned by other
+   * processors, depending on \p add.
+   */
+  void communicate_nonlocal (const bool add);
+
+  /**
+   * Adds (if \p add) or inserts the \p n \p values at global
+   * \p indices.  Values for entries we don't own are stashed until
+   * the next close().
+   */
+  void input_values (const std::size_t n,
+                     const numeric_index_type * indices,
+                     const T * values,
+                     const bool add);
+
+  /**
+   * Fills \p values with our entries at the global \p indices,
+   * wherever those are owned.  This must be called on all processors
+   * at once.
+   */
+  void import_values (const std::vector<numeric_index_type> & indices,
+                      std::vector<T> & values) const;
+
+  /**
+   * The Tpetra vector holding the entries.
+   */
+  Teuchos::RCP<vector_type> _vec;
+
+  /**
+   * The distributed map of \p _vec.
+   */
+  Teuchos::RCP<const map_type> _map;
+
+  /**
+   * Our first global index, and the number we own.
+   */
+  numeric_index_type _first_local_index;
+  numeric_index_type _local_size;
+
+  /**
+   * Indices and values written since the last close() for entries
+   * owned by other processors.
+   */
+  std::vector<numeric_index_type> _nonlocal_indices;
+  std::vector<T> _nonlocal_values;
+
+  /**
+   * Keep track of whether the last write operation on this vector was
+   * nothing (0) or an insert (1) or an add (2), so we can decide how
+   * to communicate nonlocal values in close().
+   */
+  unsigned char _last_edit;
+};
+
+
+/*----------------------- Inline functions ----------------------------------*/
+
+
+
+template <typename T>
+inline
+TpetraVector<T>::TpetraVector (const Parallel::Communicator & comm,
+                               const ParallelType type) :
+  NumericVector<T>(comm, type),
+  _first_local_index(0),
+  _local_size(0),
+  _last_edit(0)
+{
+  this->_type = type;
+}
+
+
+
+template <typename T>
+inline
+TpetraVector<T>::TpetraVector (const Parallel::Communicator & comm,
+                               const numeric_index_type n,
+                               const ParallelType type) :
+  NumericVector<T>(comm, type),
+  _first_local_index(0),
+  _local_size(0),
+  _last_edit(0)
+{
+  this->init(n, n, false, type);
+}
+
+
+
+template <typename T>
+inline
+TpetraVector<T>::TpetraVector (const Parallel::Communicator & comm,
+                               const numeric_index_type n,
+                               const numeric_index_type n_local,
+                               const ParallelType type) :
+  NumericVector<T>(comm, type),
+  _first_local_index(0),
+  _local_size(0),
+  _last_edit(0)
+{
+  this->init(n, n_local, false, type);
+}
+
+
+
+template <typename T>
+inline
+TpetraVector<T>::TpetraVector (const Parallel::Communicator & comm,
+                               const numeric_index_type n,
+                               const numeric_index_type n_local,
+                               const std::vector<numeric_index_type> & ghost,
+                               const ParallelType type) :
+  NumericVector<T>(comm, AUTOMATIC),
+  _first_local_index(0),
+  _local_size(0),
+  _last_edit(0)
+{
+  this->init(n, n_local, ghost, false, type);
+}
+
+
+
+template <typename T>
+inline
+void TpetraVector<T>::init (const NumericVector<T> & other,
+                            const bool fast)
+{
+  this->init(other.size(),other.local_size(),fast,other.type());
+}
+
+
+
+template <typename T>
+inline
+void TpetraVector<T>::init (const numeric_index_type n,
+                            const numeric_index_type n_local,
+                            const std::vector<numeric_index_type> & /*ghost*/,
+                            const bool fast,
+                            const ParallelType type)
+{
+  // As with Epetra, a GHOSTED vector becomes a SERIAL one below
+  this->init(n, n_local, fast, type);
+}
+
+
+
+template <typename T>
+inline
+void TpetraVector<T>::init (const numeric_index_type n,
+                            const bool fast,
+                            const ParallelType type)
+{
+  this->init(n,n,fast,type);
+}
+
+
+
+template <typename T>
+inline
+void TpetraVector<T>::clear ()
+{
+  _vec = Teuchos::null;
+  _map = Teuchos::null;
+  _first_local_index = _local_size = 0;
+  _nonlocal_indices.clear();
+  _nonlocal_values.clear();
+  _last_edit = 0;
+
+  this->_is_closed = this->_is_initialized = false;
+}
+
+
+
+template <typename T>
+inline
+void TpetraVector<T>::zero ()
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert (this->closed());
+
+  _vec->putScalar(T(0));
+}
+
+
+
+template <typename T>
+inline
+std::unique_ptr<NumericVector<T>> TpetraVector<T>::zero_clone () const
+{
+  NumericVector<T> * cloned_vector = new TpetraVector<T>(this->comm(), AUTOMATIC);
+  cloned_vector->init(*this);
+  return std::unique_ptr<NumericVector<T>>(cloned_vector);
+}
+
+
+
+template <typename T>
+inline
+std::unique_ptr<NumericVector<T>> TpetraVector<T>::clone () const
+{
+  NumericVector<T> * cloned_vector = new TpetraVector<T>(this->comm(), AUTOMATIC);
+  cloned_vector->init(*this, true);
+  *cloned_vector = *this;
+  return std::unique_ptr<NumericVector<T>>(cloned_vector);
+}
+
+
+
+template <typename T>
+inline
+numeric_index_type TpetraVector<T>::size () const
+{
+  libmesh_assert (this->initialized());
+
+  return cast_int<numeric_index_type>(_vec->getGlobalLength());
+}
+
+
+
+template <typename T>
+inline
+numeric_index_type TpetraVector<T>::local_size () const
+{
+  libmesh_assert (this->initialized());
+
+  return _local_size;
+}
+
+
+
+template <typename T>
+inline
+numeric_index_type TpetraVector<T>::first_local_index () const
+{
+  libmesh_assert (this->initialized());
+
+  return _first_local_index;
+}
+
+
+
+template <typename T>
+inline
+numeric_index_type TpetraVector<T>::last_local_index () const
+{
+  libmesh_assert (this->initialized());
+
+  return _first_local_index + _local_size;
+}
+
+
+
+template <typename T>
+inline
+T TpetraVector<T>::operator() (const numeric_index_type i) const
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert ( ((i >= this->first_local_index()) &&
+                    (i <  this->last_local_index())) );
+
+  return _vec->getData()[i - _first_local_index];
+}
+
+
+
+template <typename T>
+inline
+void TpetraVector<T>::swap (NumericVector<T> & other)
+{
+  NumericVector<T>::swap(other);
+
+  TpetraVector<T> & v = cast_ref<TpetraVector<T> &>(other);
+
+  std::swap(_vec, v._vec);
+  std::swap(_map, v._map);
+  std::swap(_first_local_index, v._first_local_index);
+  std::swap(_local_size, v._local_size);
+  _nonlocal_indices.swap(v._nonlocal_indices);
+  _nonlocal_values.swap(v._nonlocal_values);
+  std::swap(_last_edit, v._last_edit);
+}
+
+} // namespace libMesh
+
+
+#endif // #ifdef LIBMESH_TRILINOS_HAVE_TPETRA_SOLVERS
+#endif // LIBMESH_TRILINOS_TPETRA_VECTOR_H
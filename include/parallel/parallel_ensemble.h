@@ -0,0 +1,131 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_PARALLEL_ENSEMBLE_H
+#define LIBMESH_PARALLEL_ENSEMBLE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class ReplicatedMesh;
+class UnstructuredMesh;
+
+namespace Parallel
+{
+
+/**
+ * Runs an ensemble of independent samples, e.g. of a parameter
+ * study, by splitting a communicator into groups of processors, each
+ * of which solves one sample at a time on its own group communicator.
+ *
+ * With dynamic scheduling the first processor of the communicator
+ * joins no group, and instead hands out the next sample to each group
+ * as it finishes the last, which balances samples of uneven cost.
+ * With static scheduling, or on a single processor, every processor
+ * works and sample i goes to group i % n_groups().
+ *
+ * The result of each sample, a vector of values returned by the
+ * sample function on the group, is gathered onto every processor.
+ *
+ * \brief Runs independent samples on groups of processors.
+ */
+class Ensemble : public ParallelObject
+{
+public:
+
+  /**
+   * The function to run per sample: it takes the group communicator
+   * and the sample number, and returns the sample's results.  It is
+   * called on every processor of the group, and the results from the
+   * first processor of the group are kept.
+   */
+  typedef std::function<std::vector<Real> (const Parallel::Communicator &, unsigned int)> SampleFunction;
+
+  /**
+   * Constructor.  Splits \p comm_in into \p n_groups groups of
+   * contiguous processors; there must be at least one processor per
+   * group, plus one for the dispatcher if \p dynamic_scheduling is
+   * set and \p comm_in has more than one processor.
+   */
+  Ensemble (const Parallel::Communicator & comm_in,
+            processor_id_type n_groups,
+            bool dynamic_scheduling = true);
+
+  /**
+   * \returns The number of groups.
+   */
+  processor_id_type n_groups () const { return _n_groups; }
+
+  /**
+   * \returns The group this processor works in, or n_groups() on
+   * the dispatcher.
+   */
+  processor_id_type group () const { return _group; }
+
+  /**
+   * \returns The communicator of this processor's group.
+   */
+  const Parallel::Communicator & group_comm () const { return _group_comm; }
+
+  /**
+   * \returns A copy of the serialized \p mesh distributed across this
+   * processor's group.  Each processor copies its own mesh, so making
+   * the copies takes no communication outside the groups.
+   *
+   * This must be called on every processor of comm().
+   */
+  std::unique_ptr<ReplicatedMesh> replicate_mesh (const UnstructuredMesh & mesh) const;
+
+  /**
+   * Runs \p sample on samples 0 through \p n_samples - 1 and
+   * \returns the results of each, on every processor.
+   *
+   * This must be called on every processor of comm().
+   */
+  std::vector<std::vector<Real>> run (unsigned int n_samples,
+                                      const SampleFunction & sample) const;
+
+private:
+
+  /**
+   * Whether the first processor dispatches samples instead of working
+   */
+  bool _dispatching;
+
+  processor_id_type _n_groups;
+
+  processor_id_type _group;
+
+  Parallel::Communicator _group_comm;
+};
+
+} // namespace Parallel
+
+} // namespace libMesh
+
+#endif // LIBMESH_PARALLEL_ENSEMBLE_H
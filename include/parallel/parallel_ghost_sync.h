@@ -33,6 +33,8 @@
 
 // C++ includes
 #include <map> // FIXME - pid > comm.size() breaks with unordered_map
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 
@@ -232,6 +234,95 @@ struct SyncEverything
 
 
 
+namespace Private {
+
+// Lets SyncPair report whether either of its functors changed
+// anything, whether or not their act_on_data() returns that
+template <typename SyncFunctor, typename IdType, typename DatumType>
+inline
+auto sync_act_on_data (SyncFunctor & sync,
+                       const std::vector<IdType> & ids,
+                       const std::vector<DatumType> & data)
+  -> typename std::enable_if
+  <std::is_same<decltype(sync.act_on_data(ids, data)), bool>::value, bool>::type
+{
+  return sync.act_on_data(ids, data);
+}
+
+template <typename SyncFunctor, typename IdType, typename DatumType>
+inline
+auto sync_act_on_data (SyncFunctor & sync,
+                       const std::vector<IdType> & ids,
+                       const std::vector<DatumType> & data)
+  -> typename std::enable_if
+  <!std::is_same<decltype(sync.act_on_data(ids, data)), bool>::value, bool>::type
+{
+  sync.act_on_data(ids, data);
+  return false;
+}
+
+} // end namespace Private
+
+
+
+/**
+ * Sync functor combining two others, so that the data of both is
+ * exchanged in a single round of requests and responses rather than
+ * one round each.  Both functors must be usable with the same sync_*
+ * function and must not depend on each other's results; nest
+ * SyncPair objects to combine more than two.  act_on_data() is
+ * applied to \p sync1 first, and reports whether either functor
+ * changed its data, which functors returning void are assumed not to
+ * have done.
+ */
+template <typename SyncFunctor1, typename SyncFunctor2>
+struct SyncPair
+{
+  typedef std::pair<typename SyncFunctor1::datum,
+                    typename SyncFunctor2::datum> datum;
+
+  SyncPair(SyncFunctor1 & _sync1, SyncFunctor2 & _sync2) :
+    sync1(_sync1), sync2(_sync2) {}
+
+  SyncFunctor1 & sync1;
+  SyncFunctor2 & sync2;
+
+  template <typename IdType>
+  void gather_data (const std::vector<IdType> & ids,
+                    std::vector<datum> & data)
+  {
+    std::vector<typename SyncFunctor1::datum> data1;
+    std::vector<typename SyncFunctor2::datum> data2;
+    sync1.gather_data(ids, data1);
+    sync2.gather_data(ids, data2);
+    libmesh_assert_equal_to(data1.size(), ids.size());
+    libmesh_assert_equal_to(data2.size(), ids.size());
+
+    data.resize(ids.size());
+    for (auto i : index_range(ids))
+      data[i] = std::make_pair(data1[i], data2[i]);
+  }
+
+  template <typename IdType>
+  bool act_on_data (const std::vector<IdType> & ids,
+                    const std::vector<datum> & data)
+  {
+    std::vector<typename SyncFunctor1::datum> data1(data.size());
+    std::vector<typename SyncFunctor2::datum> data2(data.size());
+    for (auto i : index_range(data))
+      {
+        data1[i] = data[i].first;
+        data2[i] = data[i].second;
+      }
+
+    const bool changed1 = Private::sync_act_on_data(sync1, ids, data1);
+    const bool changed2 = Private::sync_act_on_data(sync2, ids, data2);
+    return changed1 || changed2;
+  }
+};
+
+
+
 template <typename Iterator,
           typename DofObjType,
           typename SyncFunctor>
@@ -55,6 +55,20 @@ template <typename KeyType, typename IdxType=unsigned int>
 class Sort : public ParallelObject
 {
 public:
+  /**
+   * How to choose which processor's bin each key belongs in.
+   *
+   * BIN_SORT refines a global histogram of the keys between their
+   * global minimum and maximum until the bins are balanced, which
+   * takes several rounds of global reductions.
+   *
+   * SAMPLE_SORT gathers regularly spaced samples of every
+   * processor's sorted keys in a single allgather and splits the
+   * keys between the sorted samples, so no bin holds much more than
+   * twice its share of the keys however they are distributed.
+   */
+  enum Method { BIN_SORT, SAMPLE_SORT };
+
   /**
    * Constructor takes the number of processors,
    * the processor id, and a reference to a vector of data
@@ -64,7 +78,8 @@ public:
    * where n is the length of the vector.
    */
   Sort (const Parallel::Communicator & comm,
-        std::vector<KeyType> & d);
+        std::vector<KeyType> & d,
+        Method method = BIN_SORT);
 
 
   /**
@@ -99,6 +114,11 @@ private:
    */
   bool _bin_is_sorted;
 
+  /**
+   * The algorithm used to bin the keys.
+   */
+  const Method _method;
+
   /**
    * The raw, unsorted data which will need to
    * be sorted (in parallel) across all
@@ -128,6 +148,12 @@ private:
    */
   void binsort ();
 
+  /**
+   * Sorts the local data into bins across all processors by
+   * regular sampling, for the SAMPLE_SORT method.
+   */
+  void samplesort ();
+
   /**
    * Communicates the bins from each processor to the
    * appropriate processor.  By the time this function
@@ -168,6 +168,19 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * Constructor.  Takes the subrange [first,last) of \p r, with the
+   * same grain size.  This is how the pthread implementation of
+   * \p parallel_for divides a range between threads.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last):
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
@@ -220,7 +233,7 @@ public:
   /**
    * \returns The size of the range.
    */
-  int size () const { return (_end -_begin); }
+  std::size_t size () const { return (_end -_begin); }
 
   //------------------------------------------------------------------------
   // Methods that implement Range concept
@@ -245,6 +258,97 @@ private:
 
 
 
+/**
+ * Ranges of indices shorter than this are handled by a single thread
+ * in \p blocked_for() and \p blocked_reduce(); splitting them would
+ * cost more than the work itself.
+ */
+static const std::size_t min_blocked_size = 16384;
+
+/**
+ * The \p parallel_for body used by \p blocked_for().
+ */
+template <typename T, typename Func>
+class BlockedForBody
+{
+public:
+  explicit BlockedForBody (const Func & f) : _f(f) {}
+
+  void operator() (const BlockedRange<T> & range) const
+  { _f(range.begin(), range.end()); }
+
+private:
+  const Func & _f;
+};
+
+/**
+ * The \p parallel_reduce body used by \p blocked_reduce().
+ */
+template <typename T, typename R, typename Func, typename Join>
+class BlockedReduceBody
+{
+public:
+  BlockedReduceBody (const R & identity, const Func & f, const Join & join) :
+    result(identity), _identity(identity), _f(f), _join(join) {}
+
+  BlockedReduceBody (BlockedReduceBody & other, Threads::split) :
+    result(other._identity), _identity(other._identity),
+    _f(other._f), _join(other._join) {}
+
+  void operator() (const BlockedRange<T> & range)
+  { result = _join(result, _f(range.begin(), range.end())); }
+
+  void join (const BlockedReduceBody & other)
+  { result = _join(result, other.result); }
+
+  R result;
+
+private:
+  const R _identity;
+  const Func & _f;
+  const Join & _join;
+};
+
+/**
+ * Calls \p f(begin, end) on subranges which together make up
+ * [first, last), on as many threads as are worthwhile.  Short ranges,
+ * and calls from code which is already threaded, are handled
+ * serially in one call.  \p f should loop over its subrange with a
+ * plain index, which gives the compiler its best chance to vectorize.
+ */
+template <typename T, typename Func>
+inline
+void blocked_for (const T first, const T last, const Func & f)
+{
+  if (in_threads || std::size_t(last - first) < min_blocked_size)
+    f(first, last);
+  else
+    parallel_for (BlockedRange<T>(first, last, min_blocked_size/4),
+                  BlockedForBody<T, Func>(f));
+}
+
+/**
+ * \returns The combination, with \p join, of the results of \p
+ * f(begin, end) on subranges which together make up [first, last),
+ * computed on as many threads as are worthwhile as in \p
+ * blocked_for().  Since the subranges depend on the number of
+ * threads, so may the roundoff in a floating point reduction.
+ */
+template <typename T, typename R, typename Func, typename Join>
+inline
+R blocked_reduce (const T first, const T last, const R & identity,
+                  const Func & f, const Join & join)
+{
+  if (in_threads || std::size_t(last - first) < min_blocked_size)
+    return join(identity, f(first, last));
+
+  BlockedReduceBody<T, R, Func, Join> body(identity, f, join);
+  parallel_reduce (BlockedRange<T>(first, last, min_blocked_size/4), body);
+  return body.result;
+}
+
+
+
 /**
  * A convenient spin mutex object which can be used for obtaining locks.
  */
@@ -28,6 +28,12 @@
 
 // C++ includes
 #ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <exception>
+# include <memory>
+# include <mutex>
 # include <thread>
 #endif
 
@@ -44,6 +50,13 @@
 #  endif
 #endif
 
+// Without OpenMP, which schedules loops itself, we run loops on a
+// persistent work-stealing thread pool whenever std::thread is
+// available.
+#if defined(LIBMESH_HAVE_CXX11_THREAD) && !LIBMESH_HAVE_OPENMP
+#  define LIBMESH_USE_TASK_POOL 1
+#endif
+
 // Thread-Local-Storage macros
 #ifdef LIBMESH_HAVE_CXX11_THREAD
 #  define LIBMESH_TLS_TYPE(type)  thread_local type
@@ -259,6 +272,344 @@ class split {};
 
 
 
+#ifdef LIBMESH_USE_TASK_POOL
+/**
+ * A persistent pool of worker threads, so that loops can run in
+ * parallel without the cost of creating threads for each loop.
+ *
+ * If libMesh is run with --pin-threads, each thread of the pool,
+ * including the thread which created it, is pinned to one of the
+ * CPUs the process was allowed to use when the pool was created.
+ */
+class TaskPool
+{
+public:
+  /**
+   * Work to be run simultaneously by every thread of the pool.
+   */
+  class Job
+  {
+  public:
+    virtual ~Job() = default;
+
+    /**
+     * Called once on each thread of the pool; \p thread_id runs from
+     * 0, for the thread calling \p TaskPool::run(), to \p
+     * n_threads()-1.  Must not throw.
+     */
+    virtual void work (unsigned int thread_id) = 0;
+  };
+
+  /**
+   * \returns The pool, which is (re)created with libMesh::n_threads()
+   * threads whenever that number changes.
+   */
+  static TaskPool & instance ();
+
+  ~TaskPool ();
+
+  /**
+   * \returns The number of threads in the pool, including the
+   * calling thread.
+   */
+  unsigned int n_threads () const
+  { return cast_int<unsigned int>(_workers.size() + 1); }
+
+  /**
+   * Runs \p job on every thread of the pool, including the calling
+   * thread, and returns once every thread has finished.
+   */
+  void run (Job & job);
+
+private:
+  explicit TaskPool (unsigned int n_threads);
+
+  void worker_loop (unsigned int thread_id);
+
+  void pin_threads ();
+
+  std::vector<std::thread> _workers;
+
+  std::mutex _mutex;
+  std::condition_variable _start;
+  std::condition_variable _finish;
+
+  Job * _job;
+  unsigned long _generation;
+  unsigned int _n_busy;
+  bool _stop;
+};
+
+
+
+/**
+ * The unfinished pieces of a range being run on a \p TaskPool, in
+ * one deque per thread.  Each thread splits the pieces it takes in
+ * half on demand, keeping one half and leaving the other at the back
+ * of its deque, until the piece it keeps is no longer divisible.
+ * Threads take work from the back of their own deque first, and
+ * otherwise steal from the front of another thread's deque, where
+ * the largest pieces are.  A thread which finds nothing to take
+ * sleeps until another piece is pushed or the last one is done.
+ */
+template <typename Range>
+class RangeQueues
+{
+public:
+  RangeQueues (const Range & range,
+               const unsigned int n_threads) :
+    _queues(n_threads),
+    _remaining(1),
+    _n_pushed(0),
+    _n_idle(0),
+    _failed(false)
+  {
+    _queues[0].pieces.emplace_back(new Range(range));
+  }
+
+  /**
+   * Calls \p f on pieces of the range on thread \p thread_id, until
+   * every piece has been run by some thread.  The first exception
+   * thrown by \p f on any thread is saved for \p rethrow(), and any
+   * pieces not yet started are then skipped.
+   */
+  template <typename Function>
+  void work (const unsigned int thread_id, Function f)
+  {
+    std::unique_ptr<Range> piece;
+
+    while (_remaining.load())
+      {
+        // Any push after this would make our search out of date
+        const std::size_t n_pushed = _n_pushed.load();
+
+        if (!this->pop(thread_id, piece) &&
+            !this->steal(thread_id, piece))
+          {
+            this->wait_for_work(n_pushed);
+            continue;
+          }
+
+        if (!_failed.load())
+          {
+            while (piece->is_divisible())
+              {
+                std::unique_ptr<Range> half(new Range(*piece, Threads::split()));
+                ++_remaining;
+                this->push(thread_id, std::move(half));
+              }
+
+            try
+              {
+                f(*piece);
+              }
+            catch (...)
+              {
+                std::lock_guard<std::mutex> lock(_exception_mutex);
+                if (!_failed.exchange(true))
+                  _exception = std::current_exception();
+              }
+          }
+
+        piece.reset();
+        if (--_remaining == 0)
+          this->wake_idle(true);
+      }
+  }
+
+  /**
+   * Rethrows the first exception thrown by any thread, if any.
+   */
+  void rethrow ()
+  {
+    if (_exception)
+      std::rethrow_exception(_exception);
+  }
+
+private:
+  void push (const unsigned int thread_id, std::unique_ptr<Range> piece)
+  {
+    {
+      Queue & q = _queues[thread_id];
+      spin_mutex::scoped_lock lock(q.mutex);
+      q.pieces.push_back(std::move(piece));
+    }
+
+    ++_n_pushed;
+    this->wake_idle(false);
+  }
+
+  /**
+   * Sleeps until a piece has been pushed since \p n_pushed pushes, or
+   * every piece has been run.
+   */
+  void wait_for_work (const std::size_t n_pushed)
+  {
+    std::unique_lock<std::mutex> lock(_idle_mutex);
+    ++_n_idle;
+    _work_available.wait(lock, [this, n_pushed]()
+                         {
+                           return !_remaining.load() ||
+                             _n_pushed.load() != n_pushed;
+                         });
+    --_n_idle;
+  }
+
+  /**
+   * Wakes one sleeping thread for a new piece, or all of them once
+   * every piece has been run.  A sleeper counts itself before it checks
+   * what it is waiting for, and we check for sleepers after changing
+   * that, so one of us always sees the other.
+   */
+  void wake_idle (const bool all)
+  {
+    if (!_n_idle.load())
+      return;
+
+    std::lock_guard<std::mutex> lock(_idle_mutex);
+    if (all)
+      _work_available.notify_all();
+    else
+      _work_available.notify_one();
+  }
+
+  bool pop (const unsigned int thread_id, std::unique_ptr<Range> & piece)
+  {
+    Queue & q = _queues[thread_id];
+    spin_mutex::scoped_lock lock(q.mutex);
+    if (q.pieces.empty())
+      return false;
+    piece = std::move(q.pieces.back());
+    q.pieces.pop_back();
+    return true;
+  }
+
+  bool steal (const unsigned int thread_id, std::unique_ptr<Range> & piece)
+  {
+    const std::size_t n = _queues.size();
+    for (std::size_t i = 1; i != n; ++i)
+      {
+        Queue & q = _queues[(thread_id + i) % n];
+        spin_mutex::scoped_lock lock(q.mutex);
+        if (!q.pieces.empty())
+          {
+            piece = std::move(q.pieces.front());
+            q.pieces.pop_front();
+            return true;
+          }
+      }
+    return false;
+  }
+
+  struct Queue
+  {
+    spin_mutex mutex;
+    std::deque<std::unique_ptr<Range>> pieces;
+  };
+
+  std::vector<Queue> _queues;
+
+  /**
+   * The number of pieces which have been created but not yet run.
+   */
+  std::atomic<std::size_t> _remaining;
+
+  /**
+   * The number of pieces pushed so far, and of threads sleeping
+   * until the next push, with what they sleep on.
+   */
+  std::atomic<std::size_t> _n_pushed;
+  std::atomic<unsigned int> _n_idle;
+  std::mutex _idle_mutex;
+  std::condition_variable _work_available;
+
+  std::atomic<bool> _failed;
+  std::mutex _exception_mutex;
+  std::exception_ptr _exception;
+};
+
+
+
+/**
+ * A \p TaskPool job running \p body on every piece of a range.
+ */
+template <typename Range, typename Body>
+class ParallelForJob : public TaskPool::Job
+{
+public:
+  ParallelForJob (const Range & range,
+                  const Body & body,
+                  const unsigned int n_threads) :
+    _queues(range, n_threads),
+    _body(body)
+  {}
+
+  virtual void work (unsigned int thread_id) override
+  {
+    _queues.work(thread_id, [this](const Range & piece) { _body(piece); });
+  }
+
+  void rethrow () { _queues.rethrow(); }
+
+private:
+  RangeQueues<Range> _queues;
+  const Body & _body;
+};
+
+
+
+/**
+ * A \p TaskPool job running a reduction on every piece of a range,
+ * using one copy of the body per thread.  Thread 0 uses the original
+ * body.
+ */
+template <typename Range, typename Body>
+class ParallelReduceJob : public TaskPool::Job
+{
+public:
+  ParallelReduceJob (const Range & range,
+                     Body & body,
+                     const unsigned int n_threads) :
+    _queues(range, n_threads),
+    _bodies(n_threads)
+  {
+    _bodies[0] = &body;
+    for (unsigned int i=1; i<n_threads; i++)
+      _bodies[i] = new Body(body, Threads::split());
+  }
+
+  ~ParallelReduceJob ()
+  {
+    for (std::size_t i=1; i<_bodies.size(); i++)
+      delete _bodies[i];
+  }
+
+  virtual void work (unsigned int thread_id) override
+  {
+    Body & body = *_bodies[thread_id];
+    _queues.work(thread_id, [&body](const Range & piece) { body(piece); });
+  }
+
+  /**
+   * Joins every thread's results down to the original body, or
+   * rethrows the first exception thrown by any thread.
+   */
+  void finish ()
+  {
+    _queues.rethrow();
+
+    for (std::size_t i=_bodies.size()-1; i != 0; i--)
+      _bodies[i-1]->join(*_bodies[i]);
+  }
+
+private:
+  RangeQueues<Range> _queues;
+  std::vector<Body *> _bodies;
+};
+#endif // LIBMESH_USE_TASK_POOL
+
+
+
 
 //-------------------------------------------------------------------
 /**
@@ -278,12 +629,20 @@ void parallel_for (const Range & range, const Body & body)
     return;
   }
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_CXX11_THREAD)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
     libMesh::perflog.disable_logging();
 #endif
+
+#ifdef LIBMESH_USE_TASK_POOL
+  TaskPool & pool = TaskPool::instance();
+  ParallelForJob<Range, Body> job(range, body, pool.n_threads());
+  pool.run(job);
+
+  job.rethrow();
+#else
   unsigned int n_threads = num_pthreads(range);
 
   std::vector<Range *> ranges(n_threads);
@@ -347,10 +706,11 @@ void parallel_for (const Range & range, const Body & body)
   for (unsigned int i=0; i<n_threads; i++)
     delete ranges[i];
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_CXX11_THREAD)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
+#endif // LIBMESH_USE_TASK_POOL
 }
 
 /**
@@ -381,13 +741,20 @@ void parallel_reduce (const Range & range, Body & body)
     return;
   }
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_CXX11_THREAD)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
     libMesh::perflog.disable_logging();
 #endif
 
+#ifdef LIBMESH_USE_TASK_POOL
+  TaskPool & pool = TaskPool::instance();
+  ParallelReduceJob<Range, Body> job(range, body, pool.n_threads());
+  pool.run(job);
+
+  job.finish();
+#else
   unsigned int n_threads = num_pthreads(range);
 
   std::vector<Range *> ranges(n_threads);
@@ -463,10 +830,11 @@ void parallel_reduce (const Range & range, Body & body)
   for (unsigned int i=0; i<n_threads; i++)
     delete ranges[i];
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_CXX11_THREAD)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
+#endif // LIBMESH_USE_TASK_POOL
 }
 
 /**
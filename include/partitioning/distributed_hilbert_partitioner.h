@@ -0,0 +1,86 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_HILBERT_PARTITIONER_H
+#define LIBMESH_DISTRIBUTED_HILBERT_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
+
+namespace libMesh
+{
+
+/**
+ * The \p DistributedHilbertPartitioner splits a Hilbert curve through
+ * the element centroids into equal stretches, one for each part.
+ *
+ * Unlike the \p SFCPartitioner, it does not need the sfcurves library
+ * or a serial mesh: each processor computes the curve keys of its own
+ * elements, the keys are sorted in parallel, and the new processor
+ * ids are sent back to the elements' owners, so the work and memory
+ * on each processor scale with its share of the mesh.  That makes it
+ * a cheap alternative to ParMETIS for very large distributed meshes,
+ * at the price of a worse edge cut.
+ *
+ * With weights attached, the stretches have equal total weight
+ * rather than equal numbers of elements.
+ *
+ * \note Without the libHilbert library, or without MPI, the curve
+ * degenerates to the order the elements are stored in.
+ *
+ * \brief Partitions a distributed mesh along a Hilbert curve.
+ */
+class DistributedHilbertPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Ctors, assignment operators, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  DistributedHilbertPartitioner () = default;
+  DistributedHilbertPartitioner (const DistributedHilbertPartitioner &) = default;
+  DistributedHilbertPartitioner (DistributedHilbertPartitioner &&) = default;
+  DistributedHilbertPartitioner & operator= (const DistributedHilbertPartitioner &) = default;
+  DistributedHilbertPartitioner & operator= (DistributedHilbertPartitioner &&) = default;
+  virtual ~DistributedHilbertPartitioner() = default;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return libmesh_make_unique<DistributedHilbertPartitioner>(*this);
+  }
+
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
+protected:
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+};
+
+} // namespace libMesh
+
+#endif  // LIBMESH_DISTRIBUTED_HILBERT_PARTITIONER_H
@@ -81,6 +81,22 @@ public:
     return libmesh_make_unique<ParmetisPartitioner>(*this);
   }
 
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
+  /**
+   * By default repartition() finds a new partitioning independent of
+   * the current one.  Setting \p itr > 0 makes it start from the
+   * current processor ids instead, when partitioning into as many
+   * parts as there are processors, and have ParMETIS trade the edge
+   * cut off against how much data moves: \p itr is the ratio of the
+   * time spent communicating during the computation to the time
+   * spent redistributing elements, so smaller values move fewer
+   * elements for a larger edge cut.  ParMETIS suggests values around
+   * 1000.  Elements moved are charged by their attached weights, if
+   * any.  Setting \p itr back to 0 restores the default.
+   */
+  void set_migration_cost (Real itr) { _itr = itr; }
+
 
 protected:
 
@@ -115,6 +131,13 @@ private:
    */
   void initialize (const MeshBase & mesh, const unsigned int n_sbdmns);
 
+  /**
+   * \returns Whether we are to partition \p mesh into \p n_sbdmns
+   * parts starting from its current partitioning.
+   */
+  bool minimize_migration (const MeshBase & mesh,
+                           const unsigned int n_sbdmns) const;
+
   /**
    * Pointer to the Parmetis-specific data structures.  Lets us avoid
    * including parmetis.h here.
@@ -122,6 +145,14 @@ private:
   std::unique_ptr<ParmetisHelper> _pmetis;
 
 #endif
+
+private:
+
+  /**
+   * The ratio of communication to redistribution time we minimize
+   * migration for, or 0 if we don't.
+   */
+  Real _itr;
 };
 
 } // namespace libMesh
@@ -35,6 +35,7 @@ namespace libMesh
 {
 
 // Forward Declarations
+class EquationSystems;
 class ErrorVector;
 
 /**
@@ -202,6 +203,23 @@ public:
    */
   virtual void attach_weights(ErrorVector * /*weights*/) { libmesh_not_implemented(); }
 
+  /**
+   * Fills \p weights, suitably for attach_weights(), with an estimate
+   * of the assembly work on each active element of the mesh of \p
+   * es.  For each system this is the number of points in the
+   * quadrature rule its variables would use, at the element's p
+   * level, times the square of the number of dofs on the element, so
+   * that elements with more variables on them, higher order
+   * variables, or more p refinement weigh more.  The weights are
+   * scaled so that the cheapest element weighs 1, and rounded to
+   * integers for the graph partitioners.
+   *
+   * This must be called on all processors at once, after the dofs
+   * of \p es have been distributed.
+   */
+  static void compute_dof_weights (const EquationSystems & es,
+                                   ErrorVector & weights);
+
 protected:
 
   /**
@@ -68,6 +68,14 @@ public:
     return libmesh_make_unique<SFCPartitioner>(*this);
   }
 
+  /**
+   * Attach weights, with which to split the curve into stretches of
+   * equal weight rather than of equal numbers of elements.  Without
+   * the sfcurves library, when we fall back on a linear
+   * partitioning, the weights are ignored.
+   */
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
   /**
    * Sets the type of space-filling curve to use.  Valid types are
    * "Hilbert" (the default) and "Morton".
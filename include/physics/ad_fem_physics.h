@@ -0,0 +1,291 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_AD_FEM_PHYSICS_H
+#define LIBMESH_AD_FEM_PHYSICS_H
+
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_HAVE_METAPHYSICL
+
+// Local Includes
+#include "libmesh/compare_types.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/fe_base.h"
+#include "libmesh/fem_context.h"
+#include "libmesh/fem_physics.h"
+#include "libmesh/vector_value.h"
+
+// FIXME - having to do this with MetaPhysicL brings me shame - RHS
+#include "libmesh/ignore_warnings.h"
+#include "metaphysicl/dualnumber.h"
+#include "metaphysicl/numberarray.h"
+#include "libmesh/restore_warnings.h"
+
+namespace libMesh
+{
+
+/**
+ * This class computes element and side Jacobians by forward mode
+ * automatic differentiation of residuals, rather than requiring
+ * hand-coded Jacobians or finite differencing them.
+ *
+ * The class \p Derived (this is a "curiously recurring template")
+ * implements any of the member function templates
+ *
+ * \code
+ * template <typename T>
+ * void element_time_residual (FEMContext & c,
+ *                             const DenseVector<T> & U,
+ *                             DenseVector<T> & F);
+ * \endcode
+ *
+ * \p element_constraint_residual, \p side_time_residual and \p
+ * side_constraint_residual, which add to \p F the residual of the
+ * corresponding DifferentiablePhysics term given the element solution
+ * \p U.  Residual-only assemblies evaluate them with \p T = \p
+ * Number, and those needing a Jacobian with \p T = \p ADNumber, a
+ * dual number carrying the derivatives with respect to every element
+ * degree of freedom.  The interior_value(), interior_gradient(),
+ * side_value() and side_gradient() helpers evaluate variables from
+ * \p U on either type.
+ *
+ * The derivatives are stored in a fixed size array of \p N entries,
+ * so that their arithmetic is easily vectorized; \p N must be at
+ * least the number of degrees of freedom on each element.  Elements
+ * with more are left to the system's finite differenced Jacobian.
+ *
+ * \p Base is \p FEMPhysics for a physics object to be attached to a
+ * system, or \p FEMSystem for a system defining its own physics.
+ *
+ * The helpers use the phi and dphi of each FE object, so those
+ * must be requested by \p init_context() as usual.
+ */
+template <typename Derived, unsigned int N, typename Base = FEMPhysics>
+class ADFEMPhysics : public Base
+{
+public:
+
+  /**
+   * The type of the derivatives of each residual entry.
+   */
+  typedef MetaPhysicL::NumberArray<N, Number> ADDerivatives;
+
+  /**
+   * The scalar type on which Jacobian assembly evaluates residuals.
+   */
+  typedef MetaPhysicL::DualNumber<Number, ADDerivatives> ADNumber;
+
+  /**
+   * Passes any constructor arguments on to \p Base.
+   */
+  using Base::Base;
+
+  virtual bool element_time_derivative (bool request_jacobian,
+                                        DiffContext & context) override
+  { return this->_assemble(ELEMENT_TIME, request_jacobian, context); }
+
+  virtual bool element_constraint (bool request_jacobian,
+                                   DiffContext & context) override
+  { return this->_assemble(ELEMENT_CONSTRAINT, request_jacobian, context); }
+
+  virtual bool side_time_derivative (bool request_jacobian,
+                                     DiffContext & context) override
+  { return this->_assemble(SIDE_TIME, request_jacobian, context); }
+
+  virtual bool side_constraint (bool request_jacobian,
+                                DiffContext & context) override
+  { return this->_assemble(SIDE_CONSTRAINT, request_jacobian, context); }
+
+  /**
+   * The residual terms, which add nothing unless hidden by \p
+   * Derived.
+   */
+  template <typename T>
+  void element_time_residual (FEMContext &, const DenseVector<T> &, DenseVector<T> &) {}
+
+  template <typename T>
+  void element_constraint_residual (FEMContext &, const DenseVector<T> &, DenseVector<T> &) {}
+
+  template <typename T>
+  void side_time_residual (FEMContext &, const DenseVector<T> &, DenseVector<T> &) {}
+
+  template <typename T>
+  void side_constraint_residual (FEMContext &, const DenseVector<T> &, DenseVector<T> &) {}
+
+  /**
+   * \returns The value of variable \p var, given the element solution
+   * \p U, at interior quadrature point \p qp.
+   */
+  template <typename T>
+  static T interior_value (const FEMContext & c, const DenseVector<T> & U,
+                           unsigned int var, unsigned int qp)
+  {
+    FEBase * fe = nullptr;
+    c.get_element_fe(var, fe);
+    return fe_value(*fe, c, U, var, qp);
+  }
+
+  /**
+   * \returns The gradient of variable \p var, given the element
+   * solution \p U, at interior quadrature point \p qp.
+   */
+  template <typename T>
+  static VectorValue<T> interior_gradient (const FEMContext & c, const DenseVector<T> & U,
+                                           unsigned int var, unsigned int qp)
+  {
+    FEBase * fe = nullptr;
+    c.get_element_fe(var, fe);
+    return fe_gradient(*fe, c, U, var, qp);
+  }
+
+  /**
+   * \returns The value of variable \p var, given the element solution
+   * \p U, at side quadrature point \p qp.
+   */
+  template <typename T>
+  static T side_value (const FEMContext & c, const DenseVector<T> & U,
+                       unsigned int var, unsigned int qp)
+  {
+    FEBase * fe = nullptr;
+    c.get_side_fe(var, fe);
+    return fe_value(*fe, c, U, var, qp);
+  }
+
+  /**
+   * \returns The gradient of variable \p var, given the element
+   * solution \p U, at side quadrature point \p qp.
+   */
+  template <typename T>
+  static VectorValue<T> side_gradient (const FEMContext & c, const DenseVector<T> & U,
+                                       unsigned int var, unsigned int qp)
+  {
+    FEBase * fe = nullptr;
+    c.get_side_fe(var, fe);
+    return fe_gradient(*fe, c, U, var, qp);
+  }
+
+private:
+
+  enum Term { ELEMENT_TIME, ELEMENT_CONSTRAINT, SIDE_TIME, SIDE_CONSTRAINT };
+
+  template <typename T>
+  static T fe_value (const FEBase & fe, const FEMContext & c,
+                     const DenseVector<T> & U,
+                     unsigned int var, unsigned int qp)
+  {
+    const std::vector<std::vector<Real>> & phi = fe.get_phi();
+    const unsigned int offset = c.get_elem_solution(var).i_off();
+
+    T u = 0;
+    for (unsigned int j = 0, n_dofs = c.n_dof_indices(var); j != n_dofs; ++j)
+      u += phi[j][qp] * U(offset + j);
+    return u;
+  }
+
+  template <typename T>
+  static VectorValue<T> fe_gradient (const FEBase & fe, const FEMContext & c,
+                                     const DenseVector<T> & U,
+                                     unsigned int var, unsigned int qp)
+  {
+    const std::vector<std::vector<RealGradient>> & dphi = fe.get_dphi();
+    const unsigned int offset = c.get_elem_solution(var).i_off();
+
+    VectorValue<T> grad_u;
+    for (unsigned int j = 0, n_dofs = c.n_dof_indices(var); j != n_dofs; ++j)
+      for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+        grad_u(d) += dphi[j][qp](d) * U(offset + j);
+    return grad_u;
+  }
+
+  template <typename T>
+  void _residual (Term term, FEMContext & c,
+                  const DenseVector<T> & U, DenseVector<T> & F)
+  {
+    Derived & derived = static_cast<Derived &>(*this);
+
+    switch (term)
+      {
+      case ELEMENT_TIME:
+        derived.template element_time_residual<T>(c, U, F);
+        break;
+      case ELEMENT_CONSTRAINT:
+        derived.template element_constraint_residual<T>(c, U, F);
+        break;
+      case SIDE_TIME:
+        derived.template side_time_residual<T>(c, U, F);
+        break;
+      case SIDE_CONSTRAINT:
+        derived.template side_constraint_residual<T>(c, U, F);
+        break;
+      default:
+        libmesh_error();
+      }
+  }
+
+  bool _assemble (Term term, bool request_jacobian, DiffContext & context)
+  {
+    FEMContext & c = cast_ref<FEMContext &>(context);
+
+    const DenseVector<Number> & elem_solution = c.get_elem_solution();
+    DenseVector<Number> & elem_residual = c.get_elem_residual();
+    const unsigned int n_dofs = elem_solution.size();
+
+    // Without derivatives, or without room for them, evaluate the
+    // residual alone
+    if (!request_jacobian || n_dofs > N)
+      {
+        DenseVector<Number> F(n_dofs);
+        this->_residual(term, c, elem_solution, F);
+        elem_residual += F;
+        return false;
+      }
+
+    // Seed each degree of freedom with its own unit derivative
+    DenseVector<ADNumber> U(n_dofs), F(n_dofs);
+    for (unsigned int j = 0; j != n_dofs; ++j)
+      {
+        ADDerivatives derivs(0);
+        derivs[j] = 1;
+        U(j) = ADNumber(elem_solution(j), derivs);
+      }
+
+    this->_residual(term, c, U, F);
+
+    // The time solver tells us how the element solution depends on
+    // the unknowns it is solving for
+    const Real solution_derivative = c.get_elem_solution_derivative();
+
+    DenseMatrix<Number> & elem_jacobian = c.get_elem_jacobian();
+    for (unsigned int i = 0; i != n_dofs; ++i)
+      {
+        elem_residual(i) += F(i).value();
+        for (unsigned int j = 0; j != n_dofs; ++j)
+          elem_jacobian(i,j) += solution_derivative * F(i).derivatives()[j];
+      }
+
+    return true;
+  }
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_METAPHYSICL
+
+#endif // LIBMESH_AD_FEM_PHYSICS_H
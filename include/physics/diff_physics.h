@@ -22,6 +22,7 @@
 
 // Local Includes
 #include "libmesh/libmesh.h"
+#include "libmesh/id_types.h"
 
 // C++ includes
 #include <map>
@@ -83,6 +84,7 @@ public:
    */
   DifferentiablePhysics () :
     compute_internal_sides (false),
+    compute_interior_faces (false),
     _mesh_sys              (nullptr),
     _mesh_x_var            (libMesh::invalid_uint),
     _mesh_y_var            (libMesh::invalid_uint),
@@ -153,6 +155,44 @@ public:
    */
   bool compute_internal_sides;
 
+  /**
+   * \p compute_interior_faces is false by default.  If it is true,
+   * FEMSystem calls interior_face_time_derivative() once on each
+   * interior face between active elements, from one of the two
+   * elements, with a DGFEMContext which has been reinitialized on
+   * both sides of that face.  This is independent of
+   * \p compute_internal_sides, which lets side_time_derivative() see
+   * every interior face twice instead.
+   *
+   * FEMSystem::build_context() must then be overridden to return a
+   * DGFEMContext, and the DofMap must couple neighboring elements.
+   * Interior face terms are currently only supported by steady
+   * solvers.
+   */
+  bool compute_interior_faces;
+
+  /**
+   * If \p side_assembly_boundary_ids is not empty, side_*
+   * computations on boundary sides are only done on those sides
+   * with at least one of these boundary ids; FEMSystem skips even the
+   * side FE reinitialization on the others.  Internal sides are still
+   * governed by \p compute_internal_sides alone.
+   *
+   * This is empty by default, so that every boundary side is
+   * computed on.
+   */
+  std::set<boundary_id_type> side_assembly_boundary_ids;
+
+  /**
+   * If \p side_assembly_subdomain_ids is not empty, side_*
+   * computations are only done on the sides of elements in these
+   * subdomains.
+   *
+   * This is empty by default, so that every element's sides are
+   * computed on.
+   */
+  std::set<subdomain_id_type> side_assembly_subdomain_ids;
+
   /**
    * Adds the time derivative contribution on \p side of \p elem to
    * elem_residual.
@@ -174,6 +214,23 @@ public:
     return request_jacobian;
   }
 
+  /**
+   * Adds the time derivative contributions on an interior face, if
+   * \p compute_interior_faces is true.  The context is a DGFEMContext
+   * whose element side and neighbor side FE objects have both been
+   * reinitialized, at matching quadrature points.  Its element and
+   * neighbor residuals should both be added to, as should (if this
+   * method receives request_jacobian = true) its element-element,
+   * element-neighbor, neighbor-element and neighbor-neighbor
+   * Jacobians, rather than elem_jacobian.  If those Jacobians have
+   * not been computed then the method should return false, but
+   * FEMSystem cannot compute them numerically.
+   */
+  virtual bool interior_face_time_derivative (bool request_jacobian,
+                                              DiffContext &) {
+    return request_jacobian;
+  }
+
   /**
    * Adds the constraint contribution on \p side of \p elem to
    * elem_residual.
@@ -210,6 +210,19 @@ public:
    */
   Order get_order() const { return static_cast<Order>(_order + 2 * _p_level); }
 
+  /**
+   * \returns \p true if the points and weights of this rule depend
+   * only on its class, dimension, order, \p allow_rules_with_negative_weights
+   * and the element type and p level it is initialized for, so that
+   * init() can copy them from a global cache of previously built
+   * rules rather than rebuilding them.
+   *
+   * This is false by default; rules which share their cached points
+   * and weights must be overridden to return false by any subclass
+   * which adds more state.
+   */
+  virtual bool shares_rules() const { return false; }
+
   /**
    * Prints information relevant to the quadrature rule, by default to
    * libMesh::out.
@@ -312,6 +325,12 @@ protected:
   virtual void init_3D (const ElemType type=INVALID_ELEM,
                         unsigned int p_level=0);
 
+  /**
+   * Fills the points and weights vectors by calling the init_*D()
+   * method for our dimension.
+   */
+  void build_rule ();
+
   /**
    * Constructs a 2D rule from the tensor product of \p q1D with
    * itself.  Used in the \p init_2D() routines for quadrilateral
@@ -86,6 +86,12 @@ public:
    */
   virtual QuadratureType type() const override;
 
+  /**
+   * \returns \p false; our points and weights depend on how elements
+   * are cut.
+   */
+  virtual bool shares_rules() const override { return false; }
+
   /**
    * Overrides the base class init() function, and uses the ElemCutter to
    * subdivide the element into "inside" and "outside" subelements.
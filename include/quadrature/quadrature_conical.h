@@ -67,6 +67,11 @@ public:
    */
   virtual QuadratureType type() const override;
 
+  /**
+   * \returns \p true.
+   */
+  virtual bool shares_rules() const override { return true; }
+
 private:
 
   /**
@@ -63,6 +63,11 @@ public:
    */
   virtual QuadratureType type() const override;
 
+  /**
+   * \returns \p true.
+   */
+  virtual bool shares_rules() const override { return true; }
+
 private:
 
   virtual void init_1D (const ElemType, unsigned int) override;
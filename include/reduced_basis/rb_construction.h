@@ -198,6 +198,16 @@ public:
    */
   virtual Real compute_max_error_bound();
 
+  /**
+   * \returns The RB error bound, normalized as in get_RB_error_bound(),
+   * which \p rb_eval computes for the parameters \p mu.
+   *
+   * This doesn't touch the parameters of this object, so it may be
+   * called concurrently on distinct RBEvaluation objects.
+   */
+  Real compute_RB_error_bound(RBEvaluation & rb_eval,
+                              const RBParameters & mu);
+
   /**
    * Return the parameters chosen during the i^th step of
    * the Greedy algorithm.
@@ -767,6 +777,16 @@ protected:
    */
   virtual Real get_RB_error_bound();
 
+  /**
+   * \returns A copy of the RBEvaluation to be used by one thread
+   * while compute_max_error_bound() evaluates the training set in
+   * parallel, or nullptr if the error bounds should be evaluated
+   * serially.  The default implementation returns
+   * get_rb_evaluation().build_thread_copy(); subclasses overriding
+   * get_RB_error_bound() should override this to return nullptr.
+   */
+  virtual std::unique_ptr<RBEvaluation> build_thread_rb_evaluation();
+
   /**
    * Compute the reduced basis matrices for the current basis.
    */
@@ -73,9 +73,14 @@ public:
   virtual ~RBEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk.  If \p use_mmap is true,
+   * the file is mapped into memory and read in place rather than
+   * streamed into a heap copy first; this lets many processes loading
+   * the same file share it through the page cache.
    */
-  void read_from_file(const std::string & path, bool read_error_bound_data);
+  void read_from_file(const std::string & path,
+                      bool read_error_bound_data,
+                      bool use_mmap = false);
 
 private:
 
@@ -106,9 +111,14 @@ public:
   virtual ~TransientRBEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk.  If \p use_mmap is true,
+   * the file is mapped into memory and read in place rather than
+   * streamed into a heap copy first; this lets many processes loading
+   * the same file share it through the page cache.
    */
-  void read_from_file(const std::string & path, bool read_error_bound_data);
+  void read_from_file(const std::string & path,
+                      bool read_error_bound_data,
+                      bool use_mmap = false);
 
 private:
 
@@ -139,9 +149,13 @@ public:
   virtual ~RBEIMEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk.  If \p use_mmap is true,
+   * the file is mapped into memory and read in place rather than
+   * streamed into a heap copy first; this lets many processes loading
+   * the same file share it through the page cache.
    */
-  void read_from_file(const std::string & path);
+  void read_from_file(const std::string & path,
+                      bool use_mmap = false);
 
 private:
 
@@ -176,9 +190,13 @@ public:
   virtual ~RBSCMEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk.  If \p use_mmap is true,
+   * the file is mapped into memory and read in place rather than
+   * streamed into a heap copy first; this lets many processes loading
+   * the same file share it through the page cache.
    */
-  void read_from_file(const std::string & path);
+  void read_from_file(const std::string & path,
+                      bool use_mmap = false);
 
 private:
 
@@ -279,6 +279,12 @@ protected:
    */
   virtual Real get_RB_error_bound() override;
 
+  /**
+   * The best fit error is computed on the full order system, so this
+   * returns nullptr to keep compute_max_error_bound() serial.
+   */
+  virtual std::unique_ptr<RBEvaluation> build_thread_rb_evaluation() override;
+
   /**
    * Pre-request FE data needed for calculations.
    */
@@ -351,6 +357,44 @@ private:
    * The point locator tolerance.
    */
   Real _point_locator_tol;
+
+  /**
+   * Brings _interpolation_point_data up to date with the
+   * interpolation points in the RBEIMEvaluation.
+   */
+  void cache_interpolation_points();
+
+  /**
+   * \returns This processor's share of the value at interpolation
+   * point \p i of the vector in _ghosted_meshfunction_vector; summing
+   * over all processors gives the value.  This uses the data cached
+   * by cache_interpolation_points(), so no point location is needed.
+   *
+   * This must be called on all processors at once.
+   */
+  Number interpolation_point_contribution(unsigned int i);
+
+  /**
+   * What we need to evaluate a vector at an interpolation point: the
+   * processor owning the element it was found in, and there the FE
+   * shape function values at the point and the dof indices for the
+   * variable.  The element and point are kept to check that the
+   * interpolation point hasn't changed.
+   *
+   * Interpolation points in elements which aren't in our mesh, such as
+   * those read in from file, have the invalid processor id and are
+   * evaluated with evaluate_mesh_function() instead.
+   */
+  struct InterpolationPointData
+  {
+    const Elem * elem;
+    Point point;
+    processor_id_type processor_id;
+    std::vector<Number> phi;
+    std::vector<dof_id_type> dof_indices;
+  };
+
+  std::vector<InterpolationPointData> _interpolation_point_data;
 };
 
 } // namespace libMesh
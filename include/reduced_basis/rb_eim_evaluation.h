@@ -108,6 +108,15 @@ public:
                                         const Point & p,
                                         const Elem & elem);
 
+  /**
+   * Fills \p values with the values of the parametrized functions at
+   * the first \p n interpolation points, for the current parameters.
+   * Each parametrized function is evaluated at all of its points in
+   * a single vectorized_evaluate() call.
+   */
+  void evaluate_at_interpolation_points(unsigned int n,
+                                        std::vector<Number> & values);
+
   /**
    * Calculate the EIM approximation to parametrized_function
    * using the first \p N EIM basis functions. Store the
@@ -116,6 +125,15 @@ public:
    */
   virtual Real rb_solve(unsigned int N) override;
 
+  /**
+   * Overridden to compute each EIM approximation with rb_solve().
+   */
+  virtual void batch_rb_solve(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<Real> & error_bounds,
+                              std::vector<std::vector<Number>> & outputs,
+                              std::vector<std::vector<Real>> & output_error_bounds) override;
+
   /**
    * Calculate the EIM approximation for the given
    * right-hand side vector \p EIM_rhs. Store the
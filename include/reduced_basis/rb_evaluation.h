@@ -108,6 +108,51 @@ public:
    */
   virtual Real rb_solve(unsigned int N);
 
+  /**
+   * Performs the online solve of rb_solve(N) for each of the parameters
+   * in \p mus, filling in \p error_bounds with the values rb_solve()
+   * would return and \p outputs and \p output_error_bounds with its
+   * RB_outputs and RB_output_error_bounds for each parameter.
+   *
+   * The reduced systems are assembled together and solved with a
+   * DenseMatrixBatch, which is much faster than a sequence of
+   * rb_solve() calls for the small N typical of online use.
+   * Afterwards this object is left as if rb_solve(N) had just been
+   * called with the last parameters in \p mus.
+   *
+   * Subclasses which override rb_solve() should override this too;
+   * they may simply call rb_solve_each().
+   */
+  virtual void batch_rb_solve(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<Real> & error_bounds,
+                              std::vector<std::vector<Number>> & outputs,
+                              std::vector<std::vector<Real>> & output_error_bounds);
+
+  /**
+   * \returns A new RBEvaluation of the same type as this one, holding
+   * copies of the parameters and online data which rb_solve() uses
+   * but none of the basis functions, so that several copies may run
+   * rb_solve() concurrently.  The default implementation returns
+   * nullptr, meaning that isn't supported.
+   *
+   * RBConstruction::compute_max_error_bound() uses one copy per
+   * thread to evaluate the error bounds over the training set in
+   * parallel.  Subclasses may enable that by overriding this to build
+   * an object of their own type and call copy_online_data() on it,
+   * provided their theta expansion and any stability lower bound may
+   * be evaluated from several threads at once.
+   */
+  virtual std::unique_ptr<RBEvaluation> build_thread_copy () const;
+
+  /**
+   * Copies from \p other the parameters, the online data which
+   * rb_solve() uses, and, if this object has none of its own, the
+   * theta expansion.  Subclasses with more online data should copy
+   * that too in their build_thread_copy().
+   */
+  void copy_online_data (const RBEvaluation & other);
+
   /**
    * \returns A scaling factor that we can use to provide a consistent
    * scaling of the RB error bound across different parameter values.
@@ -328,6 +373,16 @@ public:
 
 protected:
 
+  /**
+   * Implements batch_rb_solve() with one rb_solve() call per
+   * parameter.
+   */
+  void rb_solve_each(unsigned int N,
+                     const std::vector<RBParameters> & mus,
+                     std::vector<Real> & error_bounds,
+                     std::vector<std::vector<Number>> & outputs,
+                     std::vector<std::vector<Real>> & output_error_bounds);
+
   /**
    * Helper function that checks if \p file_name exists.
    */
@@ -24,6 +24,9 @@
 
 #include "libmesh/libmesh_common.h"
 
+// C++ includes
+#include <vector>
+
 
 namespace libMesh
 {
@@ -56,6 +59,25 @@ public:
   virtual Number evaluate(const RBParameters &,
                           const Point &,
                           const Elem &) { return 0.; }
+
+  /**
+   * Evaluate this parametrized function for the parameter value
+   * \p mu at each of the points \p points, in the elements \p elems,
+   * into \p values.  Subclasses which can compute many values more
+   * cheaply together than one at a time should override this; the
+   * default implementation calls evaluate() for each point.
+   */
+  virtual void vectorized_evaluate(const RBParameters & mu,
+                                   const std::vector<Point> & points,
+                                   const std::vector<const Elem *> & elems,
+                                   std::vector<Number> & values)
+  {
+    libmesh_assert_equal_to(points.size(), elems.size());
+
+    values.resize(points.size());
+    for (std::size_t i = 0; i != points.size(); ++i)
+      values[i] = this->evaluate(mu, points[i], *elems[i]);
+  }
 };
 
 }
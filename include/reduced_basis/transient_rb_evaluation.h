@@ -89,6 +89,15 @@ public:
    */
   virtual Real rb_solve(unsigned int N) override;
 
+  /**
+   * Overridden to perform sequential time-dependent solves.
+   */
+  virtual void batch_rb_solve(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<Real> & error_bounds,
+                              std::vector<std::vector<Number>> & outputs,
+                              std::vector<std::vector<Real>> & output_error_bounds) override;
+
   /**
    * If a solve has already been performed, then we cached some data
    * and we can perform a new solve much more rapidly
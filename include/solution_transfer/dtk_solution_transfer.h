@@ -57,6 +57,13 @@ public:
   DTKSolutionTransfer(const libMesh::Parallel::Communicator & comm);
   virtual ~DTKSolutionTransfer();
 
+  /**
+   * Creates the adapters for both EquationSystems and the map
+   * between them, if they don't exist yet.  \p transfer() does this
+   * itself the first time, but this lets the cost be paid up front.
+   */
+  virtual void setup(const Variable & from_var, const Variable & to_var) override;
+
   /**
    * Transfer the values of a variable to another.
    *
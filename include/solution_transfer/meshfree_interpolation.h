@@ -25,6 +25,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/point.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/bounding_box.h"
 #ifdef LIBMESH_HAVE_NANOFLANN
 #  include "libmesh/ignore_warnings.h"
 #  include "libmesh/nanoflann.hpp"
@@ -66,10 +67,15 @@ public:
    * from other processors, so all interpolation can be performed
    * locally.
    *
+   * SYNC_NEARBY_SOURCES only copies the remote data inside the
+   * bounding box set by \p set_target_bounding_box(), so each
+   * processor gets just what its own target points need.
+   *
    * Other \p ParallelizationStrategy techniques will be implemented
    * as needed.
    */
-  enum ParallelizationStrategy {SYNC_SOURCES     = 0,
+  enum ParallelizationStrategy {SYNC_SOURCES        = 0,
+                                SYNC_NEARBY_SOURCES = 1,
                                 INVALID_STRATEGY};
   /**
    * Constructor.
@@ -143,6 +149,18 @@ public:
    */
   virtual void prepare_for_use ();
 
+  /**
+   * Declares that this processor will only interpolate at target
+   * points inside \p box, and switches to the SYNC_NEARBY_SOURCES
+   * strategy, so \p prepare_for_use() only gathers the source points
+   * in the boxes of each processor.
+   *
+   * \note The box should be grown enough that it holds the source
+   * points nearest to each target point as well, or the
+   * interpolation near its sides will miss them.
+   */
+  void set_target_bounding_box (const BoundingBox & box);
+
   /**
    * Interpolate source data at target points.
    * Pure virtual, must be overridden in derived classes.
@@ -164,7 +182,18 @@ protected:
    */
   virtual void gather_remote_data ();
 
+  /**
+   * Gathers the source points and values that have been added on
+   * other processors and lie in this processor's target bounding
+   * box.
+   *
+   * This method is virtual so that it can be overwritten or extended as required
+   * in derived classes.
+   */
+  virtual void gather_nearby_remote_data ();
+
   ParallelizationStrategy  _parallelization_strategy;
+  BoundingBox              _target_box;
   std::vector<std::string> _names;
   std::vector<Point>       _src_pts;
   std::vector<Number>      _src_vals;
@@ -298,8 +327,20 @@ protected:
 
   mutable std::unique_ptr<kd_tree_t> _kd_tree;
 
+  /**
+   * The source points \p _kd_tree was built for.  When the same
+   * points are added again, for example at a new timestep, we keep
+   * the tree rather than building it again.
+   */
+  std::vector<Point> _kd_tree_pts;
+
 #endif // LIBMESH_HAVE_NANOFLANN
 
+  /**
+   * Whether the KD tree has been built for the current source points.
+   */
+  bool _kd_tree_current;
+
   /**
    * Build & initialize the KD tree, if needed.
    */
@@ -314,13 +355,14 @@ protected:
                             const std::vector<Real>   & src_dist_sqr,
                             std::vector<Number>::iterator & out_it) const;
 
-  const Real         _half_power;
-  const unsigned int _n_interp_pts;
-
   /**
-   * Temporary work array.  Object level scope to avoid cache thrashing.
+   * \returns The unnormalized weight of a source point at squared
+   * distance \p dist_sq.
    */
-  mutable std::vector<Number> _vals;
+  Real weight (Real dist_sq) const;
+
+  const Real         _half_power;
+  const unsigned int _n_interp_pts;
 
 public:
 
@@ -335,6 +377,7 @@ public:
 #if LIBMESH_HAVE_NANOFLANN
     _point_list_adaptor(_src_pts),
 #endif
+    _kd_tree_current(false),
     _half_power(power/2.0),
     _n_interp_pts(n_interp_pts)
   {}
@@ -346,12 +389,39 @@ public:
   virtual void clear() override;
 
   /**
-   * Interpolate source data at target points.
-   * Pure virtual, must be overridden in derived classes.
+   * Sets source data at specified points.
+   */
+  virtual void add_field_data (const std::vector<std::string> & field_names,
+                               const std::vector<Point>  & pts,
+                               const std::vector<Number> & vals) override;
+
+  /**
+   * Gathers remote data as the base class does, then builds the KD
+   * tree, unless the source points are the ones it was last built
+   * for.
+   */
+  virtual void prepare_for_use () override;
+
+  /**
+   * Interpolate source data at target points.  The target points
+   * are split between threads.
    */
   virtual void interpolate_field_data (const std::vector<std::string> & field_names,
                                        const std::vector<Point>  & tgt_pts,
                                        std::vector<Number> & tgt_vals) const override;
+
+  /**
+   * Computes the weights interpolate_field_data() gives the source
+   * points at each of the target points: the value at \p tgt_pts[t]
+   * is the sum of the weights \p src_weights[t] times the values at
+   * the source points indexed by \p src_indices[t].
+   *
+   * This lets callers build an interpolation operator once and
+   * apply it to new source values without searching again.
+   */
+  void interpolation_weights (const std::vector<Point> & tgt_pts,
+                              std::vector<std::vector<std::size_t>> & src_indices,
+                              std::vector<std::vector<Real>> & src_weights) const;
 };
 
 } // namespace libMesh
@@ -21,8 +21,12 @@
 #define MESHFREESOLUTIONTRANSFER_H
 
 #include "libmesh/solution_transfer.h"
+#include "libmesh/sparse_matrix.h"
 
+#include <map>
+#include <memory>
 #include <string>
+#include <tuple>
 
 namespace libMesh
 {
@@ -45,10 +49,39 @@ public:
 
   virtual ~MeshfreeSolutionTransfer() {}
 
+  /**
+   * Builds the matrix of interpolation weights from the source dofs
+   * of \p from_var to the target dofs of \p to_var, which must be a
+   * Lagrange variable, so that later transfers between them are just
+   * a matrix-vector product.  Both variables must have their values
+   * at the nodes.
+   *
+   * The matrix is kept until \p clear() is called; call that, and
+   * \p setup() again, if either mesh changes.
+   */
+  virtual void setup(const Variable & from_var, const Variable & to_var) override;
+
+  /**
+   * Forgets the matrices built by \p setup().
+   */
+  void clear();
+
   /**
    * Transfer the values of a variable to another.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) override;
+
+protected:
+  /**
+   * The source system and variable number, then the target system
+   * and variable number, of a transfer.
+   */
+  typedef std::tuple<const System *, unsigned int, const System *, unsigned int> transfer_key;
+
+  /**
+   * The interpolation matrices built by \p setup().
+   */
+  std::map<transfer_key, std::unique_ptr<SparseMatrix<Number>>> _transfer_matrices;
 };
 
 } // namespace libMesh
@@ -29,8 +29,9 @@ namespace libMesh
  * Implementation of a SolutionTransfer object that only works for
  * transferring the solution using a MeshFunction
  *
- * \note A serialization of the "from" solution vector will be
- * performed!  This can be slow in parallel and take a lot of memory!
+ * The "from" mesh may be distributed: each node of the "to" mesh is
+ * evaluated by a processor which owns an element containing it, so
+ * only the values at those nodes are communicated.
  *
  * \author Derek Gaston
  * \date 2013
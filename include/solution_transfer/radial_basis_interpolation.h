@@ -48,6 +48,9 @@ class RadialBasisInterpolation : public InverseDistanceInterpolation<KDDim>
   using InverseDistanceInterpolation<KDDim>::_src_pts;
   using InverseDistanceInterpolation<KDDim>::_src_vals;
   using InverseDistanceInterpolation<KDDim>::_names;
+#ifdef LIBMESH_HAVE_NANOFLANN
+  using InverseDistanceInterpolation<KDDim>::_kd_tree;
+#endif
 
 protected:
 
@@ -71,16 +74,33 @@ protected:
    */
   Real _r_override;
 
+  /**
+   * Whether the basis functions are supported on less than the
+   * bounding box, so that we only need the source points near each
+   * point and can solve a sparse system for the weights.
+   */
+  bool _compact_support;
+
 public:
 
   /**
-   * Constructor.
+   * Constructor.  The basis functions are supported on a sphere of
+   * the given \p radius, or on the bounding box diagonal of the
+   * source points by default.
+   *
+   * With a radius smaller than the diagonal, the weights come from
+   * a sparse system, solved by conjugate gradients, and each
+   * evaluation only looks at the source points within the radius,
+   * which lets this scale to many more source points than the dense
+   * solve used otherwise.  Choose a radius which holds a few dozen
+   * source points around each one.
    */
   RadialBasisInterpolation (const libMesh::Parallel::Communicator & comm_in,
                             Real radius=-1) :
     InverseDistanceInterpolation<KDDim> (comm_in,8,2),
     _r_bbox(0.),
-    _r_override(radius)
+    _r_override(radius),
+    _compact_support(false)
   { libmesh_experimental(); }
 
   /**
@@ -47,6 +47,15 @@ public:
 
   virtual ~SolutionTransfer() {}
 
+  /**
+   * Prepares for transferring the values of a variable to another,
+   * when the transfer will be repeated between the same meshes, so
+   * that later calls to \p transfer() can reuse the work.
+   *
+   * The default implementation does nothing.
+   */
+  virtual void setup(const Variable & /* from_var */, const Variable & /* to_var */) {}
+
   /**
    * Transfer the values of a variable to another.
    *
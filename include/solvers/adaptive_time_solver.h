@@ -206,6 +206,17 @@ protected:
    */
   Real last_deltat;
 
+  /**
+   * Grows or shrinks deltat, within the limits set above, to aim the
+   * next timestep at target_tolerance.  \p relative_error is the
+   * estimated error of the timestep just taken relative to the
+   * solution and scaled by deltat, \p local_relative_error the same
+   * without the deltat scaling; which one is used depends on
+   * global_tolerance.  Also records last_deltat.
+   */
+  void update_deltat (Real relative_error,
+                      Real local_relative_error);
+
   /**
    * A helper function to calculate error norms
    */
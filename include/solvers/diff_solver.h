@@ -114,6 +114,13 @@ public:
    */
   virtual unsigned int solve () = 0;
 
+  /**
+   * Tells the solver that the system Jacobian has changed, e.g.
+   * because of a new timestep size, so that any Jacobian it kept
+   * from an earlier solve must be rebuilt.  Does nothing by default.
+   */
+  virtual void jacobian_changed () {}
+
   /**
    * \returns The number of "outer" (e.g. quasi-Newton) iterations
    * required by the last solve.
@@ -113,6 +113,37 @@ public:
     _close_matrix_before_solve = val;
   }
 
+  /**
+   * \returns \p true if the solver keeps its internal data between
+   * solves.
+   */
+  bool get_reuse_solver() const { return _reuse_solver; }
+
+  /**
+   * Set this to true to keep the solver's internal data, such as a
+   * SLEPc spectral transformation and the factorization inside it,
+   * from one solve to the next instead of building it anew.  The
+   * operators of later solves must keep the sparsity pattern of the
+   * first ones (as an EigenSystem's do), so a sweep over shifts or
+   * targets only refactors numerically.  \p false by default.
+   */
+  void set_reuse_solver(bool val) { _reuse_solver = val; }
+
+  /**
+   * Set this to true to keep the preconditioner of a reused solver
+   * even after the operators or the shift change.  This only makes
+   * sense when the spectral transformation solves iteratively, where
+   * an older preconditioner costs iterations rather than accuracy.
+   * \p false by default.
+   */
+  void set_reuse_preconditioner(bool val) { _reuse_preconditioner = val; }
+
+  /**
+   * Sets the block size of block eigensolvers such as LOBPCG.  The
+   * default, 0, leaves the choice to the solver package.
+   */
+  void set_block_size(unsigned int block_size) { _block_size = block_size; }
+
   /**
    * Release all memory and clear data structures.
    */
@@ -359,6 +390,21 @@ protected:
   Real _target_val;
 
   bool _close_matrix_before_solve;
+
+  /**
+   * Whether to keep internal solver data between solves
+   */
+  bool _reuse_solver;
+
+  /**
+   * Whether to keep the preconditioner of a reused solver
+   */
+  bool _reuse_preconditioner;
+
+  /**
+   * Block size for block eigensolvers, or 0 for the default
+   */
+  unsigned int _block_size;
 };
 
 } // namespace libMesh
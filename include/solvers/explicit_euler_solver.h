@@ -0,0 +1,132 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_EXPLICIT_EULER_SOLVER_H
+#define LIBMESH_EXPLICIT_EULER_SOLVER_H
+
+// Local includes
+#include "libmesh/euler_solver.h"
+
+// C++ includes
+#include <memory>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DiagonalMatrix;
+
+/**
+ * This class defines a forward Euler solver which lumps the mass
+ * matrix, so that each timestep needs only residual assemblies and
+ * vector operations, never a Jacobian or a linear solve.
+ *
+ * The lumped (row-sum) mass is taken from the residuals themselves:
+ * with theta = 0 the residual at u_old + deltat is exactly the
+ * residual at u_old plus the mass matrix applied to a vector of
+ * ones.  Each timestep therefore costs two residual assemblies, or
+ * one if \p reuse_lumped_mass is set for a mass matrix which does
+ * not change between timesteps.  With a nodal quadrature rule
+ * (e.g. Gauss-Lobatto on Lagrange elements) the mass matrix is
+ * already diagonal and the lumping is exact.
+ *
+ * The mass terms must be linear in the solution rate, and algebraic
+ * constraint equations (element_constraint() and friends) are not
+ * supported.  Constrained dofs are set by the DofMap after each
+ * update.
+ *
+ * This class is part of the new DifferentiableSystem framework,
+ * which is still experimental.  Users of this framework should
+ * beware of bugs and future API changes.
+ */
+class ExplicitEulerSolver : public EulerSolver
+{
+public:
+  /**
+   * The parent class
+   */
+  typedef EulerSolver Parent;
+
+  /**
+   * Constructor. Requires a reference to the system
+   * to be solved.
+   */
+  explicit
+  ExplicitEulerSolver (sys_type & s);
+
+  /**
+   * Destructor.
+   */
+  virtual ~ExplicitEulerSolver ();
+
+  /**
+   * Discards any saved lumped mass along with the old dof layout.
+   */
+  virtual void reinit () override;
+
+  /**
+   * Takes one forward Euler step, u_new = u_old - deltat * M_L^{-1}
+   * R(u_old), with R the (constrained) system residual and M_L the
+   * lumped mass matrix.  The DiffSolver is not used.
+   */
+  virtual void solve () override;
+
+  /**
+   * Error convergence order: 1
+   */
+  virtual Real error_order() const override { return 1.; }
+
+  /**
+   * The inverse of the lumped mass matrix used by the last timestep.
+   * Rows with no mass (e.g. Dirichlet constrained dofs) hold zero.
+   */
+  const DiagonalMatrix<Number> & inverse_lumped_mass() const;
+
+  /**
+   * Set this to true to compute the lumped mass only once, on the
+   * first timestep after each reinit(), when the mass matrix does not
+   * depend on the solution, the time, or the timestep size.
+   * Defaults to false.
+   */
+  bool reuse_lumped_mass;
+
+protected:
+
+  /**
+   * Assembles the residual at the old solution plus \p shift, leaving
+   * it in the system rhs.
+   */
+  void assemble_shifted_residual (Number shift);
+
+  /**
+   * Inverse lumped mass matrix
+   */
+  std::unique_ptr<DiagonalMatrix<Number>> _inverse_lumped_mass;
+
+  /**
+   * Whether \p _inverse_lumped_mass is up to date
+   */
+  bool _have_lumped_mass;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_EXPLICIT_EULER_SOLVER_H
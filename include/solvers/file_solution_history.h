@@ -34,6 +34,9 @@
 namespace libMesh
 {
 
+// Forward Declarations
+class BackgroundTaskQueue;
+
 /**
  * Subclass of Solution History that stores the solutions
  * and other important vectors onto disk.
@@ -50,8 +53,7 @@ public:
    * Constructor, reference to system to be passed by user, set the
    * stored_sols iterator to some initial value
    */
-  FileSolutionHistory(System & system_) : stored_sols(stored_solutions.end()), _system(system_), localTimestamp(0), timeTotimestamp()
-  { libmesh_experimental(); }
+  FileSolutionHistory(System & system_);
 
   /**
    * Destructor
@@ -68,6 +70,22 @@ public:
    */
   virtual void retrieve(bool is_adjoint_solve) override;
 
+  /**
+   * If \p val is true, rather than writing the whole EquationSystems
+   * synchronously as xda, each processor writes the local entries of
+   * this System's vectors to its own file on a background thread.
+   * store() then only copies those entries, and the writes overlap
+   * the timesteps that follow.  Files written this way can only be
+   * read back on the same partitioning.
+   */
+  void set_asynchronous_writes(bool val);
+
+  /**
+   * Blocks until all asynchronous writes so far are complete, and
+   * throws if any of them failed.
+   */
+  void wait_for_writes();
+
   /**
    * Typedef for Stored Solutions iterator, a list of pairs of the
    * system time and filenames of the stored solutions
@@ -81,7 +99,9 @@ public:
    */
   virtual std::unique_ptr<SolutionHistory > clone() const override
   {
-    return libmesh_make_unique<FileSolutionHistory>(_system);
+    auto cloned = libmesh_make_unique<FileSolutionHistory>(_system);
+    cloned->set_asynchronous_writes(_write_queue != nullptr);
+    return cloned;
   }
 
 private:
@@ -108,6 +128,16 @@ private:
   // An iterator for the timeTotimestamp map, will help member functions distinguish
   // between primal and adjoint time loops
   std::map<Real, unsigned int>::iterator timeTotimestamp_iterator;
+
+  // Writes the local entries of this System's vectors to filename,
+  // or queues them to be written if we write asynchronously
+  void write_local_vectors(const std::string & filename);
+
+  // Reads back what write_local_vectors() wrote
+  void read_local_vectors(const std::string & filename);
+
+  // Runs asynchronous writes in the background, if we do them at all
+  std::unique_ptr<BackgroundTaskQueue> _write_queue;
 };
 
 } // end namespace libMesh
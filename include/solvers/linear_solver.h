@@ -214,6 +214,39 @@ public:
                                        const double,      // Stopping tolerance
                                        const unsigned int); // N. Iterations
 
+  /**
+   * Solves for each of the \p solutions against the corresponding
+   * entry of \p rhs, all with the same system matrix and with the
+   * preconditioner (built from \p precond_matrix, or from the system
+   * matrix if that is null) set up only once.
+   *
+   * The default implementation solves each right hand side in turn,
+   * reusing the preconditioner after the first.  Solver packages
+   * with a block Krylov method may override this.
+   *
+   * \returns The iteration counts and final residual norms, summed
+   * over the right hand sides.
+   */
+  virtual std::pair<unsigned int, Real>
+  block_solve (SparseMatrix<T> & matrix,
+               SparseMatrix<T> * precond_matrix,
+               const std::vector<NumericVector<T> *> & solutions,
+               const std::vector<NumericVector<T> *> & rhs,
+               const double tol,
+               const unsigned int n_iter);
+
+  /**
+   * Solves the adjoint system for each of the \p solutions against
+   * the corresponding entry of \p rhs, with the preconditioner set up
+   * only once, as in \p block_solve().
+   */
+  virtual std::pair<unsigned int, Real>
+  block_adjoint_solve (SparseMatrix<T> & matrix,
+                       const std::vector<NumericVector<T> *> & solutions,
+                       const std::vector<NumericVector<T> *> & rhs,
+                       const double tol,
+                       const unsigned int n_iter);
+
 
 
   /**
@@ -27,6 +27,8 @@
 
 // C++ includes
 #include <list>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
@@ -47,7 +49,8 @@ public:
    * Constructor, reference to system to be passed by user, set the
    * stored_sols iterator to some initial value
    */
-  MemorySolutionHistory(System & system_) : stored_sols(stored_solutions.end()), _system(system_)
+  MemorySolutionHistory(System & system_) : stored_sols(stored_solutions.end()), _system(system_),
+                                             _compressed(false), _single_precision(false)
   { libmesh_experimental(); }
 
   /**
@@ -65,12 +68,50 @@ public:
    */
   virtual void retrieve(bool is_adjoint_solve) override;
 
+  /**
+   * Store each vector as just its local entries, with runs of zeros
+   * squeezed out, rather than as a full clone with any ghost entries.
+   * If \p single_precision is also true the entries are rounded to
+   * single precision, which halves their memory again but loses
+   * accuracy.  Vectors already stored are left as they are.
+   */
+  void set_compressed_storage (bool compressed,
+                               bool single_precision = false)
+  { _compressed = compressed; _single_precision = single_precision; }
+
+  /**
+   * The local entries of a stored vector, with runs of zeros squeezed
+   * out.
+   */
+  struct CompressedVector
+  {
+    numeric_index_type first_local_index = 0;
+    numeric_index_type n_local = 0;
+
+    /**
+     * The (offset, length) of each run of nonzero local entries
+     */
+    std::vector<std::pair<numeric_index_type, numeric_index_type>> runs;
+
+    /**
+     * The entries of those runs, at full precision
+     */
+    std::vector<Number> values;
+
+    /**
+     * Or the real (and imaginary) parts of those entries, at single
+     * precision
+     */
+    std::vector<float> single_values;
+  };
+
   /**
    * Typedef for Stored Solutions iterator, a list of pairs of the current
    * system time, map of strings and saved vectors
    */
   typedef std::map<std::string, std::unique_ptr<NumericVector<Number>>> map_type;
-  typedef std::list<std::pair<Real, map_type>> list_type;
+  typedef std::map<std::string, CompressedVector> compressed_map_type;
+  typedef std::list<std::pair<Real, std::pair<map_type, compressed_map_type>>> list_type;
   typedef list_type::iterator stored_solutions_iterator;
 
   /**
@@ -78,7 +119,9 @@ public:
    */
   virtual std::unique_ptr<SolutionHistory > clone() const override
   {
-    return libmesh_make_unique<MemorySolutionHistory>(_system);
+    auto cloned = libmesh_make_unique<MemorySolutionHistory>(_system);
+    cloned->set_compressed_storage(_compressed, _single_precision);
+    return cloned;
   }
 
 private:
@@ -93,8 +136,16 @@ private:
   // A helper function to locate entries at a given time
   void find_stored_entry();
 
+  // A helper function to save a vector in the current entry
+  void save_vector(const std::string & vec_name,
+                   const NumericVector<Number> & vec);
+
   // A system reference
   System & _system ;
+
+  // Whether (and how) to compress newly stored vectors
+  bool _compressed;
+  bool _single_precision;
 };
 
 } // end namespace libMesh
@@ -0,0 +1,233 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_NATIVE_LINEAR_SOLVER_H
+#define LIBMESH_NATIVE_LINEAR_SOLVER_H
+
+// Local includes
+#include "libmesh/linear_solver.h"
+#include "libmesh/enum_convergence_flags.h"
+
+// C++ includes
+#include <functional>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class provides Krylov solvers which need no external linear
+ * algebra package, for use with \p DistributedSparseMatrix and
+ * \p DistributedVector, although any matrix which implements
+ * \p get_row() and any vector type will do.  It offers the \p CG,
+ * \p GMRES and \p BICGSTAB solver types, with \p IDENTITY_PRECOND,
+ * \p JACOBI_PRECOND, or \p ILU_PRECOND and \p BLOCK_JACOBI_PRECOND,
+ * which both use the incomplete LU factorization with no fill of
+ * each processor's diagonal block.  An attached \p Preconditioner
+ * object takes the place of these.
+ */
+template <typename T>
+class NativeLinearSolver : public LinearSolver<T>
+{
+public:
+  /**
+   *  Constructor.
+   */
+  NativeLinearSolver (const libMesh::Parallel::Communicator & comm_in);
+
+  /**
+   * Destructor.
+   */
+  ~NativeLinearSolver ();
+
+  /**
+   * Release all memory and clear data structures.
+   */
+  virtual void clear () override;
+
+  /**
+   * Initialize data structures if not done so already.
+   */
+  virtual void init (const char * name = nullptr) override;
+
+  /**
+   * Solves with the system matrix as preconditioning matrix.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * Solves, building the preconditioner from \p pc.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         SparseMatrix<T> & pc,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix.
+   * Without a matrix to factor, \p ILU_PRECOND and
+   * \p BLOCK_JACOBI_PRECOND fall back on \p JACOBI_PRECOND.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix, but
+   * a sparse matrix is used as preconditioning matrix, this allowing
+   * other preconditioners than JACOBI.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         const SparseMatrix<T> & precond_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * \returns The solver's convergence flag.
+   */
+  virtual LinearConvergenceReason get_converged_reason() const override;
+
+  /**
+   * The number of iterations between restarts of \p GMRES.
+   * Defaults to 30.
+   */
+  unsigned int gmres_restart;
+
+private:
+
+  /**
+   * The action of the system matrix: \p dest = A \p arg.
+   */
+  typedef std::function<void(NumericVector<T> &, const NumericVector<T> &)> Operator;
+
+  /**
+   * Builds the preconditioner from the local rows of \p pc.
+   */
+  void build_preconditioner (const SparseMatrix<T> & pc);
+
+  /**
+   * Builds the Jacobi preconditioner from the \p diagonal of the
+   * system matrix.
+   */
+  void build_preconditioner (const NumericVector<T> & diagonal);
+
+  /**
+   * Computes \p z = M^{-1} \p r.
+   */
+  void apply_preconditioner (NumericVector<T> & z,
+                             const NumericVector<T> & r);
+
+  /**
+   * Runs the solver type we were asked for, once the preconditioner
+   * is ready.
+   */
+  std::pair<unsigned int, Real> solve_with (const Operator & A,
+                                            NumericVector<T> & x,
+                                            NumericVector<T> & b,
+                                            const double tol,
+                                            const unsigned int m_its);
+
+  /**
+   * The preconditioned conjugate gradient method.
+   */
+  std::pair<unsigned int, Real> cg (const Operator & A,
+                                    NumericVector<T> & x,
+                                    const NumericVector<T> & b,
+                                    const Real target,
+                                    const unsigned int m_its);
+
+  /**
+   * The restarted, right preconditioned, GMRES method.
+   */
+  std::pair<unsigned int, Real> gmres (const Operator & A,
+                                       NumericVector<T> & x,
+                                       const NumericVector<T> & b,
+                                       const Real target,
+                                       const unsigned int m_its);
+
+  /**
+   * The right preconditioned BiCGStab method.
+   */
+  std::pair<unsigned int, Real> bicgstab (const Operator & A,
+                                          NumericVector<T> & x,
+                                          const NumericVector<T> & b,
+                                          const Real target,
+                                          const unsigned int m_its);
+
+  /**
+   * The preconditioner we built: \p IDENTITY_PRECOND,
+   * \p JACOBI_PRECOND, \p ILU_PRECOND, or \p USER_PRECOND for an
+   * attached \p Preconditioner object, or \p INVALID_PRECONDITIONER
+   * before we have built one.
+   */
+  PreconditionerType _built_preconditioner;
+
+  /**
+   * The global indices of the local rows.
+   */
+  std::vector<numeric_index_type> _local_indices;
+
+  /**
+   * The inverted diagonal, for \p JACOBI_PRECOND.
+   */
+  std::vector<T> _inverse_diagonal;
+
+  /**
+   * The incomplete factors L and U of the local diagonal block, in
+   * compressed rows with local column indices.  L has a unit
+   * diagonal, which we do not store, and U has its diagonal at
+   * \p _ilu_diagonal in each row.
+   */
+  std::vector<numeric_index_type> _ilu_offsets, _ilu_columns, _ilu_diagonal;
+  std::vector<T> _ilu_values;
+
+  /**
+   * The result of the last solve.
+   */
+  LinearConvergenceReason _reason;
+};
+
+
+
+/*----------------------- inline functions ----------------------------------*/
+template <typename T>
+inline
+NativeLinearSolver<T>::~NativeLinearSolver ()
+{
+  this->clear ();
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_NATIVE_LINEAR_SOLVER_H
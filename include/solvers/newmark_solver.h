@@ -147,7 +147,7 @@ public:
    * Setter for \f$ \beta \f$
    */
   void set_beta ( Real beta )
-  { _beta = beta; }
+  { _beta = beta; _jacobian_changed = true; }
 
   /**
    * Setter for \f$ \gamma \f$.
@@ -155,7 +155,7 @@ public:
    * \note The method is second order only for \f$ \gamma = 1/2 \f$.
    */
   void set_gamma ( Real gamma )
-  { _gamma = gamma; }
+  { _gamma = gamma; _jacobian_changed = true; }
 
 protected:
 
@@ -186,6 +186,14 @@ protected:
    */
   bool _initial_accel_set;
 
+  /**
+   * The timestep size, and whether \f$\beta\f$ or \f$\gamma\f$ have
+   * changed, since the last solve.  Any of these changes the
+   * Jacobian, so the DiffSolver is told to drop one it has kept.
+   */
+  Real _last_deltat;
+  bool _jacobian_changed;
+
   /**
    * This method is the underlying implementation of the public
    * residual methods.
@@ -116,9 +116,20 @@ public:
    * to find as much residual reduction as possible.
    *
    * brent_line_search is currently set to true by default.
+   *
+   * Each step length tried needs only a residual assembly, and the
+   * residual at the step length finally taken is left in the system's
+   * rhs rather than being assembled again.
    */
   bool brent_line_search;
 
+  /**
+   * The factor by which the line search shrinks its steps while
+   * looking for a residual reduction.  Brent's method may shrink
+   * them further.  This is set to 0.5 by default.
+   */
+  Real backtracking_ratio;
+
   /**
    * If set to true, check for convergence of the linear solve. If no
    * convergence is acquired during the linear solve, the nonlinear solve
@@ -142,6 +153,73 @@ public:
    */
   double linear_tolerance_multiplier;
 
+  /**
+   * If set to true, the solver never assembles the system matrix:
+   * linear solves apply the Jacobian element by element through an
+   * \p FEMJacobianShellMatrix instead, preconditioned with the
+   * "Preconditioner" matrix if the system has one.  This requires an
+   * \p FEMSystem and a linear solver which supports shell matrices.
+   * It is set to false by default.
+   */
+  bool matrix_free;
+
+  /**
+   * The Jacobian is reassembled only every jacobian_lag nonlinear
+   * iterations; iterations in between assemble just the residual and
+   * reuse the last Jacobian for their linear solves.  This is set to
+   * 1, reassembling every iteration, by default.  It has no effect
+   * on matrix-free solves.
+   */
+  unsigned int jacobian_lag;
+
+  /**
+   * The linear solver preconditioner is rebuilt only every
+   * preconditioner_lag nonlinear iterations, and only where the
+   * Jacobian has been reassembled; otherwise the last preconditioner
+   * is reused.  This is set to 1 by default.
+   */
+  unsigned int preconditioner_lag;
+
+  /**
+   * If a step taken with a lagged Jacobian fails to reduce the
+   * residual norm below lagged_jacobian_residual_ratio times its
+   * previous value, the Jacobian and preconditioner are rebuilt on
+   * the next iteration regardless of their lags.  This requires the
+   * residual to be tested after each step (see \p
+   * require_residual_reduction), and is set to 0.5 by default.
+   */
+  Real lagged_jacobian_residual_ratio;
+
+  /**
+   * If set to true, the residual assembled to test each Newton step
+   * (or the last step length tried by the line search) is kept as the
+   * residual for the next iteration when that iteration doesn't
+   * reassemble the Jacobian, instead of being assembled again.  Any
+   * Jacobian is always assembled in the same element loop as its
+   * residual, so this pays off with lagged Jacobians (see \p
+   * jacobian_lag) and with matrix-free solves.  It requires an
+   * assembly which depends only on the solution, and is set to false
+   * by default.
+   */
+  bool reuse_tested_residual;
+
+  /**
+   * If set to true, the Jacobian and preconditioner built in one
+   * solve are kept for every later solve, and only the residual is
+   * reassembled, until \p jacobian_changed() or \p reinit() is
+   * called.  This suits problems whose Jacobian is independent of
+   * the solution, such as linear problems with a fixed timestep.  It
+   * has no effect on matrix-free solves, and is set to false by
+   * default.
+   */
+  bool constant_jacobian;
+
+  /**
+   * Makes the next solve rebuild a \p constant_jacobian.
+   */
+  virtual void jacobian_changed () override
+  { _have_constant_jacobian = false; }
+
 protected:
 
   /**
@@ -181,6 +259,14 @@ protected:
   bool test_convergence(Real current_residual,
                         Real step_norm,
                         bool linear_solve_finished);
+
+private:
+
+  /**
+   * Whether the system matrix and preconditioner still hold the
+   * \p constant_jacobian from an earlier solve.
+   */
+  bool _have_constant_jacobian;
 };
 
 
@@ -142,12 +142,29 @@ public:
    */
   OptimizationSystem::ComputeGradient * gradient_object;
 
+  /**
+   * Object that computes the objective function and its gradient
+   * together at the input iterate X.  Solvers which support it use
+   * this whenever they need both at the same point, and the separate
+   * objects, if any, otherwise.
+   */
+  OptimizationSystem::ComputeObjectiveAndGradient * objective_and_gradient_object;
+
   /**
    * Object that computes the Hessian H_f(X) of the objective function
    * at the input iterate X.
    */
   OptimizationSystem::ComputeHessian * hessian_object;
 
+  /**
+   * Object that computes products of the Hessian of the objective
+   * function at the input iterate X with other vectors.  Solvers
+   * which support it use this to apply the Hessian matrix-free; a
+   * \p hessian_object, if also given, only assembles a matrix to
+   * precondition with.
+   */
+  OptimizationSystem::ComputeHessianVectorProduct * hessian_vector_product_object;
+
   /**
    * Object that computes the equality constraints vector C_eq(X).
    * This will lead to the constraints C_eq(X) = 0 being imposed.
@@ -39,13 +39,71 @@
 # undef I // Avoid complex.h contamination
 #endif
 
+// C++ includes
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace libMesh
 {
 // Forward declarations
 class System;
 
+/**
+ * The field split index sets \p petsc_auto_fieldsplit() built for a
+ * system, kept so that solvers which set up their preconditioner
+ * repeatedly can skip rebuilding them until the system's dofs are
+ * next distributed.
+ */
+class PetscFieldSplitCache
+{
+public:
+  PetscFieldSplitCache () :
+    _sys(nullptr),
+    _n_dof_distributions(0)
+  {}
+
+  PetscFieldSplitCache (const PetscFieldSplitCache &) = delete;
+  PetscFieldSplitCache & operator= (const PetscFieldSplitCache &) = delete;
+
+  ~PetscFieldSplitCache () { this->clear(); }
+
+  /**
+   * Destroys any cached index sets.
+   */
+  void clear ();
+
+private:
+  friend void petsc_auto_fieldsplit (PC, const System &, PetscFieldSplitCache &);
+
+  /**
+   * The system, and its \p DofMap::n_dof_distributions(), that the
+   * splits were built for.
+   */
+  const System * _sys;
+  unsigned int _n_dof_distributions;
+
+  /**
+   * The name and index set of each split.
+   */
+  std::vector<std::pair<std::string, IS>> _splits;
+};
+
+/**
+ * Sets up a field split of \p my_pc for the variables of \p sys, as
+ * requested by the \p --solver-variable-names and \p
+ * --solver_group_ command line options.
+ */
 void petsc_auto_fieldsplit (PC my_pc, const System & sys);
 
+/**
+ * As above, but reuses the index sets in \p cache if they were built
+ * for \p sys and its dofs haven't been redistributed since.
+ */
+void petsc_auto_fieldsplit (PC my_pc,
+                            const System & sys,
+                            PetscFieldSplitCache & cache);
+
 } // namespace libMesh
 
 
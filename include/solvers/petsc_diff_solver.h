@@ -28,6 +28,7 @@
 #include "libmesh/diff_solver.h"
 #include "libmesh/petsc_macro.h"
 #include "libmesh/petsc_dm_wrapper.h"
+#include "libmesh/petsc_auto_fieldsplit.h"
 
 // PETSc includes
 #ifdef I
@@ -99,6 +100,12 @@ protected:
    */
   SNES _snes;
 
+  /**
+   * The field split index sets from the last setup, reused until the
+   * dofs are redistributed
+   */
+  PetscFieldSplitCache _fieldsplit_cache;
+
   /**
    * Wrapper object for interacting with PetscDM
    */
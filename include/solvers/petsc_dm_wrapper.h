@@ -89,6 +89,13 @@ namespace libMesh
    * DM data, we can additionally (with or without multigrid) define recursive
    * fieldsplits of our variables.
    *
+   * The hierarchy need not come from uniform refinement: each coarser
+   * grid first takes one p level off every p refined element, then
+   * coarsens every element whose children are all active, and the
+   * interpolation between grids comes from the parent/child (or
+   * p level) relations of the elements which changed.  Without
+   * -pc_mg_levels, -pc_type mg uses every grid available.
+   *
    * \author Paul T. Bauman, Boris Boutkov
    * \date 2018
    */
@@ -38,6 +38,7 @@
 
 // Local includes
 #include "libmesh/linear_solver.h"
+#include "libmesh/petsc_auto_fieldsplit.h"
 
 // C++ includes
 #include <cstddef>
@@ -171,6 +172,21 @@ public:
                  const double tol,
                  const unsigned int m_its) override;
 
+  /**
+   * Uses KSPMatSolve, where available, to solve for all the right
+   * hand sides with one preconditioner setup, and with a block
+   * Krylov method if one is chosen on the command line.  Solves
+   * restricted to a subset or using a user-supplied \p Preconditioner
+   * fall back to \p LinearSolver::block_solve().
+   */
+  virtual std::pair<unsigned int, Real>
+  block_solve (SparseMatrix<T> & matrix,
+               SparseMatrix<T> * precond_matrix,
+               const std::vector<NumericVector<T> *> & solutions,
+               const std::vector<NumericVector<T> *> & rhs,
+               const double tol,
+               const unsigned int m_its) override;
+
   /**
    * This method allows you to call a linear solver while specifying
    * the matrix to use as the (left) preconditioning matrix.
@@ -318,6 +334,12 @@ private:
    * what happens with the dofs outside the subset.
    */
   SubsetSolveMode _subset_solve_mode;
+
+  /**
+   * The field split index sets from the last \p init_names(), reused
+   * until the dofs are redistributed.
+   */
+  PetscFieldSplitCache _fieldsplit_cache;
 };
 
 
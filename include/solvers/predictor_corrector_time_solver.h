@@ -0,0 +1,125 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PREDICTOR_CORRECTOR_TIME_SOLVER_H
+#define LIBMESH_PREDICTOR_CORRECTOR_TIME_SOLVER_H
+
+// Local includes
+#include "libmesh/adaptive_time_solver.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class wraps a theta-method UnsteadySolver (an EulerSolver or
+ * Euler2Solver) and estimates the error of each timestep by
+ * comparing it to an explicit predictor, so that adapting deltat
+ * costs a single solve per accepted timestep rather than the three
+ * taken by TwostepTimeSolver.
+ *
+ * The predictor extrapolates the difference quotients of the previous
+ * one (for first-order core solvers) or two (for Crank-Nicolson)
+ * timesteps, and needs no residual evaluations.  Its distance from
+ * the corrector is scaled by the ratio of the leading truncation
+ * error terms of the two, in the manner of Milne's device.  That
+ * ratio is right to leading order for Euler2Solver and for theta !=
+ * 0.5; for the EulerSolver midpoint rule the trapezoid rule's
+ * constants are used, which agree on linear autonomous problems.  The
+ * predictor also serves as the initial guess for the corrector solve.
+ *
+ * Until enough previous timesteps are available the timesteps are
+ * taken without an error estimate and deltat is left alone.
+ *
+ * Currently this class only works on fully coupled Systems
+ *
+ * This class is part of the new DifferentiableSystem framework,
+ * which is still experimental.  Users of this framework should
+ * beware of bugs and future API changes.
+ */
+class PredictorCorrectorTimeSolver : public AdaptiveTimeSolver
+{
+public:
+  /**
+   * The parent class
+   */
+  typedef AdaptiveTimeSolver Parent;
+
+  /**
+   * Constructor. Requires a reference to the system
+   * to be solved.
+   */
+  explicit
+  PredictorCorrectorTimeSolver (sys_type & s);
+
+  /**
+   * Destructor.
+   */
+  ~PredictorCorrectorTimeSolver ();
+
+  /**
+   * Discards the previous timesteps along with the old dof layout.
+   */
+  virtual void reinit() override;
+
+  virtual void solve() override;
+
+  /**
+   * Saves the old solution for use by future predictors, then
+   * advances as AdaptiveTimeSolver does.
+   */
+  virtual void advance_timestep() override;
+
+protected:
+
+  /**
+   * The theta of the core time solver
+   */
+  Real core_theta() const;
+
+  /**
+   * Builds the predicted solution in \p prediction and returns the
+   * factor which turns the difference between corrector and predictor
+   * into an estimate of the corrector's local error.  Returns 0 if
+   * there are too few previous timesteps to predict with.
+   */
+  Real predict (NumericVector<Number> & prediction) const;
+
+  /**
+   * Solutions at previous timesteps, most recent first, not including
+   * the old nonlinear solution itself.
+   */
+  std::vector<std::unique_ptr<NumericVector<Number>>> _previous_solutions;
+
+  /**
+   * The timestep sizes leading up to the old nonlinear solution, most
+   * recent first.  _previous_deltats[i] took _previous_solutions[i]
+   * one timestep forward.
+   */
+  std::vector<Real> _previous_deltats;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_PREDICTOR_CORRECTOR_TIME_SOLVER_H
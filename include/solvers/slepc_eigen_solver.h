@@ -295,6 +295,19 @@ private:
    */
   void set_slepc_position_of_spectrum();
 
+  /**
+   * Tells Slepc the block size and how much of the spectral
+   * transformation to keep, as stored in \p _block_size,
+   * \p _reuse_solver and \p _reuse_preconditioner
+   */
+  void set_slepc_solver_options();
+
+  /**
+   * Creates the \p _eps for a new solve, or keeps the previous one
+   * if \p _reuse_solver is set.
+   */
+  void prepare_eps ();
+
   /**
    * Internal function if shell matrix mode is used, this just
    * calls the shell matrix's matrix multiplication function.
@@ -28,6 +28,7 @@
 // Local includes
 #include "libmesh/petsc_macro.h"
 #include "libmesh/optimization_solver.h"
+#include "libmesh/petsc_shell_matrix.h"
 
 // Include header for the Tao optimization library
 #ifdef I
@@ -47,7 +48,9 @@ extern "C"
 {
   PetscErrorCode __libmesh_tao_objective (Tao tao, Vec x, PetscReal * objective, void * ctx);
   PetscErrorCode __libmesh_tao_gradient(Tao tao, Vec x, Vec g, void * ctx);
+  PetscErrorCode __libmesh_tao_objective_and_gradient(Tao tao, Vec x, PetscReal * objective, Vec g, void * ctx);
   PetscErrorCode __libmesh_tao_hessian(Tao tao, Vec x, Mat h, Mat pc, void * ctx);
+  PetscErrorCode __libmesh_tao_hessian_mult(Mat h, Vec v, Vec hv);
   PetscErrorCode __libmesh_tao_equality_constraints(Tao tao, Vec x, Vec ce, void * ctx);
   PetscErrorCode __libmesh_tao_equality_constraints_jacobian(Tao tao, Vec x, Mat J, Mat Jpre, void * ctx);
   PetscErrorCode __libmesh_tao_inequality_constraints(Tao tao, Vec x, Vec cineq, void * ctx);
@@ -143,9 +146,36 @@ protected:
 
 private:
 
+  /**
+   * Makes the system's current_local_solution the iterate \p x, with
+   * any constraints enforced exactly, unless it is already.
+   */
+  void update_system (Vec x);
+
+  /**
+   * Forgets which iterate the system was last updated to.
+   */
+  void forget_system_update ();
+
+  /**
+   * The iterate the system was last updated to, which we hold a
+   * reference to, and its PETSc state at the time.
+   */
+  Vec _last_x;
+  PetscObjectState _last_x_state;
+
+  /**
+   * The shell matrix used for matrix-free Hessians, and a copy of the
+   * iterate it is applied at.
+   */
+  std::unique_ptr<PetscShellMatrix<T>> _hessian_shell;
+  std::unique_ptr<NumericVector<Number>> _hessian_point;
+
   friend PetscErrorCode __libmesh_tao_objective (Tao tao, Vec x, PetscReal * objective, void * ctx);
   friend PetscErrorCode __libmesh_tao_gradient(Tao tao, Vec x, Vec g, void * ctx);
+  friend PetscErrorCode __libmesh_tao_objective_and_gradient(Tao tao, Vec x, PetscReal * objective, Vec g, void * ctx);
   friend PetscErrorCode __libmesh_tao_hessian(Tao tao, Vec x, Mat h, Mat pc, void * ctx);
+  friend PetscErrorCode __libmesh_tao_hessian_mult(Mat h, Vec v, Vec hv);
   friend PetscErrorCode __libmesh_tao_equality_constraints(Tao tao, Vec x, Vec ce, void * ctx);
   friend PetscErrorCode __libmesh_tao_equality_constraints_jacobian(Tao tao, Vec x, Mat J, Mat Jpre, void * ctx);
   friend PetscErrorCode __libmesh_tao_inequality_constraints(Tao tao, Vec x, Vec cineq, void * ctx);
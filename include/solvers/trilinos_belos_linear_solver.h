@@ -0,0 +1,187 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TRILINOS_BELOS_LINEAR_SOLVER_H
+#define LIBMESH_TRILINOS_BELOS_LINEAR_SOLVER_H
+
+
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/linear_solver.h"
+
+#ifdef LIBMESH_TRILINOS_HAVE_TPETRA_SOLVERS
+
+#include "libmesh/trilinos_tpetra_matrix.h"
+
+// Trilinos include files.
+#include "libmesh/ignore_warnings.h"
+#include <BelosSolverManager.hpp>
+#include <BelosTpetraAdapter.hpp>
+#include <Tpetra_MultiVector.hpp>
+#include <Tpetra_Operator.hpp>
+#include "libmesh/restore_warnings.h"
+
+// C++ includes
+#include <string>
+
+namespace libMesh
+{
+
+/**
+ * This class provides an interface to the Belos iterative solvers,
+ * preconditioned by Ifpack2 (or by MueLu for \p AMG_PRECOND, when
+ * available), on \p TpetraMatrix and \p TpetraVector objects.  It is
+ * compatible with the \p libMesh \p LinearSolver<>.
+ */
+template <typename T>
+class BelosLinearSolver : public LinearSolver<T>
+{
+public:
+  /**
+   * The Tpetra types Belos works with.
+   */
+  typedef typename TpetraMatrix<T>::local_ordinal_type local_ordinal_type;
+  typedef typename TpetraMatrix<T>::global_ordinal_type global_ordinal_type;
+  typedef Tpetra::MultiVector<T, local_ordinal_type, global_ordinal_type> multivector_type;
+  typedef Tpetra::Operator<T, local_ordinal_type, global_ordinal_type> operator_type;
+
+  /**
+   *  Constructor. Initializes Belos data structures
+   */
+  BelosLinearSolver (const libMesh::Parallel::Communicator & comm);
+
+  /**
+   * Destructor.
+   */
+  ~BelosLinearSolver ();
+
+  /**
+   * Release all memory and clear data structures.
+   */
+  virtual void clear () override;
+
+  /**
+   * Initialize data structures if not done so already.
+   */
+  virtual void init (const char * name=nullptr) override;
+
+  /**
+   * Call the Belos solver.  It calls the method below, using the
+   * same matrix for the system and preconditioner matrices.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix_in,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) override
+  {
+    return this->solve(matrix_in, matrix_in, solution_in, rhs_in, tol, m_its);
+  }
+
+  /**
+   * This method allows you to call a linear solver while specifying
+   * the matrix the preconditioner is built from.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         SparseMatrix<T> & preconditioner,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix, but
+   * a sparse matrix is used as preconditioning matrix, this allowing
+   * other preconditioners than JACOBI.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         const SparseMatrix<T> & precond_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * Prints a useful message about why the latest linear solve
+   * con(di)verged.
+   */
+  virtual void print_converged_reason() const override;
+
+  /**
+   * \returns The solver's convergence flag
+   */
+  virtual LinearConvergenceReason get_converged_reason() const override;
+
+private:
+
+  /**
+   * \returns The Belos name of the user-specified solver stored in
+   * \p _solver_type
+   */
+  std::string belos_solver_name () const;
+
+  /**
+   * Builds the user-specified preconditioner stored in \p
+   * _preconditioner_type from \p precond, or returns null for none.
+   */
+  Teuchos::RCP<operator_type> build_preconditioner (TpetraMatrix<T> & precond) const;
+
+  /**
+   * The preconditioner from the last solve, kept when \p
+   * same_preconditioner is set.
+   */
+  Teuchos::RCP<operator_type> _precond;
+
+  /**
+   * The outcome of the last solve.
+   */
+  bool _converged;
+  unsigned int _n_iterations;
+  unsigned int _max_iterations;
+};
+
+
+/*----------------------- functions ----------------------------------*/
+template <typename T>
+inline
+BelosLinearSolver<T>::~BelosLinearSolver ()
+{
+  this->clear ();
+}
+
+} // namespace libMesh
+
+
+
+#endif // #ifdef LIBMESH_TRILINOS_HAVE_TPETRA_SOLVERS
+#endif // LIBMESH_TRILINOS_BELOS_LINEAR_SOLVER_H
@@ -0,0 +1,163 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ADAPTIVITY_DRIVER_H
+#define LIBMESH_ADAPTIVITY_DRIVER_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_ENABLE_AMR
+
+#include "libmesh/error_vector.h"
+#include "libmesh/mesh_refinement.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <iostream>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class EquationSystems;
+class ErrorEstimator;
+class System;
+
+
+/**
+ * This class runs one whole adaptive cycle - error estimation,
+ * flagging, refinement and coarsening, repartitioning and the
+ * reinitialization of every system on the new mesh - with less
+ * fixed overhead than calling each phase in turn.
+ *
+ * The error vector and the \p MeshRefinement object, with whatever
+ * flagging parameters the user sets on it, are kept from one cycle
+ * to the next.  Refinement is done without repartitioning, and the
+ * mesh is only repartitioned afterwards if the active elements have
+ * become more imbalanced across processors than \p max_imbalance().
+ * Nothing after flagging is done at all if no element changed.
+ *
+ * The time spent in each phase of the last cycle is recorded, and
+ * each phase is also logged to the libMesh performance log.
+ */
+class AdaptivityDriver : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  \p estimator is used to compute the error in
+   * whichever system is passed to \p adapt().
+   */
+  AdaptivityDriver (EquationSystems & es,
+                    ErrorEstimator & estimator);
+
+  /**
+   * The phases of an adaptive cycle.
+   */
+  enum Phase
+    {
+      ESTIMATE = 0,
+      FLAG,
+      REFINE,
+      PARTITION,
+      REINIT,
+      N_PHASES
+    };
+
+  /**
+   * Runs one adaptive cycle driven by the error in \p system.
+   *
+   * Elements are flagged by \p nelem_target() if it has been set on
+   * \p mesh_refinement(), or by error fraction otherwise.
+   *
+   * \returns \p true iff the mesh changed.
+   */
+  bool adapt (System & system);
+
+  /**
+   * \returns The \p MeshRefinement object used for flagging and
+   * refinement, so that its parameters can be set.
+   */
+  MeshRefinement & mesh_refinement() { return _mesh_refinement; }
+
+  /**
+   * The largest ratio of a processor's active elements to the
+   * average which is allowed before the mesh is repartitioned.
+   * Defaults to 1.1.  Setting 1 repartitions after every change.
+   */
+  Real & max_imbalance() { return _max_imbalance; }
+
+  /**
+   * \returns The error per cell computed in the last cycle.
+   */
+  const ErrorVector & error() const { return _error; }
+
+  /**
+   * \returns The ratio of the largest number of active elements on
+   * a processor to the average, measured after the last refinement.
+   */
+  Real last_imbalance() const { return _last_imbalance; }
+
+  /**
+   * \returns \p true iff the mesh was repartitioned in the last cycle.
+   */
+  bool repartitioned() const { return _repartitioned; }
+
+  /**
+   * \returns The seconds spent in phase \p p during the last cycle.
+   */
+  double phase_time (Phase p) const
+  { libmesh_assert_less (p, N_PHASES); return _phase_times[p]; }
+
+  /**
+   * Prints the time spent in each phase of the last cycle.
+   */
+  void print_phase_times (std::ostream & os = libMesh::out) const;
+
+private:
+
+  /**
+   * \returns The ratio of the largest number of active elements on
+   * a processor to the average.
+   */
+  Real active_imbalance () const;
+
+  EquationSystems & _es;
+
+  ErrorEstimator & _estimator;
+
+  MeshRefinement _mesh_refinement;
+
+  ErrorVector _error;
+
+  Real _max_imbalance;
+
+  Real _last_imbalance;
+
+  bool _repartitioned;
+
+  double _phase_times[N_PHASES];
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ENABLE_AMR
+
+#endif // LIBMESH_ADAPTIVITY_DRIVER_H
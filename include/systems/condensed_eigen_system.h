@@ -29,9 +29,15 @@
 #include "libmesh/eigen_system.h"
 #include "libmesh/sparse_matrix.h"
 
+// C++ includes
+#include <unordered_map>
+
 namespace libMesh
 {
 
+// Forward Declarations
+template <typename T> class DenseMatrix;
+
 /**
  * This class extends EigenSystem to allow a simple way of solving
  * (standard or generalized) eigenvalue problems in the case where
@@ -70,6 +76,20 @@ public:
    */
   sys_type & system () { return *this; }
 
+  /**
+   * Clear all the data structures associated with
+   * the system.
+   */
+  virtual void clear () override;
+
+  /**
+   * Reinitializes the member data fields associated with
+   * the system, so that, e.g., \p assemble() may be used.
+   *
+   * \note The condensed dofs have to be initialized again afterwards.
+   */
+  virtual void reinit () override;
+
   /**
    * Loop over the dofs on each processor to initialize the list
    * of non-condensed dofs. These are the dofs in the system that
@@ -81,6 +101,9 @@ public:
    * argument; simply call initialize_condensed_dofs() after any time
    * the EquationSystems (and therefore its constraint equations) gets
    * initialized or reinitialized.
+   *
+   * With \p use_condensed_assembly() this also sizes and preallocates
+   * the condensed matrices for assembly.
    */
   void initialize_condensed_dofs(const std::set<dof_id_type> &
                                  global_condensed_dofs_set =
@@ -106,6 +129,37 @@ public:
    */
   virtual std::pair<Real, Real> get_eigenpair(dof_id_type i) override;
 
+  /**
+   * \returns \p true if the condensed matrices are assembled
+   * directly, without any full system matrices.
+   */
+  bool use_condensed_assembly () const { return _use_condensed_assembly; }
+
+  /**
+   * Set whether the condensed matrices are assembled directly.  This
+   * must be set before the system is initialized; the full matrices
+   * \p matrix_A and \p matrix_B are then never built, so the user's
+   * assembly has to add its element matrices to \p condensed_matrix_A
+   * and \p condensed_matrix_B with \p add_to_condensed_matrix()
+   * instead.  Shell matrices are not supported.
+   */
+  void use_condensed_assembly (bool condensed_assembly)
+  { _use_condensed_assembly = condensed_assembly; }
+
+  /**
+   * Adds the element matrix \p Ke, whose rows and columns are the
+   * global \p dof_indices, to \p condensed_matrix, dropping the
+   * rows and columns of condensed dofs.  Any constraints should
+   * already have been applied to \p Ke, as by
+   * DofMap::constrain_element_matrix().
+   *
+   * This requires \p use_condensed_assembly(), and can be used once
+   * \p initialize_condensed_dofs() has been called.
+   */
+  void add_to_condensed_matrix (SparseMatrix<Number> & condensed_matrix,
+                                const DenseMatrix<Number> & Ke,
+                                const std::vector<dof_id_type> & dof_indices) const;
+
   /**
    * The (condensed) system matrix for standard eigenvalue problems.
    */
@@ -123,13 +177,46 @@ public:
    */
   std::vector<dof_id_type> local_non_condensed_dofs_vector;
 
+protected:
+
+  /**
+   * Only computes the sparsity pattern, without building any full
+   * matrices, with \p use_condensed_assembly().
+   */
+  virtual void init_matrices () override;
+
 private:
 
+  /**
+   * Numbers the non-condensed dofs which this processor owns or
+   * ghosts, and sizes and preallocates the condensed matrices for
+   * assembly.
+   */
+  void init_condensed_assembly ();
+
   /**
    * A private flag to indicate whether the condensed dofs
    * have been initialized.
    */
   bool condensed_dofs_initialized;
+
+  /**
+   * Whether the condensed matrices hold submatrices extracted for
+   * the current condensed dofs, whose structure can be reused by
+   * later extractions.
+   */
+  bool _have_condensed_submatrices;
+
+  /**
+   * Whether the condensed matrices are assembled directly.
+   */
+  bool _use_condensed_assembly;
+
+  /**
+   * The row of each non-condensed local or ghosted dof in the
+   * condensed matrices, when they are assembled directly.
+   */
+  std::unordered_map<dof_id_type, dof_id_type> _condensed_dof_index;
 };
 
 
@@ -105,6 +105,18 @@ public:
   const System & get_system() const
   { return _system; }
 
+  /**
+   * Reserves storage in the element solution, residual, Jacobian,
+   * QoI derivative and dof index containers for elements with up to
+   * \p max_n_dofs degrees of freedom, so that reinitializing on such
+   * elements doesn't need to allocate memory.
+   *
+   * Without this, that storage only grows as larger elements (e.g.
+   * at higher p levels) are encountered; in debug builds each such
+   * growth is counted in the performance log.
+   */
+  void reserve_elem_data (unsigned int max_n_dofs);
+
   /**
    * Accessor for element solution.
    */
@@ -567,6 +579,12 @@ public:
 
 protected:
 
+  /**
+   * \returns Whether the containers resized on every element can
+   * hold \p n_dofs degrees of freedom without allocating memory.
+   */
+  bool elem_data_fits (unsigned int n_dofs) const;
+
   /**
    * Contains pointers to vectors the user has asked to be localized, keyed with
    * pairs of element localized versions of that vector and per variable views
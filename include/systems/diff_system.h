@@ -29,6 +29,7 @@
 
 // C++ includes
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -195,7 +196,8 @@ public:
    */
   void attach_physics( DifferentiablePhysics * physics_in )
   { this->_diff_physics = (physics_in->clone_physics()).release();
-    this->_diff_physics->init_physics(*this);}
+    this->_diff_physics->init_physics(*this);
+    this->clear_context_pool(); }
 
   /**
    * Swap current physics object with external object
@@ -269,6 +271,43 @@ public:
    */
   virtual std::unique_ptr<DiffContext> build_context();
 
+  /**
+   * \returns A context which has been built by build_context() and
+   * initialized by init_context().  If \p reuse_contexts is true,
+   * this is taken from a pool of contexts released by earlier
+   * element loops when one is available.
+   *
+   * This method is thread-safe.
+   */
+  std::unique_ptr<DiffContext> acquire_context();
+
+  /**
+   * Returns a context obtained from acquire_context() to the pool if
+   * \p reuse_contexts is true, or destroys it otherwise.
+   *
+   * This method is thread-safe.
+   */
+  void release_context(std::unique_ptr<DiffContext> context);
+
+  /**
+   * Destroys any pooled contexts.  This is done automatically by
+   * reinit(), clear(), and when physics are attached or swapped;
+   * users whose init_context() depends on other data should call it
+   * whenever that data changes.
+   */
+  void clear_context_pool();
+
+  /**
+   * Set \p reuse_contexts to true to keep the contexts built and
+   * initialized for FEMSystem assembly and postprocessing loops
+   * around for reuse in later loops, which saves rebuilding FE
+   * objects, quadrature rules and element matrices on each pass when
+   * many passes are made over small numbers of elements.
+   *
+   * This is false by default.
+   */
+  bool reuse_contexts;
+
   /**
    * Executes a postprocessing loop over all elements, and if
    * \p postprocess_sides is true over all sides.
@@ -376,6 +415,11 @@ protected:
    */
   DifferentiableQoI * diff_qoi;
 
+  /**
+   * Contexts kept for reuse when \p reuse_contexts is true.
+   */
+  std::vector<std::unique_ptr<DiffContext>> _context_pool;
+
   /**
    * Initializes the member data fields associated with
    * the system, so that, e.g., \p assemble() may be used.
@@ -0,0 +1,140 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_ELEM_BATCH_ASSEMBLY_H
+#define LIBMESH_ELEM_BATCH_ASSEMBLY_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_batch.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class System;
+template <typename T> class NumericVector;
+template <typename T> class SparseMatrix;
+
+/**
+ * This class assembles a matrix and/or right hand side for one
+ * scalar variable of a \p System a batch of elements at a time,
+ * rather than through one virtual callback per element as \p
+ * FEMSystem does.
+ *
+ * The local active elements on which the variable is active are
+ * grouped by type and p level into batches of at most \p batch_size
+ * elements, whose shape functions are evaluated together by an \p
+ * FEBatch.  A user \p Kernel is then called once per batch, and
+ * fills the element matrices and vectors of the whole batch in flat
+ * arrays with the element index varying fastest, the same layout
+ * \p FEBatch uses for its shape function tables.  Since a kernel
+ * sees only plain contiguous arrays, its body can vectorize across
+ * the elements of a batch, or hand the arrays to an accelerator
+ * (e.g. by wrapping them in unmanaged Kokkos views) without any
+ * per-element calls back into the library.
+ *
+ * The results are constrained and added to the global matrix and
+ * vector on the host, element by element, through the usual \p
+ * SparseMatrix and \p NumericVector interfaces, so that whatever
+ * preallocation and insertion those use applies here too.
+ */
+class ElemBatchAssembly
+{
+public:
+
+  /**
+   * The abstract base class for batched element kernels.
+   */
+  class Kernel
+  {
+  public:
+    virtual ~Kernel () = default;
+
+    /**
+     * Computes the element matrices \p Ke and element vectors \p Fe
+     * of every element in \p elems, whose shape functions have been
+     * evaluated by \p fe.  Entry \p (i,j) of the matrix of element
+     * \p e is \p Ke[ElemBatchAssembly::matrix_index(fe,i,j,e)], and
+     * entry \p i of its vector is \p Fe[ElemBatchAssembly::vector_index(fe,i,e)].
+     * Both arrays arrive zeroed; either is \p nullptr if it isn't
+     * being assembled.
+     */
+    virtual void element_batch (const FEBatch & fe,
+                                const std::vector<const Elem *> & elems,
+                                Real * Ke,
+                                Real * Fe) const = 0;
+  };
+
+  /**
+   * Constructor.  Assembles for variable \p var of \p sys, with a
+   * quadrature rule \p extra_quadrature_order orders higher than the
+   * variable's default.
+   */
+  ElemBatchAssembly (const System & sys,
+                     const unsigned int var,
+                     const int extra_quadrature_order = 0);
+
+  /**
+   * The most elements in a batch.  Defaults to 256.
+   */
+  unsigned int batch_size;
+
+  /**
+   * Runs \p kernel on every batch, and adds the constrained results
+   * to \p matrix and \p rhs.  Either of those may be \p nullptr,
+   * but not both.  Neither is zeroed or closed here.
+   */
+  void assemble (const Kernel & kernel,
+                 SparseMatrix<Number> * matrix,
+                 NumericVector<Number> * rhs) const;
+
+  /**
+   * \returns The index of entry \p (i,j) of the matrix of batch
+   * element \p e in a kernel's \p Ke array.
+   */
+  static std::size_t matrix_index (const FEBatch & fe,
+                                   unsigned int i,
+                                   unsigned int j,
+                                   unsigned int e)
+  { return (std::size_t(i) * fe.n_shape_functions() + j) * fe.n_elem() + e; }
+
+  /**
+   * \returns The index of entry \p i of the vector of batch element
+   * \p e in a kernel's \p Fe array.
+   */
+  static std::size_t vector_index (const FEBatch & fe,
+                                   unsigned int i,
+                                   unsigned int e)
+  { return std::size_t(i) * fe.n_elem() + e; }
+
+private:
+
+  const System & _sys;
+
+  const unsigned int _var;
+
+  const int _extra_quadrature_order;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_BATCH_ASSEMBLY_H
@@ -321,9 +321,15 @@ public:
    * \returns A std::unique_ptr to a node-major NumericVector of total
    * length n_nodes*n_vars that various I/O classes can then use to
    * get the local values they need to write on each processor.
+   *
+   * If \p var_names!=nullptr, only the variables (or, for vector-valued
+   * variables, the components) with names in it are included, and
+   * n_vars counts only those; their order is still that of
+   * \p build_variable_names().
    */
   std::unique_ptr<NumericVector<Number>>
-  build_parallel_solution_vector(const std::set<std::string> * system_names=nullptr) const;
+  build_parallel_solution_vector(const std::set<std::string> * system_names=nullptr,
+                                 const std::vector<std::string> * var_names=nullptr) const;
 
   /**
    * Retrieve \p vars_active_subdomains, which indicates the active
@@ -93,6 +93,20 @@ public:
    */
   void use_unweighted_quadrature_rules(int extra_quadrature_order=0);
 
+  /**
+   * Use quadrature rules designed to over-integrate a mass matrix,
+   * plus \p affine_extra_quadrature_order on elements with affine
+   * maps and plus \p curved_extra_quadrature_order on the others.
+   *
+   * With constant coefficients a negative extra order, e.g. -1, still
+   * integrates mass matrices exactly on affine elements, and curved
+   * elements such as Tet10 or Hex27 with non-affine maps often want
+   * a positive one.  The rules returned by get_element_qrule() etc.
+   * are then only valid for the current element.
+   */
+  void use_adaptive_quadrature_rules(int affine_extra_quadrature_order,
+                                     int curved_extra_quadrature_order);
+
   /**
    * Reports if the boundary id is found on the current side
    */
@@ -1003,6 +1017,28 @@ public:
    */
   void set_jacobian_tolerance(Real tol);
 
+  /**
+   * If \p lazy is true, elem_fe_reinit() defers reinitializing each
+   * interior FE object until it is first requested via
+   * get_element_fe() on that element, so physics which only look at
+   * some of their variables on some elements don't pay for the rest.
+   *
+   * This is false by default, because code which caches references to
+   * FE data (e.g. from get_phi()) and reads it without going through
+   * get_element_fe() again would see stale values.  Either way, FE
+   * objects used only by variables which are inactive on the current
+   * subdomain are deferred, and moving-mesh contexts are never lazy.
+   */
+  void set_lazy_elem_fe_reinit(bool lazy)
+  { _lazy_elem_fe_reinit = lazy; }
+
+  /**
+   * \returns Whether interior FE reinitialization is being deferred
+   * until first access.
+   */
+  bool lazy_elem_fe_reinit() const
+  { return _lazy_elem_fe_reinit; }
+
   /**
    * System from which to acquire moving mesh information
    */
@@ -1221,6 +1257,23 @@ protected:
    */
   int _extra_quadrature_order;
 
+  /**
+   * Quadrature rules for elements with non-affine maps, if we are
+   * using adaptive quadrature rules.  Whichever set of rules isn't
+   * appropriate for the current element is stored here, swapped with
+   * the ones above when the element changes.
+   */
+  std::vector<std::unique_ptr<QBase>> _alternate_element_qrule;
+  std::vector<std::unique_ptr<QBase>> _alternate_side_qrule;
+  std::unique_ptr<QBase> _alternate_edge_qrule;
+
+  /**
+   * Whether we are using adaptive quadrature rules, and if so whether
+   * the rules for non-affine elements are currently attached.
+   */
+  bool _adaptive_quadrature;
+  bool _curved_quadrature_attached;
+
 private:
   /**
    * Helper function used in constructors to set up internal data.
@@ -1243,6 +1296,40 @@ private:
    * system which created this context.
    */
   void _update_time_from_system(Real theta);
+
+  /**
+   * Swaps our affine and non-affine quadrature rules and reattaches
+   * them to our FE objects.
+   */
+  void _swap_quadrature_rules();
+
+  /**
+   * Reinitializes \p fe on the element last passed to
+   * elem_fe_reinit(), if that reinitialization was deferred and
+   * hasn't happened yet.
+   */
+  void _reinit_pending_elem_fe(FEAbstract * fe) const;
+
+  /**
+   * Whether to defer element FE reinitialization until first access.
+   */
+  bool _lazy_elem_fe_reinit;
+
+  /**
+   * Interior FE objects whose reinitialization on the current element
+   * has been deferred, along with the element and any custom points
+   * to reinitialize them with.
+   */
+  mutable std::vector<FEAbstract *> _pending_elem_fe;
+  const Elem * _pending_elem_fe_elem;
+  std::vector<Point> _pending_elem_fe_pts;
+  bool _pending_elem_fe_use_pts;
+
+  /**
+   * Scratch space for the FE objects needed by the variables active
+   * on the current subdomain.
+   */
+  std::vector<FEAbstract *> _active_elem_fe;
 };
 
 
@@ -1264,6 +1351,8 @@ void FEMContext::get_element_fe( unsigned int var, FEGenericBase<OutputShape> *&
 {
   libmesh_assert( !_element_fe_var[dim].empty() );
   libmesh_assert_less ( var, (_element_fe_var[dim].size() ) );
+  if (!_pending_elem_fe.empty())
+    this->_reinit_pending_elem_fe(_element_fe_var[dim][var]);
   fe = cast_ptr<FEGenericBase<OutputShape> *>( (_element_fe_var[dim][var] ) );
 }
 
@@ -1273,6 +1362,8 @@ void FEMContext::get_element_fe( unsigned int var, FEAbstract *& fe,
 {
   libmesh_assert( !_element_fe_var[dim].empty() );
   libmesh_assert_less ( var, (_element_fe_var[dim].size() ) );
+  if (!_pending_elem_fe.empty())
+    this->_reinit_pending_elem_fe(_element_fe_var[dim][var]);
   fe = _element_fe_var[dim][var];
 }
 
@@ -1281,6 +1372,8 @@ FEBase * FEMContext::get_element_fe( unsigned int var, unsigned short dim ) cons
 {
   libmesh_assert( !_element_fe_var[dim].empty() );
   libmesh_assert_less ( var, (_element_fe_var[dim].size() ) );
+  if (!_pending_elem_fe.empty())
+    this->_reinit_pending_elem_fe(_element_fe_var[dim][var]);
   return cast_ptr<FEBase *>( (_element_fe_var[dim][var] ) );
 }
 
@@ -0,0 +1,74 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FEM_JACOBIAN_SHELL_MATRIX_H
+#define LIBMESH_FEM_JACOBIAN_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEMSystem;
+
+/**
+ * This class applies the Jacobian of an \p FEMSystem, as
+ * \p FEMSystem::assembly() would assemble it into the system matrix,
+ * without ever storing it: each product recomputes the element
+ * Jacobians and applies them element by element.  This trades
+ * repeated element assembly for the memory of the global sparse
+ * matrix, which can pay off for high order discretizations.
+ *
+ * The Jacobian is evaluated at the system's
+ * \link System::current_local_solution current_local_solution \endlink,
+ * so callers should \p update() the system after changing its
+ * solution.  All overridden virtual functions are documented in
+ * shell_matrix.h.
+ */
+class FEMJacobianShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor; applies the Jacobian of \p sys.
+   */
+  explicit
+  FEMJacobianShellMatrix (FEMSystem & sys);
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const override;
+
+  virtual void get_diagonal (NumericVector<Number> & dest) const override;
+
+private:
+  FEMSystem & _sys;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FEM_JACOBIAN_SHELL_MATRIX_H
@@ -33,6 +33,8 @@ namespace libMesh
 // Forward Declarations
 class DiffContext;
 class FEMContext;
+class ScalarBorder;
+class StaticCondensation;
 
 
 /**
@@ -94,6 +96,36 @@ public:
                          bool apply_heterogeneous_constraints = false,
                          bool apply_no_constraints = false) override;
 
+  /**
+   * Approximates each -(partial R / partial p) by central
+   * differences, as \p ImplicitSystem does, but in a single sweep
+   * over the elements: each element is reinitialized once and its
+   * residual evaluated at every parameter perturbation in turn.
+   *
+   * Since parameters are perturbed in place, the sweep isn't
+   * threaded.  Systems with interior face terms or SCALAR variables
+   * fall back to perturbing whole assemblies.
+   */
+  virtual void assemble_residual_derivatives (const ParameterVector & parameters) override;
+
+  /**
+   * Adds the action of the (constrained) system Jacobian on \p arg
+   * to \p dest, without assembling the Jacobian.  Element Jacobians
+   * are computed just as in \p assembly(), constrained, multiplied
+   * by the corresponding entries of \p arg, and summed into \p dest,
+   * so that the result matches multiplying by an assembled \p matrix.
+   * As with \p assembly(), the Jacobian is evaluated at the
+   * \link current_local_solution \endlink.
+   */
+  void jacobian_vector_mult_add (NumericVector<Number> & dest,
+                                 const NumericVector<Number> & arg);
+
+  /**
+   * Sets \p dest to the diagonal of the (constrained) system
+   * Jacobian, without assembling the Jacobian.
+   */
+  void jacobian_diagonal (NumericVector<Number> & dest);
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
@@ -169,6 +201,66 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * If static_condensation is true (it is false by default), the
+   * element-interior degrees of freedom are condensed out of each
+   * element Jacobian, so that the system matrix only couples
+   * skeleton dofs and linear solves are much smaller for high order
+   * elements.  This must be set before the system is initialized.
+   */
+  bool static_condensation;
+
+  /**
+   * \returns The static condensation of this system, or \p nullptr
+   * if \p static_condensation is off.
+   */
+  virtual StaticCondensation * get_static_condensation () const override;
+
+  /**
+   * If scalar_border is true (it is false by default), the couplings
+   * between SCALAR variables and the rest of the system are kept out
+   * of the system matrix, in a \p ScalarBorder which linear solves
+   * eliminate through a small dense Schur complement, so that SCALAR
+   * dofs no longer give the matrix dense rows and columns.  This
+   * must be set before the system is initialized, and can't be
+   * combined with \p static_condensation.
+   */
+  bool scalar_border;
+
+  /**
+   * \returns The SCALAR border of this system, or \p nullptr if
+   * \p scalar_border is off.
+   */
+  virtual ScalarBorder * get_scalar_border () const override;
+
+  /**
+   * If cache_matrix_insertion is true (it is false by default), the
+   * position in the system matrix storage of each element Jacobian
+   * entry is found once and kept until the next reinit(), so that
+   * later assemblies add element Jacobians straight into the matrix
+   * values rather than locating every entry in the sparsity pattern
+   * again.  This only has an effect on matrices which support direct
+   * insertion (PETSc AIJ matrices, after their first assembly), and
+   * requires that the matrix sparsity pattern not change between
+   * reinit()s.
+   */
+  bool cache_matrix_insertion;
+
+  /**
+   * Clears the cached matrix insertion offsets, then reinitializes
+   * as the parent does.
+   */
+  virtual void reinit () override;
+
+  /**
+   * Adds \p elem_jacobian, with indices \p dof_indices, to the system
+   * matrix during assembly(), inserting directly at the offsets cached
+   * for \p elem if \p cache_matrix_insertion allows.
+   */
+  void add_elem_jacobian (const Elem & elem,
+                          const DenseMatrix<Number> & elem_jacobian,
+                          const std::vector<dof_id_type> & dof_indices) const;
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
@@ -249,7 +341,44 @@ protected:
   virtual void init_data () override;
 
 private:
+  /**
+   * Loops over elements (and nonlocal SCALAR dofs) as in
+   * \p assembly(), adding constrained element Jacobian products with
+   * the ghosted vector \p arg to \p dest and/or element Jacobian
+   * diagonals to \p diagonal, whichever are non-null.
+   */
+  void matrix_free_products (const NumericVector<Number> * arg,
+                             NumericVector<Number> * dest,
+                             NumericVector<Number> * diagonal);
+
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * The element blocks of a condensed Jacobian, if
+   * \p static_condensation is on.
+   */
+  std::unique_ptr<StaticCondensation> _static_condensation;
+
+  /**
+   * The border of the Jacobian on SCALAR dofs, if \p scalar_border
+   * is on.
+   */
+  std::unique_ptr<ScalarBorder> _scalar_border;
+
+  /**
+   * Whether the system matrix is being inserted into directly in
+   * the current assembly.
+   */
+  bool _inserting_directly;
+
+  /**
+   * The dof indices of each element Jacobian, by element id, and the
+   * offsets at which its entries are inserted into the system matrix,
+   * when \p cache_matrix_insertion is on.  Threads only touch the
+   * entries of their own elements.
+   */
+  mutable std::vector<std::vector<dof_id_type>> _insertion_dofs;
+  mutable std::vector<std::vector<numeric_index_type>> _insertion_offsets;
 };
 
 // --------------------------------------------------------------
@@ -57,6 +57,17 @@ namespace libMesh
  *   of \p EquationSystems<FrequencySystem> named "current frequency".
  *   For this to work, only provide one frequency.
  *
+ * - Solution from frequency-independent components:
+ *   When the system matrix is a polynomial in the frequency, e.g.
+ *   \f$ A(\omega) = K + i \omega C - \omega^2 M \f$, each coefficient
+ *   matrix may be registered through \p add_frequency_matrix() and
+ *   filled once by the user's assembly function.  \p solve() then
+ *   forms the system matrix for each frequency by matrix additions,
+ *   and \p _solve_fptr becomes optional.  Every such matrix shares
+ *   the sparsity pattern of the system matrix, so the linear solver
+ *   can keep its symbolic factorizations across frequencies, and with
+ *   \p preconditioner_lag it can keep the preconditioner as well.
+ *
  * \author Daniel Dreyer
  * \date 2003
  */
@@ -189,6 +200,28 @@ public:
   void (* solve_system) (EquationSystems & es,
                          const std::string & name);
 
+  /**
+   * Adds a frequency-independent matrix named \p mat_name, to be
+   * filled by the user's assembly function, which enters the system
+   * matrix at each frequency multiplied by \p factor * frequency^\p
+   * power.  Once any such matrix is added, \p solve() forms the
+   * system matrix from them, after which the user-supplied solve
+   * function, if any, may add further contributions.  The rhs is left
+   * to the assembly and solve functions.
+   */
+  SparseMatrix<Number> & add_frequency_matrix (const std::string & mat_name,
+                                               const unsigned int power,
+                                               const Number factor = 1.);
+
+  /**
+   * In a solve over several frequencies, the linear solver
+   * preconditioner is rebuilt only for every preconditioner_lag-th
+   * frequency and reused for the frequencies in between, which pays
+   * off when the frequencies are closely spaced.  This is set to 1,
+   * rebuilding at every frequency, by default.
+   */
+  unsigned int preconditioner_lag;
+
   /**
    * \returns The number of iterations and the final residual.
    */
@@ -226,6 +259,12 @@ protected:
    */
   void set_current_frequency(unsigned int n);
 
+  /**
+   * Forms the system matrix for the current frequency from the
+   * matrices added with \p add_frequency_matrix().
+   */
+  void form_frequency_matrix();
+
   /**
    * true when we have frequencies to solve for.
    * Setting the frequencies is the first step after
@@ -269,6 +308,14 @@ protected:
    */
   std::vector<std::pair<unsigned int, Real>> vec_rval;
 
+  /**
+   * The names of the frequency-independent matrices, with the power
+   * of the frequency and the factor multiplying each.
+   */
+  std::vector<std::string> _frequency_matrix_names;
+  std::vector<unsigned int> _frequency_matrix_powers;
+  std::vector<Number> _frequency_matrix_factors;
+
 };
 
 
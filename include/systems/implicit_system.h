@@ -31,6 +31,8 @@ namespace libMesh
 {
 
 // Forward declarations
+class ScalarBorder;
+class StaticCondensation;
 template <typename T> class LinearSolver;
 template <typename T> class SparseMatrix;
 
@@ -151,6 +153,22 @@ public:
    */
   virtual void release_linear_solver(LinearSolver<Number> *) const;
 
+  /**
+   * \returns The static condensation of element-interior dofs which
+   * solvers should apply to linear solves with \p matrix, or \p
+   * nullptr (the default) if \p matrix is uncondensed.
+   */
+  virtual StaticCondensation * get_static_condensation () const
+  { return nullptr; }
+
+  /**
+   * \returns The border of SCALAR dof couplings which solvers should
+   * add to \p matrix for linear solves, or \p nullptr (the default)
+   * if \p matrix is the whole Jacobian.
+   */
+  virtual ScalarBorder * get_scalar_border () const
+  { return nullptr; }
+
   /**
    * Assembles a residual in \p rhs and/or a jacobian in \p matrix,
    * as requested.
@@ -404,6 +422,14 @@ public:
    */
   bool zero_out_matrix_and_rhs;
 
+  /**
+   * If this flag is true, \p assemble() tells the system matrix that
+   * every assembly fills the same nonzero pattern (see
+   * SparseMatrix::reuse_nonzero_pattern()), which saves repeated work
+   * e.g. across Newton steps.  Defaults to false.
+   */
+  bool reuse_nonzero_pattern;
+
 protected:
 
   /**
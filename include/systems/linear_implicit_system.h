@@ -25,6 +25,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <memory>
 
 namespace libMesh
 {
@@ -33,6 +34,7 @@ namespace libMesh
 // Forward Declarations
 template <typename T> class LinearSolver;
 template <typename T> class ShellMatrix;
+template <typename T> class SinglePrecisionShellMatrix;
 
 
 /**
@@ -107,7 +109,43 @@ public:
    * use the \p assemble() in derived classes.
    * Should be overridden in derived classes.
    */
-  virtual void assemble () override { ImplicitSystem::assemble(); }
+  virtual void assemble () override;
+
+  /**
+   * Assembles \p rhs alone, with the function or object attached by
+   * \p attach_assemble_rhs_function() or \p attach_assemble_rhs_object().
+   */
+  virtual void assemble_rhs ();
+
+  /**
+   * Register a user function which assembles the right hand side
+   * alone.  Once one is attached, \p solve() only reassembles
+   * \p matrix when it has changed: before the first solve, after
+   * the mesh changes, or after \p matrix_changed().  The rest of the
+   * time it assembles \p rhs alone and reuses the preconditioner
+   * built for \p matrix.  The function attached by
+   * \p attach_assemble_function() must still assemble both.
+   */
+  void attach_assemble_rhs_function (void fptr(EquationSystems & es,
+                                               const std::string & name));
+
+  /**
+   * Register a user object which assembles the right hand side
+   * alone, as \p attach_assemble_rhs_function() describes.
+   */
+  void attach_assemble_rhs_object (Assembly & assemble);
+
+  /**
+   * Tells the system that \p matrix needs reassembly before the next
+   * solve, e.g. because a coefficient in it has changed.
+   */
+  void matrix_changed () { _matrix_is_assembled = false; }
+
+  /**
+   * \returns \p true if \p matrix has been assembled and is still
+   * up to date.
+   */
+  bool matrix_is_assembled () const { return _matrix_is_assembled; }
 
   /**
    * After calling this method, any solve will be limited to the given
@@ -190,8 +228,35 @@ public:
    */
   ShellMatrix<Number> * get_shell_matrix() { return _shell_matrix; }
 
+  /**
+   * When nonzero, and no shell matrix is attached, \p solve() keeps a
+   * single precision copy of \p matrix and takes up to this many
+   * steps of iterative refinement: each step computes the residual
+   * with \p matrix at full precision and solves for its correction
+   * with the single precision copy, to a relative tolerance no
+   * tighter than single precision can reach.  The preconditioner is
+   * still built from \p matrix, or the "Preconditioner" matrix if
+   * there is one.  Defaults to 0, which solves with \p matrix
+   * directly.
+   */
+  unsigned int mixed_precision_refinement_steps;
+
 protected:
 
+  /**
+   * Forgets that \p matrix was assembled, as well as any other
+   * cached data.
+   */
+  virtual void disable_cache () override;
+
+  /**
+   * Solves the linear system by iterative refinement on a single
+   * precision copy of \p matrix, as \p mixed_precision_refinement_steps
+   * describes.
+   */
+  std::pair<unsigned int, Real> mixed_precision_solve (const double tol,
+                                                       const unsigned int maxits);
+
   /**
    * The number of linear iterations required to solve the linear
    * system Ax=b.
@@ -218,6 +283,29 @@ protected:
    * what happens with the dofs outside the subset.
    */
   SubsetSolveMode _subset_solve_mode;
+
+  /**
+   * The single precision copy of \p matrix used by
+   * \p mixed_precision_solve(), or \p nullptr if we have not needed
+   * one yet.
+   */
+  std::unique_ptr<SinglePrecisionShellMatrix<Number>> _single_precision_matrix;
+
+  /**
+   * Function which assembles \p rhs alone, or \p nullptr.
+   */
+  void (* _assemble_rhs_function) (EquationSystems & es,
+                                   const std::string & name);
+
+  /**
+   * Object which assembles \p rhs alone, or \p nullptr.
+   */
+  Assembly * _assemble_rhs_object;
+
+  /**
+   * Whether \p matrix is up to date with the last \p assemble().
+   */
+  bool _matrix_is_assembled;
 };
 
 } // namespace libMesh
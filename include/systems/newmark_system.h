@@ -88,6 +88,16 @@ public:
    */
   virtual void assemble () override;
 
+  /**
+   * Solves the system with a new right hand side.  Since the
+   * effective matrix only changes with the Newmark parameters, the
+   * preconditioner or factorization built for it in the first solve
+   * is reused in the following ones, unless \p constant_matrix is
+   * false.  Call \p matrix_changed() after modifying \p matrix to
+   * have it rebuilt once.
+   */
+  virtual void solve () override;
+
   /**
    * \returns \p "Newmark".  Helps in identifying
    * the system type in an equation system file.
@@ -123,12 +133,23 @@ public:
   /**
    * Set the time step size and the newmark parameter alpha and
    * delta and calculate the constant parameters used for
-   * time integration.
+   * time integration.  If the system has already been assembled,
+   * the effective matrix is recomputed from the stiffness, mass and
+   * damping matrices, so any changes made directly to \p matrix,
+   * e.g. for boundary conditions, must be made again.
    */
   void set_newmark_parameters (const Real delta_T = _default_timestep,
                                const Real alpha   = _default_alpha,
                                const Real delta   = _default_delta);
 
+  /**
+   * Whether the effective matrix is the same in every time step, so
+   * that its preconditioner can be kept from one solve to the next.
+   * This is true by default; set it to false if \p matrix is
+   * modified between solves without calling \p matrix_changed().
+   */
+  bool constant_matrix;
+
 private:
 
   /**
@@ -148,6 +169,12 @@ private:
    */
   bool _finished_assemble;
 
+  /**
+   * \p true if the linear solver has built its preconditioner for
+   * the current effective matrix.
+   */
+  bool _matrix_solved;
+
   /**
    * Default Newmark \p alpha
    */
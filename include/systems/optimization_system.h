@@ -109,6 +109,30 @@ public:
   };
 
 
+  /**
+   * Abstract base class to be used to calculate the objective
+   * function and its gradient together, for problems where most of
+   * the work of each can be shared.
+   */
+  class ComputeObjectiveAndGradient
+  {
+  public:
+    virtual ~ComputeObjectiveAndGradient () {}
+
+    /**
+     * This function will be called to compute both the objective
+     * function and its gradient at the iterate \p X, whenever the
+     * optimization solver needs both there.  Set \p grad_f to be the
+     * gradient.
+     *
+     * \returns The value of the objective function at \p X.
+     */
+    virtual Number objective_and_gradient (const NumericVector<Number> & X,
+                                           NumericVector<Number> & grad_f,
+                                           sys_type & S) = 0;
+  };
+
+
   /**
    * Abstract base class to be used to calculate the Hessian
    * of an objective function.
@@ -129,6 +153,27 @@ public:
                           sys_type & S) = 0;
   };
 
+  /**
+   * Abstract base class to be used to apply the Hessian of an
+   * objective function without assembling it.
+   */
+  class ComputeHessianVectorProduct
+  {
+  public:
+    virtual ~ComputeHessianVectorProduct () {}
+
+    /**
+     * This function will be called to compute the product of the
+     * Hessian of the objective function at the iterate \p X with the
+     * vector \p v, and must be implemented by the user in a derived
+     * class.  Set \p H_v, which arrives zeroed, to be the product.
+     */
+    virtual void hessian_vector_product (const NumericVector<Number> & X,
+                                         const NumericVector<Number> & v,
+                                         NumericVector<Number> & H_v,
+                                         sys_type & S) = 0;
+  };
+
   /**
    * Abstract base class to be used to calculate the equality constraints.
    */
@@ -0,0 +1,166 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_SCALAR_BORDER_H
+#define LIBMESH_SCALAR_BORDER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class System;
+template <typename T> class LinearSolver;
+template <typename T> class NumericVector;
+template <typename T> class SparseMatrix;
+
+/**
+ * This class keeps the couplings of a system's SCALAR degrees of
+ * freedom out of its sparse matrix.  SCALAR dofs couple to every
+ * element, so in the sparse matrix their rows and columns would be
+ * dense, which makes preallocation and matrix-vector products both
+ * expensive and badly balanced.  We write the Jacobian as
+ *
+ * \f[ J = \left[ \begin{array}{cc} A & B \\ C & D \end{array} \right] \f]
+ *
+ * with \f$ s \f$ the few SCALAR dofs.  Only the core block \f$ A \f$,
+ * with an identity on the SCALAR rows, goes into the system matrix.
+ * The border columns \f$ B \f$ and rows \f$ C \f$ are kept as one
+ * parallel vector per SCALAR dof, and \f$ D \f$ as a small dense
+ * matrix on every processor.
+ *
+ * Linear solves eliminate \f$ s \f$ through the dense Schur complement
+ * \f$ D - C A^{-1} B \f$.  Building it takes one sparse solve per
+ * SCALAR dof, and it is kept until the next Jacobian assembly, so
+ * that each linear solve after that takes only one sparse solve.
+ */
+class ScalarBorder
+{
+public:
+  /**
+   * Constructor; borders the SCALAR dofs of \p sys.
+   */
+  explicit
+  ScalarBorder (const System & sys);
+
+  /**
+   * Destructor.
+   */
+  ~ScalarBorder ();
+
+  /**
+   * Zeroes the border, before a new Jacobian assembly.
+   */
+  void clear ();
+
+  /**
+   * Splits the (constrained) element Jacobian \p K on \p dof_indices
+   * into its core block, which is returned in \p core on \p
+   * core_dofs, and its border, which is added to ours.
+   *
+   * Distinct elements may be bordered concurrently.
+   */
+  void border_element (const DenseMatrix<Number> & K,
+                       const std::vector<dof_id_type> & dof_indices,
+                       DenseMatrix<Number> & core,
+                       std::vector<dof_id_type> & core_dofs);
+
+  /**
+   * Finishes the border once every element has been added, and adds
+   * the identity on the SCALAR rows to \p matrix.  This must be
+   * called on every processor.
+   */
+  void close (SparseMatrix<Number> & matrix);
+
+  /**
+   * Solves the bordered system with core block \p matrix, which
+   * \p solver is applied to with preconditioner matrix \p precond, for
+   * \p solution.  The tolerance and iteration limit are used for each
+   * sparse solve.
+   *
+   * \returns The total number of sparse solver iterations, and the
+   * final residual of the last sparse solve.
+   */
+  std::pair<unsigned int, Real>
+  solve (LinearSolver<Number> & solver,
+         SparseMatrix<Number> & matrix,
+         SparseMatrix<Number> * precond,
+         NumericVector<Number> & solution,
+         const NumericVector<Number> & rhs,
+         double tol,
+         unsigned int max_its);
+
+  /**
+   * \returns The number of SCALAR dofs.
+   */
+  unsigned int n_scalar_dofs () const { return _n_scalar; }
+
+private:
+
+  /**
+   * \returns \p true if \p dof is a SCALAR dof.
+   */
+  bool is_scalar (dof_id_type dof) const
+  { return dof >= _first_scalar; }
+
+  const System & _system;
+
+  /**
+   * The SCALAR dofs are the last \p _n_scalar, from \p _first_scalar.
+   */
+  dof_id_type _first_scalar;
+  unsigned int _n_scalar;
+
+  /**
+   * The border column \f$ B e_j \f$ and row \f$ C^T e_j \f$ of each
+   * SCALAR dof j, with zeros on the SCALAR rows.
+   */
+  std::vector<std::unique_ptr<NumericVector<Number>>> _columns, _rows;
+
+  /**
+   * \f$ D \f$, summed over processors by \p close().
+   */
+  DenseMatrix<Number> _D;
+
+  /**
+   * \f$ A^{-1} B e_j \f$ for each SCALAR dof j, and the Schur
+   * complement, LU factored in place by its first solve, once
+   * they've been computed for the current border.
+   */
+  std::vector<std::unique_ptr<NumericVector<Number>>> _A_inv_columns;
+  DenseMatrix<Number> _schur;
+  bool _have_schur;
+
+  /**
+   * Serializes additions to the border.
+   */
+  Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SCALAR_BORDER_H
@@ -0,0 +1,144 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_STATIC_CONDENSATION_H
+#define LIBMESH_STATIC_CONDENSATION_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class System;
+template <typename T> class NumericVector;
+
+/**
+ * This class statically condenses the element-interior degrees of
+ * freedom (see \p DofMap::interior_dof_indices()) out of a system's
+ * linear solves.  Each element Jacobian
+ *
+ * \f[ K = \left[ \begin{array}{cc} K_{ii} & K_{is} \\ K_{si} & K_{ss} \end{array} \right] \f]
+ *
+ * is split into interior and skeleton blocks.  Only the Schur
+ * complement \f$ K_{ss} - K_{si} K_{ii}^{-1} K_{is} \f$ goes into
+ * the global matrix, with an identity on the interior rows, while
+ * the factored \f$ K_{ii} \f$ and the coupling blocks are kept to
+ * condense right hand sides and to recover the interior solution
+ * afterward.  The global matrix then has the sparsity of the
+ * skeleton system, which for high order elements is much smaller.
+ *
+ * The global right hand side stays uncondensed, so that residual
+ * norms are unchanged; solvers condense a copy of it with \p
+ * condense_rhs() before solving, and call \p back_substitute() after.
+ */
+class StaticCondensation
+{
+public:
+  /**
+   * Constructor; condenses the interior dofs of \p sys.
+   */
+  explicit
+  StaticCondensation (const System & sys);
+
+  /**
+   * Forgets all stored element blocks, before a new assembly.
+   */
+  void clear ();
+
+  /**
+   * Splits the (constrained) element Jacobian \p K on \p dof_indices
+   * into interior and skeleton blocks, and stores what we need of
+   * them for \p elem.  \p schur returns the Schur complement on
+   * \p skeleton_dofs, and \p interior_dofs the dofs whose rows get an
+   * identity instead.
+   *
+   * Distinct elements may be condensed concurrently.
+   */
+  void condense_element (const Elem & elem,
+                         const DenseMatrix<Number> & K,
+                         const std::vector<dof_id_type> & dof_indices,
+                         DenseMatrix<Number> & schur,
+                         std::vector<dof_id_type> & skeleton_dofs,
+                         std::vector<dof_id_type> & interior_dofs);
+
+  /**
+   * Sets \p condensed_rhs to \p rhs, with the skeleton entries
+   * reduced by \f$ K_{si} K_{ii}^{-1} F_i \f$ on each element.
+   */
+  void condense_rhs (const NumericVector<Number> & rhs,
+                     NumericVector<Number> & condensed_rhs);
+
+  /**
+   * Replaces the interior entries of \p solution, whose skeleton
+   * entries solve the condensed system, by
+   * \f$ K_{ii}^{-1} (F_i - K_{is} x_s) \f$ with \f$ F \f$ the
+   * uncondensed \p rhs.
+   */
+  void back_substitute (const NumericVector<Number> & rhs,
+                        NumericVector<Number> & solution);
+
+private:
+
+  /**
+   * What we keep of each element Jacobian.
+   */
+  struct ElementBlocks
+  {
+    std::vector<dof_id_type> interior_dofs, skeleton_dofs;
+
+    /**
+     * \f$ K_{ii} \f$, LU factored in place by its first solve.
+     */
+    DenseMatrix<Number> K_ii;
+
+    /**
+     * \f$ K_{ii}^{-1} K_{is} \f$.
+     */
+    DenseMatrix<Number> K_ii_inv_K_is;
+
+    /**
+     * \f$ K_{si} \f$.
+     */
+    DenseMatrix<Number> K_si;
+  };
+
+  const System & _system;
+
+  /**
+   * The blocks of each local element with interior dofs, by element id.
+   */
+  std::unordered_map<dof_id_type, ElementBlocks> _blocks;
+
+  /**
+   * Serializes insertions into \p _blocks.
+   */
+  Threads::spin_mutex _blocks_mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_STATIC_CONDENSATION_H
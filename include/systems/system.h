@@ -285,6 +285,28 @@ public:
    */
   virtual void update ();
 
+  /**
+   * Starts the same update of the local values as \p update(), but
+   * may return before the communication is complete, so that work
+   * which only needs locally owned values can overlap with it.  The
+   * ghosted values of \p current_local_solution must not be used, and
+   * \p solution must not be changed, until \p end_update() has been
+   * called.
+   */
+  void begin_update ();
+
+  /**
+   * Waits for the update started by \p begin_update() to complete.
+   * Does nothing if no update is in progress.
+   */
+  void end_update ();
+
+  /**
+   * \returns \p true if \p begin_update() has been called without a
+   * matching \p end_update() yet.
+   */
+  bool update_in_progress () const { return _update_in_progress; }
+
   /**
    * Prepares \p matrix and \p _dof_map for matrix assembly.
    * Does not actually assemble anything.  For matrix assembly,
@@ -1236,6 +1258,17 @@ public:
                       const SystemNorm & norm,
                       std::set<unsigned int> * skip_dimensions=nullptr) const;
 
+  /**
+   * \returns The norms of the vector \p v in each of \p norms, as
+   * calculate_norm() would return them, but integrated in a single
+   * threaded sweep over the elements.  Each FE is reinitialized once
+   * per element, and each value or derivative computed once per
+   * quadrature point, however many variables and norms need it.
+   */
+  std::vector<Real> calculate_norms(const NumericVector<Number> & v,
+                                    const std::vector<SystemNorm> & norms,
+                                    std::set<unsigned int> * skip_dimensions=nullptr) const;
+
   /**
    * Reads the basic data header for this System.
    */
@@ -1316,6 +1349,19 @@ public:
                            const bool read_additional_data)
   { read_parallel_data<Number>(io, read_additional_data); }
 
+  /**
+   * Reads the vectors of this System from the per-processor files
+   * \p ios, each written by write_parallel_index() followed by
+   * write_parallel_data().  The files may have been written on a
+   * different number of processors, or with a different partitioning,
+   * than we have now: each value is sent to the processor which now
+   * owns the object it belongs to.  Every processor must call this,
+   * with whichever files (perhaps none) it has been given to read.
+   */
+  template <typename InValType>
+  void read_redistributed_parallel_data (const std::vector<Xdr *> & ios,
+                                         const bool read_additional_data);
+
   /**
    * Writes the basic data header for this System.
    */
@@ -1347,12 +1393,35 @@ public:
   void write_parallel_data (Xdr & io,
                             const bool write_additional_data) const;
 
+  /**
+   * Writes the ids of the local nodes and elements, and the number of
+   * components each of them has for each variable, in the order
+   * write_parallel_data() writes their values.  This lets
+   * read_redistributed_parallel_data() read the values back on any
+   * number of processors.
+   */
+  void write_parallel_index (Xdr & io) const;
+
   /**
    * \returns A string containing information about the
    * system.
    */
   std::string get_info () const;
 
+  /**
+   * \returns The memory, in bytes, this processor uses for the
+   * entries of the solution and every other vector of this system.
+   */
+  std::size_t vectors_memory_footprint () const;
+
+  /**
+   * \returns An estimate of the memory, in bytes, this processor uses
+   * for the entries of the matrices of this system, were they stored
+   * in compressed sparse row form with the sparsity pattern last
+   * computed by our \p DofMap.
+   */
+  std::size_t matrices_memory_footprint () const;
+
   /**
    * Register a user function to use in initializing the system.
    */
@@ -1716,6 +1785,24 @@ public:
     project_with_constraints = _project_with_constraints;
   }
 
+  /**
+   * Setter and getter functions for project_incrementally boolean.
+   *
+   * When it is true, projections from the mesh before an AMR step
+   * copy the values of elements which weren't refined, coarsened or
+   * p-refined directly from the old vector, and only project onto the
+   * other elements.  This is false by default.
+   */
+  bool get_project_incrementally() const
+  {
+    return project_incrementally;
+  }
+
+  void set_project_incrementally(bool _project_incrementally)
+  {
+    project_incrementally = _project_incrementally;
+  }
+
   /**
    * \returns A writable reference to a boolean that determines if this system
    * can be written to file or not.  If set to \p true, then
@@ -2032,6 +2119,11 @@ private:
    */
   bool _is_initialized;
 
+  /**
+   * \p true between \p begin_update() and \p end_update().
+   */
+  bool _update_in_progress;
+
   /**
    * \p true when \p VariableGroup structures should be automatically
    * identified, \p false otherwise.  Defaults to \p true.
@@ -2074,6 +2166,12 @@ private:
    * Do we want to apply constraints while projecting vectors ?
    */
   bool project_with_constraints;
+
+  /**
+   * Do we want to copy, rather than project, values on elements
+   * untouched by refinement while projecting vectors?
+   */
+  bool project_incrementally;
 };
 
 
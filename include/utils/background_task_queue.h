@@ -0,0 +1,117 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_BACKGROUND_TASK_QUEUE_H
+#define LIBMESH_BACKGROUND_TASK_QUEUE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <deque>
+#include <exception>
+#include <functional>
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace libMesh
+{
+
+/**
+ * Runs tasks one at a time, in the order they were pushed, on a
+ * background thread, so that the thread pushing them can get on with
+ * other work.  The worker thread starts with the first task and
+ * stops when the queue is destroyed.
+ *
+ * Tasks must not communicate with other processors, and must not
+ * touch anything the pushing thread may be using until it calls
+ * wait().  The first exception thrown by a task is rethrown from the
+ * next call to wait(); tasks after it are dropped.
+ *
+ * Without C++11 thread support, push() just runs each task.
+ *
+ * \brief Serial queue of background tasks.
+ */
+class BackgroundTaskQueue
+{
+public:
+  BackgroundTaskQueue ();
+
+  /**
+   * Waits for any remaining tasks, discarding any exception they
+   * throw.
+   */
+  ~BackgroundTaskQueue ();
+
+  BackgroundTaskQueue (const BackgroundTaskQueue &) = delete;
+  BackgroundTaskQueue & operator= (const BackgroundTaskQueue &) = delete;
+
+  /**
+   * Queues \p task to run after every task pushed before it.
+   */
+  void push (std::function<void ()> task);
+
+  /**
+   * Blocks until every task pushed so far has run, then rethrows
+   * the first exception any of them threw, if any.
+   */
+  void wait ();
+
+private:
+
+  /**
+   * The first exception a task threw, if wait() hasn't rethrown it
+   * yet
+   */
+  std::exception_ptr _error;
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+  /**
+   * The loop run by the worker thread
+   */
+  void run ();
+
+  std::mutex _mutex;
+
+  /**
+   * Signals the worker thread that there are tasks to run or that it
+   * should stop, and signals waiting threads that the queue emptied
+   */
+  std::condition_variable _work_available, _work_done;
+
+  std::deque<std::function<void ()>> _tasks;
+
+  /**
+   * Whether the worker is running a task it has taken off _tasks
+   */
+  bool _busy;
+
+  bool _stop;
+
+  std::thread _worker;
+#endif
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_BACKGROUND_TASK_QUEUE_H
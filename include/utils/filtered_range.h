@@ -0,0 +1,99 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FILTERED_RANGE_H
+#define LIBMESH_FILTERED_RANGE_H
+
+// C++ includes
+#include <type_traits>
+#include <utility>
+
+namespace libMesh
+{
+
+/**
+ * The \p FilteredRange templated class is a range over those
+ * entries of a container of pointers which are not null and which
+ * satisfy the functor \p Pred.
+ *
+ * Unlike the \p variant_filter_iterator behind the \p MeshBase
+ * iterators, neither the underlying iterator type \p Iter nor the
+ * predicate are type-erased, so loops over a \p FilteredRange can be
+ * inlined entirely.
+ */
+template <typename Iter, typename Pred>
+class FilteredRange
+{
+public:
+  /**
+   * The pointer type dereferencing an iterator gives.
+   */
+  typedef typename std::decay<decltype(*std::declval<const Iter &>())>::type value_type;
+
+  class iterator
+  {
+  public:
+    iterator (const Iter & it, const Iter & end, const Pred & pred) :
+      _it(it), _end(end), _pred(pred)
+    { this->satisfy(); }
+
+    value_type operator* () const { return *_it; }
+
+    iterator & operator++ ()
+    {
+      ++_it;
+      this->satisfy();
+      return *this;
+    }
+
+    bool operator== (const iterator & other) const { return _it == other._it; }
+
+    bool operator!= (const iterator & other) const { return _it != other._it; }
+
+  private:
+    // Advance past any entries we should skip
+    void satisfy ()
+    {
+      for (; _it != _end; ++_it)
+        {
+          const value_type val = *_it;
+          if (val && _pred(val))
+            return;
+        }
+    }
+
+    Iter _it, _end;
+    Pred _pred;
+  };
+
+  FilteredRange (const Iter & begin, const Iter & end, const Pred & pred) :
+    _begin(begin), _end(end), _pred(pred) {}
+
+  iterator begin () const { return iterator(_begin, _end, _pred); }
+
+  iterator end () const { return iterator(_end, _end, _pred); }
+
+private:
+  Iter _begin, _end;
+  Pred _pred;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FILTERED_RANGE_H
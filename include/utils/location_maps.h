@@ -60,15 +60,38 @@ public:
 
   void insert(T &);
 
+  /**
+   * Inserts every object in \p objects, in order.  The keys are
+   * computed on several threads; the map itself is filled on one.
+   */
+  void insert(const std::vector<T *> & objects);
+
   bool empty() const { return _map.empty(); }
 
   T * find(const Point &,
            const Real tol = TOLERANCE);
 
+  /**
+   * Looks up every point in \p points, on several threads, and fills
+   * \p found with the matching objects, or with nullptr where there
+   * are none.
+   */
+  void find(const std::vector<Point> & points,
+            std::vector<T *> & found,
+            const Real tol = TOLERANCE) const;
+
   Point point_of(const T &) const;
 
 protected:
-  unsigned int key(const Point &);
+  unsigned int key(const Point &) const;
+
+  /**
+   * The lookup behind both find() overloads.  Reading the map
+   * concurrently is safe, so this can be called from several threads
+   * at once as long as nothing is being inserted.
+   */
+  T * find_unlogged(const Point &,
+                    const Real tol) const;
 
   void fill(MeshBase &);
 
@@ -77,6 +77,8 @@ public:
       return it != other.it;
     }
 
+    index_t index() const { return it->first; }
+
     typename maptype::iterator it;
   };
 
@@ -110,6 +112,8 @@ public:
       return it != other.it;
     }
 
+    index_t index() const { return it->first; }
+
     typename maptype::const_iterator it;
   };
 
@@ -136,6 +140,19 @@ public:
   const_veclike_iterator end() const {
     return const_veclike_iterator(maptype::end());
   }
+
+  /**
+   * \returns One more than the largest index with a non-default
+   * value, or zero if there are none.
+   */
+  index_t index_bound() const {
+    // Search backwards so we can break out early
+    for (typename maptype::const_reverse_iterator rit = this->rbegin();
+         rit != this->rend(); ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+    return 0;
+  }
 };
 
 } // namespace libMesh
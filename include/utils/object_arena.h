@@ -0,0 +1,128 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_OBJECT_ARENA_H
+#define LIBMESH_OBJECT_ARENA_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p ObjectArena class hands out memory for many small objects
+ * from large slabs, with one set of slabs (and one free list) for
+ * each object size.  Allocation and deallocation are then a pointer
+ * pop or push rather than a trip through the general purpose heap,
+ * and objects of the same size are packed together rather than
+ * scattered across it.
+ *
+ * Deallocated chunks are kept for reuse by later allocations of the
+ * same size.  Slabs are only returned to the system, all at once, by
+ * \p release_memory(), which frees every slab with no live chunks.
+ *
+ * Requests larger than \p max_chunk_size are passed through to the
+ * global \p operator new.  All methods are thread safe.
+ */
+class ObjectArena
+{
+public:
+
+  /**
+   * Constructor.  Each slab will hold \p chunks_per_slab objects.
+   */
+  explicit
+  ObjectArena (const std::size_t chunks_per_slab = 1024);
+
+  /**
+   * Destructor.  Frees all slabs, whether or not any chunks in them
+   * are still in use.
+   */
+  ~ObjectArena ();
+
+  ObjectArena (const ObjectArena &) = delete;
+  ObjectArena & operator= (const ObjectArena &) = delete;
+
+  /**
+   * \returns Memory for an object of \p size bytes, aligned as for
+   * any fundamental type.
+   */
+  void * allocate (const std::size_t size);
+
+  /**
+   * Returns \p p, which must have come from \p allocate(size), to the
+   * arena.
+   */
+  void deallocate (void * p, const std::size_t size);
+
+  /**
+   * Frees every slab which has no chunks in use.
+   *
+   * \returns The number of bytes freed.
+   */
+  std::size_t release_memory ();
+
+  /**
+   * \returns The number of bytes currently held in slabs.
+   */
+  std::size_t slab_memory () const;
+
+  /**
+   * Objects larger than this are not pooled.
+   */
+  static const std::size_t max_chunk_size = 1024;
+
+private:
+
+  /**
+   * Chunk sizes are rounded up to a multiple of this, which is also
+   * the alignment we guarantee.
+   */
+  static const std::size_t chunk_align = alignof(std::max_align_t);
+
+  /**
+   * The slabs and free chunks for one object size.
+   */
+  struct Bucket
+  {
+    Bucket () : free_list(nullptr) {}
+
+    void * free_list;
+    std::vector<char *> slabs;
+  };
+
+  /**
+   * Buckets by chunk size / chunk_align - 1.
+   */
+  std::vector<Bucket> _buckets;
+
+  const std::size_t _chunks_per_slab;
+
+  mutable Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_OBJECT_ARENA_H
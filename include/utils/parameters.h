@@ -108,6 +108,18 @@ public:
   template <typename T>
   const T & get (const std::string &) const;
 
+  template <typename T>
+  class Handle;
+
+  /**
+   * \returns A handle to the specified parameter value, with which
+   * it can be read repeatedly, in hot loops for instance, without
+   * being looked up by name each time.  Requires, like \p get(),
+   * that the parameter exists.
+   */
+  template <typename T>
+  Handle<T> get_handle (const std::string &) const;
+
   /**
    * Inserts a new Parameter into the object but does not return
    * a writable reference.  The value of the newly inserted
@@ -235,6 +247,37 @@ public:
     T _value;
   };
 
+  /**
+   * A read-only handle to the value of a parameter of type \p T.  It
+   * sees any later changes to the value, and stays valid until the
+   * parameter is removed or replaced, or the \p Parameters holding
+   * it are cleared, assigned to or destroyed.
+   */
+  template <typename T>
+  class Handle
+  {
+  public:
+    /**
+     * Builds a handle to nothing, which can only be assigned to.
+     */
+    Handle () : _value(nullptr) {}
+
+    /**
+     * \returns A read-only reference to the parameter value.
+     */
+    const T & get () const { libmesh_assert(_value); return *_value; }
+
+    const T & operator* () const { return this->get(); }
+    const T * operator-> () const { return &this->get(); }
+
+  private:
+    friend class Parameters;
+
+    explicit Handle (const T & value) : _value(&value) {}
+
+    const T * _value;
+  };
+
   /**
    * Parameter map iterator.
    */
@@ -267,6 +310,12 @@ public:
 
 protected:
 
+  /**
+   * \returns The specified parameter, which must exist.
+   */
+  template <typename T>
+  const Parameter<T> & get_parameter (const std::string &) const;
+
   /**
    * Data structure to map names with values.
    */
@@ -421,9 +470,21 @@ bool Parameters::have_parameter (const std::string & name) const
 
 template <typename T>
 inline
-const T & Parameters::get (const std::string & name) const
+const Parameters::Parameter<T> &
+Parameters::get_parameter (const std::string & name) const
 {
-  if (!this->have_parameter<T>(name))
+  // Look the parameter up just once, whether or not it's there
+  Parameters::const_iterator it = _values.find(name);
+
+  const Parameter<T> * param = nullptr;
+  if (it != _values.end())
+#ifdef LIBMESH_HAVE_RTTI
+    param = dynamic_cast<const Parameter<T> *>(it->second);
+#else // LIBMESH_HAVE_RTTI
+    param = cast_ptr<const Parameter<T> *>(it->second);
+#endif // LIBMESH_HAVE_RTTI
+
+  if (!param)
     {
       std::ostringstream oss;
 
@@ -439,12 +500,25 @@ const T & Parameters::get (const std::string & name) const
       libmesh_error_msg(oss.str());
     }
 
-  Parameters::const_iterator it = _values.find(name);
+  return *param;
+}
 
-  libmesh_assert(it != _values.end());
-  libmesh_assert(it->second);
 
-  return cast_ptr<Parameter<T> *>(it->second)->get();
+
+template <typename T>
+inline
+const T & Parameters::get (const std::string & name) const
+{
+  return this->get_parameter<T>(name).get();
+}
+
+
+
+template <typename T>
+inline
+Parameters::Handle<T> Parameters::get_handle (const std::string & name) const
+{
+  return Handle<T>(this->get_parameter<T>(name).get());
 }
 
 template <typename T>
@@ -23,6 +23,7 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/utility.h"
 
 // C++ includes
 #include <cstddef>
@@ -32,9 +33,74 @@
 #include <vector>
 #include <sys/time.h>
 
+#include <iosfwd>
+#include <memory>
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+#include <mutex>
+#include <thread>
+#endif
+
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
+/**
+ * The \p PerfCounters class reads hardware event counters for the
+ * calling thread, via the Linux perf_event interface.  The counters
+ * only count while the thread which built the object runs, in user
+ * space.
+ *
+ * \brief Hardware event counters used by PerfLog
+ */
+class PerfCounters
+{
+public:
+
+  /**
+   * The events we count, in order.
+   */
+  enum Counter
+    {
+      CYCLES = 0,
+      INSTRUCTIONS,
+      CACHE_MISSES,
+      N_COUNTERS
+    };
+
+  typedef long long values_type[N_COUNTERS];
+
+  /**
+   * Starts counting on the calling thread.  If the counters can't be
+   * opened, for instance because the kernel forbids it or because we
+   * were built without perf_event support, \p valid() is \p false.
+   */
+  PerfCounters ();
+
+  ~PerfCounters ();
+
+  PerfCounters (const PerfCounters &) = delete;
+  PerfCounters & operator= (const PerfCounters &) = delete;
+
+  /**
+   * \returns \p true iff the counters are counting.
+   */
+  bool valid () const { return _fds[0] >= 0; }
+
+  /**
+   * Reads the current counts into \p values.
+   */
+  void read (values_type & values) const;
+
+private:
+
+  int _fds[N_COUNTERS];
+};
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -57,7 +123,11 @@ public:
     tstart_incl_sub(),
     count(0),
     open(false),
-    called_recursively(0)
+    called_recursively(0),
+    hw_counts(),
+    hw_start(),
+    peak_memory_start(0),
+    peak_memory_growth(0)
   {}
 
 
@@ -104,6 +174,42 @@ public:
 
   int called_recursively;
 
+  /**
+   * Hardware event counts while this event was active, not including
+   * sub-events, if \p PerfLog was counting them.
+   */
+  PerfCounters::values_type hw_counts;
+
+  /**
+   * The hardware event counts when the event was last started or
+   * resumed.
+   */
+  PerfCounters::values_type hw_start;
+
+  /**
+   * Adds the counts since \p hw_start to \p hw_counts.
+   */
+  void count_until (const PerfCounters::values_type & now);
+
+  /**
+   * Starts counting from \p now.
+   */
+  void count_from (const PerfCounters::values_type & now);
+
+  /**
+   * The peak memory usage of the process, in bytes, when the
+   * outermost call of this event began, or 0 if we weren't tracking
+   * memory then.
+   */
+  std::size_t peak_memory_start;
+
+  /**
+   * How much the peak memory usage of the process, in bytes, grew
+   * while this event, including sub-events, was running, if \p
+   * PerfLog was tracking memory.
+   */
+  std::size_t peak_memory_growth;
+
 protected:
   double stop_or_pause(const bool do_stop);
 };
@@ -111,6 +217,30 @@ protected:
 
 
 
+/**
+ * A handle for an event which is pushed and popped often enough that
+ * looking it up by name each time would cost more than it measures.
+ * Each \p PerfEvent is given a number of its own when it is built,
+ * with which every \p PerfLog finds its data for the event directly.
+ * The \p LOG_SCOPE macros build one for each place they are used.
+ *
+ * As with \p PerfLog::fast_push(), the label and header have to
+ * outlive any \p PerfLog the event is logged in.
+ */
+class PerfEvent
+{
+public:
+  explicit
+  PerfEvent (const char * label_in,
+             const char * header_in="");
+
+  const char * const label;
+  const char * const header;
+  const unsigned int id;
+};
+
+
+
 /**
  * The \p PerfLog class allows monitoring of specific events.
  * An event is defined by a unique string that functions as
@@ -118,6 +248,19 @@ protected:
  * This class is particularly useful for finding performance
  * bottlenecks.
  *
+ * Events may be pushed and popped from any thread.  Threads other
+ * than the one which built the \p PerfLog each log onto their own
+ * stack of events, so threaded loops can be timed too.  Their logs
+ * are summarized per event, alongside the main log, when the log is
+ * printed.  This requires C++11 thread support; otherwise logging
+ * is disabled within threaded loops.
+ *
+ * Optionally, a \p PerfLog can also record when each event began and
+ * ended, on each thread, for export as a timeline with \p
+ * write_trace().  Each thread records into a fixed size ring buffer,
+ * keeping only its most recent events, so tracing can stay enabled
+ * for long runs.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief Responsible for timing and summarizing events.
@@ -165,6 +308,99 @@ public:
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * Starts recording a timeline of events, keeping the most recent \p
+   * max_events event beginnings and endings on each thread.  Any
+   * timeline already recorded is discarded.  This should not be
+   * called from within threaded loops.
+   */
+  void enable_tracing(std::size_t max_events = 65536);
+
+  /**
+   * Stops recording, and discards, the timeline of events.
+   */
+  void disable_tracing();
+
+  /**
+   * \returns \p true iff a timeline of events is being recorded.
+   */
+  bool tracing_enabled() const { return trace_capacity; }
+
+  /**
+   * Starts counting hardware events (cycles, instructions and
+   * last level cache misses) during each event, on each thread, for
+   * the log to report instructions per cycle and an estimate of
+   * memory bandwidth.  This reads the counters at every push and pop,
+   * so it is costlier than timing alone.  Warns and does nothing if
+   * the counters are unavailable.  This should be called on the
+   * thread which built this object, not from within threaded loops.
+   */
+  void enable_hardware_counters();
+
+  /**
+   * Stops counting hardware events.
+   */
+  void disable_hardware_counters();
+
+  /**
+   * Starts recording how much the peak resident memory of this
+   * process grows during each event logged by the thread which built
+   * this object, for the log to show which events raised it.  This
+   * reads the peak at every push and pop of an event which isn't
+   * already running.
+   */
+  void enable_memory_tracking() { track_memory = true; }
+
+  /**
+   * Stops recording peak memory growth.
+   */
+  void disable_memory_tracking() { track_memory = false; }
+
+  /**
+   * \returns \p true iff hardware events are being counted.
+   */
+  bool hardware_counters_enabled() const { return count_hw; }
+
+  /**
+   * \returns \p true iff peak memory growth is being recorded.
+   */
+  bool memory_tracking_enabled() const { return track_memory; }
+
+  /**
+   * Writes the recorded timeline of events, in the Chrome trace event
+   * JSON format read by e.g. chrome://tracing and Perfetto.  Events
+   * are labelled with \p processor_id and with a thread number, 0
+   * for the thread which built this object.  Events which began
+   * before the oldest event still recorded on their thread are
+   * omitted.
+   */
+  void write_trace(std::ostream & os,
+                   processor_id_type processor_id) const;
+
+  /**
+   * Writes the recorded timeline of events to the file \p filename,
+   * labelled with this processor's id.
+   */
+  void write_trace(const std::string & filename) const;
+
+  /**
+   * Writes a JSON summary of the log, labelled with \p processor_id:
+   * the alive and active times, the peak memory usage of this
+   * process, and the calls, times and peak memory growth of each
+   * event.  Events logged by threads other than the one which built
+   * this object are summed over those threads, as "thread_calls" and
+   * "thread_time".  This is meant for scripts tracking performance
+   * from one run to the next.
+   */
+  void write_json(std::ostream & os,
+                  processor_id_type processor_id) const;
+
+  /**
+   * Writes a JSON summary of the log to the file \p filename,
+   * labelled with this processor's id.
+   */
+  void write_json(const std::string & filename) const;
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -176,6 +412,13 @@ public:
   void fast_push (const char * label,
                   const char * header="");
 
+  /**
+   * Push \p event onto the stack, pausing any active event.  This is
+   * \p fast_push() of the label and header of \p event, without
+   * having to look them up.
+   */
+  void fast_push (const PerfEvent & event);
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -207,6 +450,11 @@ public:
   void fast_pop (const char * label,
                  const char * header="");
 
+  /**
+   * Pop \p event off the stack, resuming any lower event.
+   */
+  void fast_pop (const PerfEvent & event);
+
   /**
    * Pop the event \p label off the stack, resuming any lower event.
    *
@@ -272,6 +520,25 @@ public:
    */
   void print_log() const;
 
+  /**
+   * \returns A summary of the time each event took on each processor
+   * of \p comm: the minimum, maximum (and the processor it was on),
+   * and average over the processors which logged the event.  Times
+   * are those of the main thread.  This is useful for finding load
+   * imbalance.
+   *
+   * This is a collective operation on \p comm, and every processor
+   * must agree on whether logging is enabled.  The summary is
+   * returned on processor 0; other processors get an empty string.
+   */
+  std::string get_parallel_perf_info(const Parallel::Communicator & comm) const;
+
+  /**
+   * Print the summary from \p get_parallel_perf_info() on processor
+   * 0.  This is a collective operation on \p comm.
+   */
+  void print_parallel_log(const Parallel::Communicator & comm) const;
+
   /**
    * \returns The total time spent on this event.
    */
@@ -311,6 +578,131 @@ public:
 
 private:
 
+  /**
+   * A ring buffer of the most recent event beginnings and endings on
+   * one thread.
+   */
+  struct TraceBuffer
+  {
+    struct Entry
+    {
+      const char * label;
+      const char * header;
+      struct timeval time;
+      bool begin;
+    };
+
+    explicit
+    TraceBuffer (std::size_t capacity) :
+      entries(capacity), next(0), full(false) {}
+
+    void record (const char * label,
+                 const char * header,
+                 const struct timeval & time,
+                 const bool begin)
+    {
+      Entry & entry = entries[next];
+      entry.label = label;
+      entry.header = header;
+      entry.time = time;
+      entry.begin = begin;
+      if (++next == entries.size())
+        {
+          next = 0;
+          full = true;
+        }
+    }
+
+    std::vector<Entry> entries;
+    std::size_t next;
+    bool full;
+  };
+
+  /**
+   * Pushes \p perf_data, the data of the event (\p header, \p
+   * label), onto \p stack, pausing any active event, and adds the
+   * time of that event to \p active_time.  Records the beginning in
+   * \p trace, attributes hardware event counts from \p counters, if
+   * any, and starts tracking peak memory growth if \p track_memory.
+   */
+  static void push_event (PerfData & perf_data,
+                          std::stack<PerfData*> & stack,
+                          double & active_time,
+                          TraceBuffer * trace,
+                          const PerfCounters * counters,
+                          bool track_memory,
+                          const char * label,
+                          const char * header);
+
+  /**
+   * Pops the event (\p header, \p label) off \p stack, resuming any
+   * lower event, and adds its time to \p active_time.  Records the
+   * ending in \p trace, attributes hardware event counts from \p
+   * counters, if any, and peak memory growth if \p track_memory.  In
+   * debug mode, checks that the event is on
+   * top: that its data in \p events is \p perf_data, if we already
+   * know it.
+   */
+  static void pop_event (log_type & events,
+                         const PerfData * perf_data,
+                         std::stack<PerfData*> & stack,
+                         double & active_time,
+                         TraceBuffer * trace,
+                         const PerfCounters * counters,
+                         bool track_memory,
+                         const char * label,
+                         const char * header);
+
+  /**
+   * \returns The data of \p event in \p events, which \p cache
+   * remembers by the number of the event.
+   */
+  static PerfData & event_data (log_type & events,
+                                std::vector<PerfData *> & cache,
+                                const PerfEvent & event);
+
+  /**
+   * Looks up the data of \p event in \p events the first time it is
+   * logged, and remembers it in \p cache.
+   */
+  static PerfData & cache_event_data (log_type & events,
+                                      std::vector<PerfData *> & cache,
+                                      const PerfEvent & event);
+
+  /**
+   * Writes the entries of \p trace as trace events of thread \p
+   * thread_id.
+   */
+  static void write_trace_events (std::ostream & os,
+                                  const TraceBuffer & trace,
+                                  processor_id_type processor_id,
+                                  unsigned int thread_id,
+                                  bool & first);
+
+  /**
+   * Errors if any event in \p events is still being monitored.
+   */
+  void check_closed (const log_type & events) const;
+
+  /**
+   * \returns A summary of the hardware event counts of each event
+   * summed over every thread, or an empty string if none were
+   * counted.
+   */
+  std::string get_hardware_perf_info() const;
+
+  /**
+   * \returns A summary of how much each event raised the peak memory
+   * usage, or an empty string if we didn't track it.
+   */
+  std::string get_memory_perf_info() const;
+
+  /**
+   * \returns A summary of the events logged on more than one thread:
+   * the minimum, maximum and average per-thread time of each, or an
+   * empty string if no other thread logged any events.
+   */
+  std::string get_thread_perf_info() const;
 
   /**
    * The label for this object.
@@ -341,6 +733,12 @@ private:
    */
   log_type log;
 
+  /**
+   * The data in \p log of each \p PerfEvent which has been logged,
+   * indexed by the number of the event.
+   */
+  std::vector<PerfData *> event_cache;
+
   /**
    * A stack to hold the current performance log trace.
    */
@@ -369,6 +767,87 @@ private:
    * doc, so let's be safe.
    */
   std::map<std::string, const char *> non_temporary_strings;
+
+  /**
+   * The number of entries to trace on each thread, or 0 if we are
+   * not tracing.
+   */
+  std::size_t trace_capacity;
+
+  /**
+   * The timeline of events on our main thread, if we are tracing.
+   */
+  std::unique_ptr<TraceBuffer> trace;
+
+  /**
+   * Whether we are counting hardware events.
+   */
+  bool count_hw;
+
+  /**
+   * The hardware event counters of our main thread, if we are
+   * counting them.
+   */
+  std::unique_ptr<PerfCounters> counters;
+
+  /**
+   * Whether we are tracking peak memory growth on our main thread.
+   */
+  bool track_memory;
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+  /**
+   * The events logged by one thread other than \p main_thread.
+   */
+  struct ThreadLog
+  {
+    ThreadLog () : total_time(0.), tried_counters(false) {}
+
+    log_type log;
+    std::vector<PerfData *> event_cache;
+    std::stack<PerfData*> log_stack;
+    double total_time;
+    std::unique_ptr<TraceBuffer> trace;
+    std::unique_ptr<PerfCounters> counters;
+
+    /**
+     * Whether we have tried to open \p counters, so we don't retry
+     * when the kernel won't give us any.
+     */
+    bool tried_counters;
+  };
+
+  /**
+   * \returns The log of the calling thread, which must not be \p
+   * main_thread, creating it (and its hardware counters, if we
+   * count them) on first use.
+   */
+  ThreadLog & thread_log();
+
+  /**
+   * The thread which built this object, and which logs directly
+   * into \p log.
+   */
+  const std::thread::id main_thread;
+
+  /**
+   * A number unique to this object, with which each thread finds
+   * its own \p ThreadLog.
+   */
+  const unsigned long serial;
+
+  /**
+   * The logs of every other thread which has logged events here.
+   * These are only ever cleared, not deleted, until we are.
+   */
+  std::vector<std::unique_ptr<ThreadLog>> thread_logs;
+
+  /**
+   * Serializes access to \p thread_logs and to \p
+   * non_temporary_strings.
+   */
+  mutable std::mutex thread_mutex;
+#endif
 };
 
 
@@ -448,6 +927,24 @@ double PerfData::pause_for(PerfData & other)
 
 
 
+inline
+void PerfData::count_until (const PerfCounters::values_type & now)
+{
+  for (unsigned int i = 0; i != PerfCounters::N_COUNTERS; ++i)
+    this->hw_counts[i] += now[i] - this->hw_start[i];
+}
+
+
+
+inline
+void PerfData::count_from (const PerfCounters::values_type & now)
+{
+  for (unsigned int i = 0; i != PerfCounters::N_COUNTERS; ++i)
+    this->hw_start[i] = now[i];
+}
+
+
+
 inline
 double PerfData::stopit ()
 {
@@ -462,59 +959,220 @@ double PerfData::stopit ()
 
 // ------------------------------------------------------------
 // PerfLog class inline member functions
+inline
+void PerfLog::push_event (PerfData & event_data,
+                          std::stack<PerfData*> & stack,
+                          double & active_time,
+                          TraceBuffer * trace,
+                          const PerfCounters * counters,
+                          const bool track_memory,
+                          const char * label,
+                          const char * header)
+{
+  PerfData * perf_data = &event_data;
+
+  if (counters)
+    {
+      PerfCounters::values_type now;
+      counters->read(now);
+      if (!stack.empty())
+        stack.top()->count_until(now);
+      perf_data->count_from(now);
+    }
+
+  if (!stack.empty())
+    active_time += stack.top()->pause_for(*perf_data);
+  else
+    perf_data->start();
+  stack.push(perf_data);
+
+  if (track_memory && perf_data->called_recursively == 1)
+    perf_data->peak_memory_start = Utility::peak_memory_usage();
+
+  // Either way the event's start time is now
+  if (trace)
+    trace->record(label, header, perf_data->tstart, true);
+}
+
+
+
+inline
+void PerfLog::pop_event (log_type & events,
+                         const PerfData * perf_data,
+                         std::stack<PerfData*> & stack,
+                         double & active_time,
+                         TraceBuffer * trace,
+                         const PerfCounters * counters,
+                         const bool track_memory,
+                         const char * label,
+                         const char * header)
+{
+  libmesh_assert (!stack.empty());
+
+#ifndef NDEBUG
+  if (!perf_data)
+    perf_data = &(events[std::make_pair(header,label)]);
+  if (perf_data != stack.top())
+    {
+      libMesh::err << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
+      libMesh::err << "From top of stack of running logs:" << std::endl;
+      for (auto i : events)
+        if (&(i.second) == stack.top())
+          libMesh::err << '(' << i.first.first << ',' << i.first.second << ')' << std::endl;
+
+      libmesh_assert_equal_to (perf_data, stack.top());
+    }
+#else
+  libmesh_ignore(events, perf_data);
+#endif
+
+  PerfData * top = stack.top();
+  active_time += top->stopit();
+
+  if (top->called_recursively == 0 && top->peak_memory_start)
+    {
+      if (track_memory)
+        top->peak_memory_growth +=
+          Utility::peak_memory_usage() - top->peak_memory_start;
+      top->peak_memory_start = 0;
+    }
+
+  PerfCounters::values_type now = {};
+  if (counters)
+    {
+      counters->read(now);
+      top->count_until(now);
+    }
+
+  // Stopping the event leaves its stop time in tstart
+  if (trace)
+    trace->record(label, header, top->tstart, false);
+
+  stack.pop();
+
+  if (!stack.empty())
+    {
+      stack.top()->restart();
+      if (counters)
+        stack.top()->count_from(now);
+    }
+}
+
+
+
 inline
 void PerfLog::fast_push (const char * label,
                          const char * header)
 {
   if (this->log_events)
     {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
-
-      if (!log_stack.empty())
-        total_time += log_stack.top()->pause_for(*perf_data);
-      else
-        perf_data->start();
-      log_stack.push(perf_data);
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+      if (std::this_thread::get_id() != main_thread)
+        {
+          ThreadLog & my_log = this->thread_log();
+          push_event(my_log.log[std::make_pair(header,label)],
+                     my_log.log_stack, my_log.total_time,
+                     my_log.trace.get(), my_log.counters.get(), false,
+                     label, header);
+          return;
+        }
+#endif
+
+      push_event(log[std::make_pair(header,label)], log_stack, total_time,
+                 trace.get(), counters.get(), track_memory, label, header);
     }
 }
 
 
 
 inline
-void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
-                       const char * libmesh_dbg_var(header))
+void PerfLog::fast_push (const PerfEvent & event)
 {
   if (this->log_events)
     {
-      libmesh_assert (!log_stack.empty());
-
-#ifndef NDEBUG
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
-      if (perf_data != log_stack.top())
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+      if (std::this_thread::get_id() != main_thread)
         {
-          libMesh::err << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
-          libMesh::err << "From top of stack of running logs:" << std::endl;
-          for (auto i : log)
-            if (&(i.second) == log_stack.top())
-              libMesh::err << '(' << i.first.first << ',' << i.first.second << ')' << std::endl;
+          ThreadLog & my_log = this->thread_log();
+          push_event(event_data(my_log.log, my_log.event_cache, event),
+                     my_log.log_stack, my_log.total_time,
+                     my_log.trace.get(), my_log.counters.get(), false,
+                     event.label, event.header);
+          return;
+        }
+#endif
+
+      push_event(event_data(log, event_cache, event), log_stack, total_time,
+                 trace.get(), counters.get(), track_memory,
+                 event.label, event.header);
+    }
+}
 
-          libmesh_assert_equal_to (perf_data, log_stack.top());
+
+
+inline
+void PerfLog::fast_pop(const char * label,
+                       const char * header)
+{
+  if (this->log_events)
+    {
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+      if (std::this_thread::get_id() != main_thread)
+        {
+          ThreadLog & my_log = this->thread_log();
+          pop_event(my_log.log, nullptr, my_log.log_stack, my_log.total_time,
+                    my_log.trace.get(), my_log.counters.get(), false,
+                    label, header);
+          return;
         }
 #endif
 
-      total_time += log_stack.top()->stopit();
+      pop_event(log, nullptr, log_stack, total_time, trace.get(),
+                counters.get(), track_memory, label, header);
+    }
+}
+
 
-      log_stack.pop();
 
-      if (!log_stack.empty())
-        log_stack.top()->restart();
+inline
+void PerfLog::fast_pop (const PerfEvent & event)
+{
+  if (this->log_events)
+    {
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+      if (std::this_thread::get_id() != main_thread)
+        {
+          ThreadLog & my_log = this->thread_log();
+          pop_event(my_log.log,
+                    &event_data(my_log.log, my_log.event_cache, event),
+                    my_log.log_stack, my_log.total_time,
+                    my_log.trace.get(), my_log.counters.get(), false,
+                    event.label, event.header);
+          return;
+        }
+#endif
+
+      pop_event(log, &event_data(log, event_cache, event), log_stack,
+                total_time, trace.get(), counters.get(), track_memory,
+                event.label, event.header);
     }
 }
 
 
 
+inline
+PerfData & PerfLog::event_data (log_type & events,
+                                std::vector<PerfData *> & cache,
+                                const PerfEvent & event)
+{
+  if (event.id < cache.size() && cache[event.id])
+    return *cache[event.id];
+
+  return cache_event_data(events, cache, event);
+}
+
+
+
 inline
 double PerfLog::get_elapsed_time () const
 {
@@ -190,6 +190,29 @@ public:
    */
   virtual Real get_contains_point_tol() const;
 
+  /**
+   * Enables neighbor walking.  When the element found by the previous
+   * query doesn't contain the next point, the locator first walks
+   * from it across neighbor links toward the point, for up to
+   * \p max_steps elements, before searching from scratch.  This is
+   * much faster for spatially coherent queries, such as particle
+   * tracking.  Threaded callers should each use their own servant
+   * locator (see MeshBase::sub_point_locator()), which shares the
+   * master's search structure but keeps its own last element.
+   */
+  void enable_neighbor_walk (unsigned int max_steps = 20);
+
+  /**
+   * Disables neighbor walking (default).
+   */
+  void disable_neighbor_walk ();
+
+  /**
+   * \returns The largest number of elements a neighbor walk may
+   * visit, or 0 if neighbor walking is disabled.
+   */
+  unsigned int get_neighbor_walk_steps () const;
+
   /**
    * Get a const reference to this PointLocator's mesh.
    */
@@ -201,6 +224,20 @@ public:
   bool _verbose;
 
 protected:
+  /**
+   * Walks from \p elem across neighbor links, always to the neighbor
+   * whose centroid is closest to \p p, for as long as that gets
+   * closer and for at most the configured number of steps.
+   *
+   * \returns The first active element on the way, other than \p
+   * elem, which is allowed by \p allowed_subdomains and contains \p p
+   * to within \p tol, or nullptr if the walk gets stuck first.
+   */
+  const Elem * walk_toward (const Elem * elem,
+                            const Point & p,
+                            const std::set<subdomain_id_type> * allowed_subdomains,
+                            Real tol) const;
+
   /**
    * Const pointer to our master, initialized to \p nullptr if none
    * given.  When using multiple PointLocators, one can be assigned
@@ -239,6 +276,12 @@ protected:
    * The tolerance to use when locating an element in the tree.
    */
   Real _contains_point_tol;
+
+  /**
+   * The largest number of elements a neighbor walk may visit, or 0
+   * to search from scratch whenever the last element misses.
+   */
+  unsigned int _neighbor_walk_steps;
 };
 
 } // namespace libMesh
@@ -0,0 +1,228 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+#include "libmesh/bounding_box.h"
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+/**
+ * This is a point locator.  It locates points in space using a
+ * bounding volume hierarchy over the active elements of the mesh.
+ * Use \p PointLocatorBase::build() with \p BVH to create objects of
+ * this type at run time.
+ *
+ * The hierarchy is a binary tree of bounding boxes, stored as one
+ * contiguous array in depth-first order, with the elements of each
+ * leaf stored contiguously alongside their own bounding boxes.  It is
+ * built top down, splitting the elements of each node in half along
+ * the longest extent of their centers; the element bounding boxes,
+ * the expensive part of the build, are computed on several threads.
+ * A query descends only into nodes whose boxes contain the point, and
+ * only calls \p Elem::contains_point() on elements whose own boxes do.
+ *
+ * \brief Locates points using a flat bounding volume hierarchy.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a master locator, whose hierarchy
+   * will be shared rather than built again.  If \p local_elements
+   * is true, only active local elements are searched.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = nullptr,
+                   bool local_elements = false);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.
+   */
+  virtual void clear() override;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.
+   */
+  virtual void init() override;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed subdomains.
+   * The mutable _element member is used to cache
+   * the result and allow it to be used during the next call to
+   * operator().
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Locates a set of elements in proximity to the point with global coordinates
+   * \p p.  Optionally allows the user to restrict the subdomains searched.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return nullptr instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () override;
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode () override;
+
+  /**
+   * Set the largest number of elements in a leaf of the hierarchy.
+   * This takes effect the next time the hierarchy is built, after
+   * \p clear() and \p init().
+   */
+  void set_target_leaf_size(unsigned int target);
+
+  /**
+   * Get the largest number of elements in a leaf of the hierarchy.
+   */
+  unsigned int get_target_leaf_size() const;
+
+protected:
+  /**
+   * One node of the hierarchy.  The first child of an interior node
+   * directly follows it in the node array; \p second_child is the
+   * index of the other.  A leaf holds the \p n_elems elements starting
+   * at \p first_elem.
+   */
+  struct HierarchyNode
+  {
+    BoundingBox box;
+    unsigned int first_elem;
+    unsigned int n_elems;
+    unsigned int second_child;
+  };
+
+  /**
+   * The hierarchy itself, which a master locator shares with its
+   * servants.
+   */
+  struct Hierarchy
+  {
+    std::vector<HierarchyNode> nodes;
+    std::vector<const Elem *> elems;
+    std::vector<BoundingBox> elem_boxes;
+
+    /**
+     * Infinite elements have no useful bounding box, so they are
+     * always checked.
+     */
+    std::vector<const Elem *> infinite_elems;
+
+    /**
+     * The number of levels of nodes, which bounds the traversal stack.
+     */
+    unsigned int depth;
+  };
+
+  /**
+   * Builds the hierarchy over the elements we search.
+   */
+  void build_hierarchy ();
+
+  /**
+   * Appends the nodes of the hierarchy over the elements indexed by
+   * \p order between \p begin and \p end, and returns the depth of
+   * the subtree.
+   */
+  unsigned int build_nodes (std::vector<unsigned int> & order,
+                            std::size_t begin,
+                            std::size_t end,
+                            const std::vector<BoundingBox> & boxes,
+                            const std::vector<Point> & centers);
+
+  /**
+   * Calls \p f on each element, with its bounding box, that is allowed
+   * by \p allowed_subdomains and whose bounding box, expanded by
+   * \p relative_tol times its size, contains \p p, or on each
+   * infinite element.  Stops as soon as \p f returns true, and
+   * returns whether it did.
+   */
+  template <typename ElemFunctor>
+  bool for_each_candidate (const Point & p,
+                           const std::set<subdomain_id_type> * allowed_subdomains,
+                           Real relative_tol,
+                           const ElemFunctor & f) const;
+
+  /**
+   * The hierarchy, built at run-time through \p init().  Servant
+   * locators share the master's.
+   */
+  std::shared_ptr<Hierarchy> _hierarchy;
+
+  /**
+   * Pointer to the last element that was found.  Chances are that
+   * this may be close to the next call to \p operator()...
+   */
+  mutable const Elem * _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.  See \p
+   * enable_out_of_mesh_mode() for details.
+   */
+  bool _out_of_mesh_mode;
+
+  /**
+   * \p true if only active local elements are searched.
+   */
+  bool _local_elements;
+
+  /**
+   * The largest number of elements in a leaf of the hierarchy.
+   */
+  unsigned int _target_leaf_size;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
@@ -42,6 +42,12 @@ class Elem;
  * Use \p PointLocatorBase::build() to create objects of this
  * type at run time.
  *
+ * The tree is built in one pass when the master is initialized and
+ * is never modified afterwards, so any number of servant locators,
+ * such as those handed out by \p MeshBase::sub_point_locator() to
+ * each \p MeshFunction, may search it at once from different
+ * threads.  Each servant keeps its own last-found element.
+ *
  * \author Daniel Dreyer
  * \date 2003
  */
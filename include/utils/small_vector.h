@@ -0,0 +1,308 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SMALL_VECTOR_H
+#define LIBMESH_SMALL_VECTOR_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes   -----------------------------------
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace libMesh
+{
+
+/**
+ * This \p small_vector templated class provides the subset of the
+ * std::vector interface used by \p DofObject index buffers, but
+ * stores up to \p N values inline, without any heap allocation.
+ * Only larger contents spill to the heap.  The inline storage shares
+ * space with the heap pointer, so an empty or small \p small_vector
+ * costs little more than a std::vector header.
+ *
+ * Only trivially copyable value types are supported; values are
+ * moved with plain copies, and are not constructed or destroyed
+ * individually.
+ */
+template <typename T, unsigned int N>
+class small_vector
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "small_vector only supports trivially copyable types");
+  static_assert(N > 0, "small_vector needs inline capacity");
+
+public:
+  typedef T value_type;
+  typedef T * iterator;
+  typedef const T * const_iterator;
+  typedef std::size_t size_type;
+
+  small_vector () : _size(0), _capacity(N) {}
+
+  explicit
+  small_vector (const size_type n, const T & val = T()) :
+    _size(0), _capacity(N)
+  {
+    this->resize(n, val);
+  }
+
+  /**
+   * Copies \p other, allocating only as much heap storage as its
+   * contents need.
+   */
+  small_vector (const small_vector & other) :
+    _size(0), _capacity(N)
+  {
+    this->assign(other.begin(), other.end());
+  }
+
+  small_vector (small_vector && other) :
+    _size(0), _capacity(N)
+  {
+    this->swap(other);
+  }
+
+  small_vector & operator= (const small_vector & other)
+  {
+    if (this != &other)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  small_vector & operator= (small_vector && other)
+  {
+    small_vector(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~small_vector ()
+  {
+    if (!this->is_inline())
+      delete [] _storage.heap;
+  }
+
+  size_type size () const { return _size; }
+
+  size_type capacity () const { return _capacity; }
+
+  /**
+   * \returns The heap memory, in bytes, taken by the values, which
+   * is 0 while they still fit inline.
+   */
+  std::size_t memory_footprint () const
+  { return this->is_inline() ? 0 : _capacity * sizeof(T); }
+
+  bool empty () const { return !_size; }
+
+  T * data () { return this->is_inline() ? _storage.local : _storage.heap; }
+
+  const T * data () const { return this->is_inline() ? _storage.local : _storage.heap; }
+
+  T & operator[] (const size_type i)
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  const T & operator[] (const size_type i) const
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  iterator begin () { return this->data(); }
+
+  const_iterator begin () const { return this->data(); }
+
+  iterator end () { return this->data() + _size; }
+
+  const_iterator end () const { return this->data() + _size; }
+
+  void clear () { _size = 0; }
+
+  void reserve (const size_type n)
+  {
+    if (n > _capacity)
+      this->reallocate(n);
+  }
+
+  /**
+   * Releases unused heap storage, moving the contents back inline
+   * if they fit.
+   */
+  void shrink_to_fit ()
+  {
+    if (!this->is_inline() && _size < _capacity)
+      this->reallocate(_size);
+  }
+
+  void resize (const size_type n, const T & val = T())
+  {
+    if (n > _size)
+      {
+        const T v = val;
+        this->grow(n);
+        std::fill(this->data() + _size, this->data() + n, v);
+      }
+    _size = cast_int<std::uint32_t>(n);
+  }
+
+  void push_back (const T & val)
+  {
+    const T v = val;
+    this->grow(_size + 1);
+    this->data()[_size++] = v;
+  }
+
+  template <typename InputIterator>
+  void assign (InputIterator first, InputIterator last)
+  {
+    const size_type n = std::distance(first, last);
+    _size = 0;
+    this->reserve(n);
+    std::copy(first, last, this->data());
+    _size = cast_int<std::uint32_t>(n);
+  }
+
+  /**
+   * Inserts \p val before \p pos, which may point into this vector.
+   */
+  iterator insert (const_iterator pos, const T & val)
+  {
+    const size_type offset = pos - this->begin();
+    libmesh_assert_less_equal (offset, _size);
+
+    const T v = val;
+    this->grow(_size + 1);
+
+    T * const d = this->data();
+    std::copy_backward(d + offset, d + _size, d + _size + 1);
+    d[offset] = v;
+    ++_size;
+
+    return d + offset;
+  }
+
+  /**
+   * Inserts the range [\p first, \p last), which must not point into
+   * this vector, before \p pos.
+   */
+  template <typename InputIterator>
+  iterator insert (const_iterator pos, InputIterator first, InputIterator last)
+  {
+    const size_type offset = pos - this->begin();
+    libmesh_assert_less_equal (offset, _size);
+
+    const size_type n = std::distance(first, last);
+    this->grow(_size + n);
+
+    T * const d = this->data();
+    std::copy_backward(d + offset, d + _size, d + _size + n);
+    std::copy(first, last, d + offset);
+    _size = cast_int<std::uint32_t>(_size + n);
+
+    return d + offset;
+  }
+
+  iterator erase (const_iterator first, const_iterator last)
+  {
+    T * const d = this->data();
+    const size_type offset = first - d;
+    const size_type n = last - first;
+    libmesh_assert_less_equal (offset + n, _size);
+
+    std::copy(d + offset + n, d + _size, d + offset);
+    _size = cast_int<std::uint32_t>(_size - n);
+
+    return d + offset;
+  }
+
+  void swap (small_vector & other)
+  {
+    std::swap(_storage, other._storage);
+    std::swap(_size, other._size);
+    std::swap(_capacity, other._capacity);
+  }
+
+private:
+
+  bool is_inline () const { return _capacity == N; }
+
+  /**
+   * Makes room for at least \p n values.  Heap capacity is doubled
+   * to keep repeated growth linear.
+   */
+  void grow (const size_type n)
+  {
+    if (n > _capacity)
+      this->reallocate(std::max(n, size_type(2) * _capacity));
+  }
+
+  /**
+   * Moves the contents to storage for \p n values (inline if \p n is
+   * no more than \p N).
+   */
+  void reallocate (size_type n)
+  {
+    libmesh_assert_greater_equal (n, _size);
+
+    T * const old = this->data();
+    const bool was_inline = this->is_inline();
+
+    if (n <= N)
+      {
+        if (was_inline)
+          return;
+        std::copy(old, old + _size, _storage.local);
+        _capacity = N;
+      }
+    else
+      {
+        T * const fresh = new T[n];
+        std::copy(old, old + _size, fresh);
+        _storage.heap = fresh;
+        _capacity = cast_int<std::uint32_t>(n);
+      }
+
+    if (!was_inline)
+      delete [] old;
+  }
+
+  union Storage
+  {
+    T local[N];
+    T * heap;
+  } _storage;
+
+  std::uint32_t _size;
+
+  /**
+   * Equal to \p N exactly when the contents are stored inline.
+   */
+  std::uint32_t _capacity;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SMALL_VECTOR_H
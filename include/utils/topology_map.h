@@ -62,6 +62,9 @@ public:
  * For efficiency we will use a hashed map if it is available,
  * otherwise a regular map.
  *
+ * The find() methods only read the map, so they can be called from
+ * several threads at once, so long as no thread is adding nodes.
+ *
  * \author Roy Stogner
  * \date 2015
  * \brief Enables topology-based lookups of nodes.
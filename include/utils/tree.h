@@ -46,6 +46,7 @@ class Tree : public TreeBase
 public:
   /**
    * Constructor. Requires a mesh and the target bin size. Optionally takes the build method.
+   * The whole tree is built top down in a single pass.
    */
   Tree (const MeshBase & m,
         unsigned int target_bin_size,
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <set>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -95,6 +96,33 @@ public:
    */
   bool insert (const Elem * nd);
 
+  /**
+   * Builds this (active, empty) node and everything below it in one
+   * top-down pass from the nodes \p nds and the elements \p elems
+   * touching them.  Nodes are split among the children whose
+   * bounding boxes contain them, until fewer than the target bin
+   * size remain, and each element follows every child containing one
+   * of its nodes.  This gives the same bins and bin contents as
+   * inserting the nodes one at a time and then calling
+   * \p transform_nodes_to_elements(), without re-binning anything or
+   * building a nodes-to-elements map.
+   *
+   * Both vectors are consumed.
+   */
+  void build (std::vector<const Node *> & nds,
+              std::vector<const Elem *> & elems);
+
+  /**
+   * Builds this (active, empty) node and everything below it in one
+   * top-down pass from \p elems, each paired with its loose bounding
+   * box.  This gives the same bins as inserting the elements one at
+   * a time, without re-binning anything or recomputing bounding
+   * boxes; each bin keeps its elements in the order given.
+   *
+   * The vector is consumed.
+   */
+  void build (std::vector<std::pair<BoundingBox, const Elem *>> & elems);
+
   /**
    * Refine the tree node into N children if it contains
    * more than tol nodes.
@@ -190,6 +218,25 @@ private:
                                   const std::set<subdomain_id_type> * allowed_subdomains,
                                   Real relative_tol) const;
 
+  /**
+   * \returns \p true if \p bbox intersects the bounding box of this
+   * node.  QuadTrees ignore z, except to check that both boxes lie
+   * in the same plane.
+   */
+  bool intersects (const BoundingBox & bbox) const;
+
+  /**
+   * \returns \p true if \p elem counts towards the target bin size.
+   * Unless the mesh says otherwise, only elements of the highest
+   * dimension do.
+   */
+  bool counts_towards_bin_size (const Elem * elem) const;
+
+  /**
+   * \returns The target bin size to use in our children.
+   */
+  unsigned int child_target_bin_size () const;
+
   /**
    * Constructs the bounding box for child \p c.
    */
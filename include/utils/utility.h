@@ -388,6 +388,50 @@ T binomial(T n, T k)
 }
 
 
+/**
+ * \returns The most memory, in bytes, this process has had resident
+ * at once so far, or 0 if we can't tell.
+ */
+std::size_t peak_memory_usage();
+
+
+/**
+ * \returns The heap memory, in bytes, taken by the entries of \p
+ * vec, not counting anything they point to.
+ */
+template <typename T, typename A>
+std::size_t memory_footprint (const std::vector<T, A> & vec)
+{
+  return vec.capacity() * sizeof(T);
+}
+
+
+/**
+ * \returns An estimate of the heap memory, in bytes, taken by the
+ * entries of \p c, a std::map, std::set or one of their multi-
+ * versions, not counting anything they point to.  Each entry is
+ * assumed to be a tree node holding three pointers and a color.
+ */
+template <typename Container>
+std::size_t tree_memory_footprint (const Container & c)
+{
+  return c.size() * (sizeof(typename Container::value_type) + 4*sizeof(void *));
+}
+
+
+/**
+ * \returns An estimate of the heap memory, in bytes, taken by the
+ * entries and buckets of \p c, one of the unordered containers, not
+ * counting anything they point to.
+ */
+template <typename Container>
+std::size_t hash_memory_footprint (const Container & c)
+{
+  return c.size() * (sizeof(typename Container::value_type) + 2*sizeof(void *)) +
+    c.bucket_count() * sizeof(void *);
+}
+
+
 /**
  * A convenient method to truly empty a vector using the "swap trick"
  */
@@ -0,0 +1,383 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_WINDOWED_MAPVECTOR_H
+#define LIBMESH_WINDOWED_MAPVECTOR_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes   -----------------------------------
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p windowed_mapvector templated class provides the same
+ * interface as \p mapvector, for use with DistributedMesh, but stores
+ * the values for a contiguous window of indices in a std::vector.
+ * Only indices outside the window, typically those of ghost and
+ * remote objects, are kept in a std::map.  Lookups and iteration
+ * within the window are then array accesses rather than tree walks.
+ *
+ * The window grows as nearby indices are added, and \p compact()
+ * moves it to the densest range of indices after objects have been
+ * removed or renumbered.  A default-constructed (e.g. null) value in
+ * the window is treated as absent, and is skipped by iteration.
+ *
+ * Iteration is in increasing order of index, as with \p mapvector.
+ * Iterators refer to an index rather than a storage location, so they
+ * remain valid when other entries are added, moved, or erased.
+ */
+template <typename Val, typename index_t=unsigned int>
+class windowed_mapvector
+{
+public:
+  typedef std::map<index_t, Val> maptype;
+
+  windowed_mapvector () : _first(0) {}
+
+  Val & operator[] (const index_t & k)
+  {
+    libmesh_assert_not_equal_to (k, end_key());
+
+    if (this->in_window(k))
+      return _window[k - _first];
+
+    if (this->grow_window(k))
+      return _window[k - _first];
+
+    return _outside[k];
+  }
+
+  Val operator[] (const index_t & k) const
+  {
+    if (this->in_window(k))
+      return _window[k - _first];
+
+    typename maptype::const_iterator it = _outside.find(k);
+    return it == _outside.end() ? Val() : it->second;
+  }
+
+  /**
+   * An iterator over the entries of a windowed_mapvector, in
+   * increasing order of index.
+   */
+  template <typename Container, typename Ref>
+  class iterator_imp
+  {
+  public:
+    iterator_imp (Container * c, const index_t k)
+      : container(c), key(k) {}
+
+    // Allow conversion from non-const to const iterators
+    template <typename OtherContainer, typename OtherRef>
+    iterator_imp (const iterator_imp<OtherContainer, OtherRef> & i)
+      : container(i.container), key(i.key) {}
+
+    Ref operator*() const
+    {
+      if (container->in_window(key))
+        return container->_window[key - container->_first];
+
+      libmesh_assert(container->_outside.count(key));
+      return container->_outside.find(key)->second;
+    }
+
+    iterator_imp & operator++()
+    {
+      key = container->next_index(key);
+      return *this;
+    }
+
+    iterator_imp operator++(int) {
+      iterator_imp i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator==(const iterator_imp & other) const {
+      return key == other.key;
+    }
+
+    bool operator!=(const iterator_imp & other) const {
+      return key != other.key;
+    }
+
+    /**
+     * \returns The index of the current entry.
+     */
+    index_t index() const { return key; }
+
+    Container * container;
+    index_t key;
+  };
+
+  typedef iterator_imp<windowed_mapvector, Val &> veclike_iterator;
+  typedef iterator_imp<const windowed_mapvector, const Val &> const_veclike_iterator;
+
+  void erase(index_t i) {
+    if (this->in_window(i))
+      _window[i - _first] = Val();
+    else
+      _outside.erase(i);
+  }
+
+  veclike_iterator erase(const veclike_iterator & pos) {
+    veclike_iterator next = pos;
+    ++next;
+    this->erase(pos.key);
+    return next;
+  }
+
+  veclike_iterator begin() {
+    return veclike_iterator(this, this->first_index());
+  }
+
+  const_veclike_iterator begin() const {
+    return const_veclike_iterator(this, this->first_index());
+  }
+
+  veclike_iterator end() {
+    return veclike_iterator(this, end_key());
+  }
+
+  const_veclike_iterator end() const {
+    return const_veclike_iterator(this, end_key());
+  }
+
+  void clear() {
+    _first = 0;
+    _window.clear();
+    _outside.clear();
+  }
+
+  /**
+   * \returns One more than the largest index with a non-default
+   * value, or zero if there are none.
+   */
+  index_t index_bound() const
+  {
+    // No map entries lie inside the window, so those at or above its
+    // start lie above it
+    typename maptype::const_reverse_iterator rit = _outside.rbegin();
+    for (; rit != _outside.rend() && rit->first >= _first; ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+
+    for (std::size_t i = _window.size(); i != 0; --i)
+      if (_window[i-1] != Val())
+        return _first + cast_int<index_t>(i);
+
+    for (; rit != _outside.rend(); ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+
+    return 0;
+  }
+
+  /**
+   * Drops default-valued entries and moves the window to the longest
+   * run of densely used indices, so that memory use follows the
+   * entries actually held.  Iterators to entries with non-default
+   * values remain valid.
+   */
+  void compact()
+  {
+    std::vector<std::pair<index_t, Val>> entries;
+    for (const_veclike_iterator it = this->begin(), e = this->end(); it != e; ++it)
+      if (*it != Val())
+        entries.emplace_back(it.index(), *it);
+
+    // Find the longest run of consecutive blocks of indices which are
+    // each at least a quarter full
+    const index_t block_size = 64;
+    std::size_t best_begin = 0, best_end = 0;
+    std::size_t run_begin = 0;
+    for (std::size_t b = 0; b != entries.size(); )
+      {
+        const index_t block = entries[b].first / block_size;
+        std::size_t b_end = b;
+        while (b_end != entries.size() &&
+               entries[b_end].first / block_size == block)
+          ++b_end;
+
+        const bool dense = (b_end - b) * 4 >= block_size;
+        const bool continues = b != 0 &&
+          entries[b-1].first / block_size + 1 == block &&
+          run_begin != b;
+
+        if (!dense)
+          run_begin = b_end;
+        else
+          {
+            if (!continues)
+              run_begin = b;
+            if (b_end - run_begin > best_end - best_begin)
+              {
+                best_begin = run_begin;
+                best_end = b_end;
+              }
+          }
+
+        b = b_end;
+      }
+
+    _window.clear();
+    _outside.clear();
+
+    if (best_end != best_begin)
+      {
+        _first = entries[best_begin].first;
+        _window.resize(entries[best_end-1].first + 1 - _first);
+      }
+    else
+      _first = 0;
+
+    for (std::size_t i = 0; i != entries.size(); ++i)
+      if (i >= best_begin && i < best_end)
+        _window[entries[i].first - _first] = entries[i].second;
+      else
+        _outside.emplace_hint(_outside.end(), entries[i].first, entries[i].second);
+
+    _window.shrink_to_fit();
+  }
+
+private:
+
+  static index_t end_key() { return std::numeric_limits<index_t>::max(); }
+
+  index_t window_end() const { return _first + cast_int<index_t>(_window.size()); }
+
+  bool in_window(const index_t k) const
+  { return k >= _first && k - _first < _window.size(); }
+
+  /**
+   * Grows the window to include \p k, if that keeps it reasonably
+   * dense.
+   *
+   * \returns \p true if \p k is now in the window.
+   */
+  bool grow_window(const index_t k)
+  {
+    const std::size_t slack = 64;
+    const std::size_t size = _window.size();
+
+    index_t new_first = _first, new_end = this->window_end();
+
+    if (!size)
+      {
+        new_first = k;
+        new_end = k + 1;
+      }
+    else if (k >= new_end)
+      {
+        if (k + 1 - _first > 2*size + slack)
+          return false;
+        new_end = k + 1;
+      }
+    else
+      {
+        if (new_end - k > 2*size + slack)
+          return false;
+
+        // Leave room below so repeated prepending stays cheap
+        new_first = k - std::min<index_t>(k, cast_int<index_t>(size));
+
+        _window.insert(_window.begin(), _first - new_first, Val());
+      }
+
+    _first = new_first;
+    _window.resize(new_end - new_first);
+
+    // No entries in the map may lie inside the window
+    typename maptype::iterator it = _outside.lower_bound(new_first);
+    while (it != _outside.end() && it->first < new_end)
+      {
+        _window[it->first - new_first] = it->second;
+        it = _outside.erase(it);
+      }
+
+    return true;
+  }
+
+  /**
+   * \returns The index of the first entry, or \p end_key().
+   */
+  index_t first_index() const
+  {
+    typename maptype::const_iterator it = _outside.begin();
+    if (it != _outside.end() && it->first < _first)
+      return it->first;
+
+    return this->next_in_window_or_above(_first);
+  }
+
+  /**
+   * \returns The index of the first entry after \p k, or \p end_key().
+   */
+  index_t next_index(const index_t k) const
+  {
+    libmesh_assert_not_equal_to (k, end_key());
+
+    if (k + 1 < _first)
+      {
+        typename maptype::const_iterator it = _outside.upper_bound(k);
+        if (it != _outside.end() && it->first < _first)
+          return it->first;
+        return this->next_in_window_or_above(_first);
+      }
+
+    return this->next_in_window_or_above(k + 1);
+  }
+
+  /**
+   * \returns The index of the first entry at or after \p k, for \p k
+   * no lower than the window, or \p end_key().
+   */
+  index_t next_in_window_or_above(index_t k) const
+  {
+    const index_t w_end = this->window_end();
+    for (; k < w_end; ++k)
+      if (_window[k - _first] != Val())
+        return k;
+
+    typename maptype::const_iterator it = _outside.lower_bound(k);
+    return it == _outside.end() ? end_key() : it->first;
+  }
+
+  /**
+   * The values for indices \p _first through \p _first +
+   * _window.size() - 1.
+   */
+  index_t _first;
+  std::vector<Val> _window;
+
+  /**
+   * The values for all other indices.
+   */
+  maptype _outside;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_WINDOWED_MAPVECTOR_H
@@ -65,10 +65,12 @@ AS_ECHO(["  library deprecated code support.. : $enabledeprecated"])
 AS_ECHO(["  adaptive mesh refinement......... : $enableamr"])
 AS_ECHO(["  blocked matrix/vector storage.... : $enableblockedstorage"])
 AS_ECHO(["  complex variables................ : $enablecomplex"])
+AS_ECHO(["  dof object arena allocation...... : $enabledofobjectarena"])
 AS_ECHO(["  example suite.................... : $enableexamples"])
 AS_ECHO(["  ghosted vectors.................. : $enableghosted"])
 AS_ECHO(["  high-order shape functions....... : $enablepfem"])
 AS_ECHO(["  unique-id support................ : $enableuniqueid"])
+AS_ECHO(["  windowed DistributedMesh storage. : $enablewindowedmapvector"])
 AS_ECHO(["  id size (boundaries)............. : $boundary_bytes bytes"])
 AS_ECHO(["  id size (dofs)................... : $dof_bytes bytes"])
 AS_IF([test "x$enableuniqueid" = "xyes"],
@@ -156,6 +158,8 @@ AS_IF([test "x$enableoptional" = "xyes"],
                 AS_ECHO(["     Tpetra........................ : $enabletpetra"])
                 AS_ECHO(["     DTK........................... : $enabledtk"])
                 AS_ECHO(["     Ifpack........................ : $enableifpack"])
+                AS_ECHO(["     Tpetra solvers................ : $enabletpetrasolvers"])
+                AS_ECHO(["     MueLu......................... : $enablemuelu"])
                 AS_ECHO(["     Epetra........................ : $enableepetra"])
                 AS_ECHO(["     EpetraExt..................... : $enableepetraext"])
               ])
@@ -483,6 +483,43 @@ AS_IF([test "$enableghosted" != no],
 
 
 
+# -------------------------------------------------------------
+# Windowed vector storage of DistributedMesh objects -- enabled by
+# default
+# -------------------------------------------------------------
+AC_ARG_ENABLE(windowed-mapvector,
+              AS_HELP_STRING([--disable-windowed-mapvector],
+                             [Store DistributedMesh objects in std::map based containers]),
+              enablewindowedmapvector=$enableval,
+              enablewindowedmapvector=yes)
+
+AS_IF([test "$enablewindowedmapvector" != no],
+      [
+        AC_DEFINE(ENABLE_WINDOWED_MAPVECTOR, 1, [Flag indicating if DistributedMesh should store objects in windowed vectors])
+        AC_MSG_RESULT(<<< Configuring library to use windowed DistributedMesh storage >>>)
+      ])
+# -------------------------------------------------------------
+
+
+
+# -------------------------------------------------------------
+# Arena allocation of nodes and elements -- disabled by default
+# -------------------------------------------------------------
+AC_ARG_ENABLE(dof-object-arena,
+              AS_HELP_STRING([--enable-dof-object-arena],
+                             [Allocate nodes and elements from per-size slabs]),
+              enabledofobjectarena=$enableval,
+              enabledofobjectarena=no)
+
+AS_IF([test "$enabledofobjectarena" != no],
+      [
+        AC_DEFINE(ENABLE_DOF_OBJECT_ARENA, 1, [Flag indicating if nodes and elements should be allocated from an arena])
+        AC_MSG_RESULT(<<< Configuring library to allocate nodes and elements from an arena >>>)
+      ])
+# -------------------------------------------------------------
+
+
+
 # -------------------------------------------------------------
 # Store node valence for use with subdivision surface finite
 #  elements -- enabled by default
@@ -177,6 +177,40 @@ AC_DEFUN([CONFIGURE_TRILINOS_10],
                           AC_MSG_RESULT([<<< Configuring library with Trilinos Ifpack support >>>])
                         ])
 
+                  dnl ------------------------------------------------------
+                  dnl Belos, Ifpack2 and MueLu - the Tpetra solver stack.
+                  dnl The TpetraVector, TpetraMatrix and BelosLinearSolver
+                  dnl classes use the Kokkos based Tpetra interfaces of
+                  dnl Trilinos 13.2 and later, so we only enable them with
+                  dnl a recent enough Trilinos.
+                  dnl ------------------------------------------------------
+                  AC_CHECK_HEADER([$withtrilinosdir/include/Belos_config.h],
+                                  [enablebelos=yes],
+                                  [enablebelos=no])
+                  AC_CHECK_HEADER([$withtrilinosdir/include/Ifpack2_config.h],
+                                  [enableifpack2=yes],
+                                  [enableifpack2=no])
+                  AC_CHECK_HEADER([$withtrilinosdir/include/MueLu_config.hpp],
+                                  [enablemuelu=yes],
+                                  [enablemuelu=no])
+
+                  trilinosmajorminor=`grep "define TRILINOS_MAJOR_MINOR_VERSION" $withtrilinosdir/include/Trilinos_version.h | sed -e "s/#define TRILINOS_MAJOR_MINOR_VERSION[ ]*//g"`
+                  AS_IF([test "x$trilinosmajorminor" = "x"], [trilinosmajorminor=0])
+
+                  AS_IF([test "x$enabletpetra" != "xno" && test "x$enablebelos" != "xno" && test "x$enableifpack2" != "xno" && test $trilinosmajorminor -ge 130200],
+                        [
+                          enabletpetrasolvers=yes
+                          AC_DEFINE(TRILINOS_HAVE_TPETRA_SOLVERS, 1, [Flag indicating whether the library shall be compiled with the Tpetra, Belos and Ifpack2 based Trilinos solvers])
+                          AC_MSG_RESULT([<<< Configuring library with Trilinos Tpetra/Belos/Ifpack2 support >>>])
+
+                          AS_IF([test "x$enablemuelu" != "xno"],
+                                [
+                                  AC_DEFINE(TRILINOS_HAVE_MUELU, 1, [Flag indicating whether the library shall be compiled to use the Trilinos MueLu multigrid preconditioners])
+                                  AC_MSG_RESULT([<<< Configuring library with Trilinos MueLu support >>>])
+                                ])
+                        ],
+                        [enabletpetrasolvers=no])
+
                   dnl ------------------------------------------------------
                   dnl EpetraExt - We are only going to look in one place for this,
                   dnl as I don't have access to lots of older versions of
@@ -381,6 +415,8 @@ AC_DEFUN([CONFIGURE_TRILINOS_9],
   dnl anyone ever wants to go back and write a configure test with
   dnl an older Trilinos, that would be great!
   enableifpack=no
+  enabletpetrasolvers=no
+  enablemuelu=no
 
   dnl EpetraEXT - rather than try and guess how this would have worked in
   dnl Trilinos 9, we're just going to assume we don't have it.  If
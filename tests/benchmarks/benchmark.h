@@ -0,0 +1,147 @@
+#ifndef LIBMESH_BENCHMARK_H
+#define LIBMESH_BENCHMARK_H
+
+#include <libmesh/libmesh_common.h>
+#include <libmesh/parallel.h>
+
+// C++ includes
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <string>
+
+/**
+ * A minimal harness for timing libMesh kernels, in the style of
+ * Google Benchmark.  Each benchmark is a function taking a \p State,
+ * which does any setup, then times its kernel in a
+ *
+ *   while (state.keep_running())
+ *     { ... }
+ *
+ * loop.  The driver calls each function with growing iteration
+ * counts until the timed loop takes long enough to measure.
+ */
+namespace Benchmark
+{
+
+class State
+{
+public:
+  State (const libMesh::Parallel::Communicator & comm,
+         std::size_t max_iterations) :
+    _comm(comm),
+    _max_iterations(max_iterations),
+    _iterations(0),
+    _paused(false),
+    _real_time(0.),
+    _cpu_time(0.),
+    _items_processed(0.)
+  {}
+
+  /**
+   * \returns \p true until the kernel has run the requested number
+   * of times.  Timing starts at the first call and stops at the
+   * last.
+   */
+  bool keep_running ()
+  {
+    if (!_iterations)
+      this->resume_timing();
+
+    if (_iterations == _max_iterations)
+      {
+        this->pause_timing();
+        return false;
+      }
+
+    ++_iterations;
+    return true;
+  }
+
+  /**
+   * Stops the clock, for work within the loop which is not part of
+   * the kernel, e.g. restoring its input.
+   */
+  void pause_timing ()
+  {
+    libmesh_assert(!_paused);
+    _real_time += std::chrono::duration<double>
+      (std::chrono::steady_clock::now() - _real_start).count();
+    _cpu_time += double(std::clock() - _cpu_start) / CLOCKS_PER_SEC;
+    _paused = true;
+  }
+
+  void resume_timing ()
+  {
+    _real_start = std::chrono::steady_clock::now();
+    _cpu_start = std::clock();
+    _paused = false;
+  }
+
+  /**
+   * The number of items (elements, points, solves, ...) handled by
+   * all the iterations, for the driver to report a rate.
+   */
+  void set_items_processed (double items) { _items_processed = items; }
+
+  const libMesh::Parallel::Communicator & comm () const { return _comm; }
+
+  std::size_t iterations () const { return _iterations; }
+
+  double real_time () const { return _real_time; }
+
+  double cpu_time () const { return _cpu_time; }
+
+  double items_processed () const { return _items_processed; }
+
+private:
+  const libMesh::Parallel::Communicator & _comm;
+
+  const std::size_t _max_iterations;
+
+  std::size_t _iterations;
+
+  bool _paused;
+
+  std::chrono::steady_clock::time_point _real_start;
+
+  std::clock_t _cpu_start;
+
+  double _real_time, _cpu_time, _items_processed;
+};
+
+typedef std::function<void (State &)> Function;
+
+/**
+ * Registers \p f to be run as the benchmark \p name.
+ */
+void add (const std::string & name, Function f);
+
+/**
+ * Registers benchmarks at static initialization time, for instance
+ *
+ *   Benchmark::Registrar my_benchmarks ([]{ Benchmark::add(...); });
+ */
+struct Registrar
+{
+  Registrar (const std::function<void ()> & adder) { adder(); }
+};
+
+/**
+ * Keeps the compiler from optimizing away the computation of \p
+ * value.
+ */
+template <typename T>
+inline void do_not_optimize (const T & value)
+{
+#if defined(__GNUC__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void * sink;
+  sink = &value;
+#endif
+}
+
+} // namespace Benchmark
+
+#endif // LIBMESH_BENCHMARK_H
@@ -233,10 +233,6 @@ public:
     _sys->add_variable("u", order, family);
     _es->init();
 
-    // Clough-Tocher elements still don't work multithreaded
-    if (family == CLOUGH && libMesh::n_threads() > 1)
-      return;
-
     if (family == RATIONAL_BERNSTEIN && order > 1)
       {
         _sys->project_solution(rational_test, rational_test_grad, _es->parameters);
@@ -309,10 +305,6 @@ public:
 
   void testU()
   {
-    // Clough-Tocher elements still don't work multithreaded
-    if (family == CLOUGH && libMesh::n_threads() > 1)
-      return;
-
     // Handle the "more processors than elements" case
     if (!_elem)
       return;
@@ -370,10 +362,6 @@ public:
 
   void testDualDoesntScreamAndDie()
   {
-    // Clough-Tocher elements still don't work multithreaded
-    if (family == CLOUGH && libMesh::n_threads() > 1)
-      return;
-
     // Handle the "more processors than elements" case
     if (!_elem)
       return;
@@ -388,10 +376,6 @@ public:
 
   void testGradU()
   {
-    // Clough-Tocher elements still don't work multithreaded
-    if (family == CLOUGH && libMesh::n_threads() > 1)
-      return;
-
     // Handle the "more processors than elements" case
     if (!_elem)
       return;
@@ -474,10 +458,6 @@ public:
 
   void testGradUComp()
   {
-    // Clough-Tocher elements still don't work multithreaded
-    if (family == CLOUGH && libMesh::n_threads() > 1)
-      return;
-
     // Handle the "more processors than elements" case
     if (!_elem)
       return;
@@ -570,10 +550,6 @@ public:
   void testHessU()
   {
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
-    // Clough-Tocher elements still don't work multithreaded
-    if (family == CLOUGH && libMesh::n_threads() > 1)
-      return;
-
     // Szabab elements don't have second derivatives yet
     if (family == SZABAB)
       return;
@@ -677,10 +653,6 @@ public:
   void testHessUComp()
   {
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
-    // Clough-Tocher elements still don't work multithreaded
-    if (family == CLOUGH && libMesh::n_threads() > 1)
-      return;
-
     // Szabab elements don't have second derivatives yet
     if (family == SZABAB)
       return;
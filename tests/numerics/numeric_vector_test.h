@@ -17,7 +17,10 @@
   CPPUNIT_TEST( testLocalizeIndices );          \
   CPPUNIT_TEST( testLocalizeIndicesBase );      \
   CPPUNIT_TEST( testLocalizeToOne );            \
-  CPPUNIT_TEST( testLocalizeToOneBase );
+  CPPUNIT_TEST( testLocalizeToOneBase );        \
+  CPPUNIT_TEST( testBeginEndLocalizeBase );     \
+  CPPUNIT_TEST( testFusedOperationsBase );      \
+  CPPUNIT_TEST( testLargeOperationsBase );
 
 #ifndef LIBMESH_HAVE_CXX14_MAKE_UNIQUE
 using libMesh::make_unique;
@@ -135,6 +138,165 @@ public:
     }
   }
 
+  template <class Base, class Derived>
+  void BeginEndLocalize()
+  {
+    unsigned int block_size  = 10;
+
+    // a different size on each processor.
+    unsigned int local_size  = block_size +
+      static_cast<unsigned int>(my_comm->rank());
+    unsigned int global_size = 0;
+
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    {
+      auto v_ptr = libmesh_make_unique<Derived>(*my_comm, global_size, local_size);
+      auto v_local_ptr = libmesh_make_unique<Derived>(*my_comm, global_size);
+      Base & v = *v_ptr;
+      Base & v_local = *v_local_ptr;
+
+      const libMesh::dof_id_type
+        first = v.first_local_index(),
+        last  = v.last_local_index();
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        v.set (n, static_cast<libMesh::Number>(n));
+      v.close();
+
+      // Ask for the first entry past our own, if there is one
+      std::vector<libMesh::numeric_index_type> send_list;
+      if (last < global_size)
+        send_list.push_back(last);
+
+      v.begin_localize(v_local, send_list);
+      v.end_localize(v_local);
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(n),
+                                libMesh::libmesh_real(v_local(n)),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+      for (const auto n : send_list)
+        LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(n),
+                                libMesh::libmesh_real(v_local(n)),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+    }
+  }
+
+  template <class Base, class Derived>
+  void FusedOperations()
+  {
+    unsigned int block_size  = 10;
+
+    // a different size on each processor.
+    unsigned int local_size  = block_size +
+      static_cast<unsigned int>(my_comm->rank());
+    unsigned int global_size = 0;
+
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    {
+      auto u_ptr = libmesh_make_unique<Derived>(*my_comm, global_size, local_size);
+      auto x_ptr = libmesh_make_unique<Derived>(*my_comm, global_size, local_size);
+      auto y_ptr = libmesh_make_unique<Derived>(*my_comm, global_size, local_size);
+      Base & u = *u_ptr;
+      Base & x = *x_ptr;
+      Base & y = *y_ptr;
+
+      const libMesh::dof_id_type
+        first = u.first_local_index(),
+        last  = u.last_local_index();
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        {
+          u.set (n, static_cast<libMesh::Number>(n));
+          x.set (n, 1);
+          y.set (n, 2);
+        }
+      u.close();
+      x.close();
+      y.close();
+
+      // u = 2 + 6 + n/2, then u = 7 + n/2
+      u.axpbypcz(2, 3, 0.5, x, y);
+      u.add({1, -1}, {&x, &y});
+      u.close();
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        LIBMESH_ASSERT_FP_EQUAL(7 + 0.5*n, libMesh::libmesh_real(u(n)),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+      std::vector<libMesh::Number> dots;
+      u.dot({&x, &y}, dots);
+      CPPUNIT_ASSERT_EQUAL(std::size_t(2), dots.size());
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u.dot(x)),
+                              libMesh::libmesh_real(dots[0]),
+                              libMesh::TOLERANCE);
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u.dot(y)),
+                              libMesh::libmesh_real(dots[1]),
+                              libMesh::TOLERANCE);
+
+      const auto dot_and_norm = u.dot_and_l2_norm(x);
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(dots[0]),
+                              libMesh::libmesh_real(dot_and_norm.first),
+                              libMesh::TOLERANCE);
+      LIBMESH_ASSERT_FP_EQUAL(u.l2_norm(), dot_and_norm.second,
+                              libMesh::TOLERANCE);
+    }
+  }
+
+  // Long enough vectors that threaded implementations split them up
+  template <class Base, class Derived>
+  void LargeOperations()
+  {
+    unsigned int block_size  = 40000;
+
+    // a different size on each processor.
+    unsigned int local_size  = block_size +
+      static_cast<unsigned int>(my_comm->rank());
+    unsigned int global_size = 0;
+
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    {
+      auto u_ptr = libmesh_make_unique<Derived>(*my_comm, global_size, local_size);
+      auto x_ptr = libmesh_make_unique<Derived>(*my_comm, global_size, local_size);
+      Base & u = *u_ptr;
+      Base & x = *x_ptr;
+
+      u = 1;
+      x = 2;
+      u.close();
+      x.close();
+
+      const libMesh::Real N = global_size;
+      const libMesh::Real tol = libMesh::TOLERANCE*libMesh::TOLERANCE;
+
+      LIBMESH_ASSERT_FP_EQUAL(N, libMesh::libmesh_real(u.sum()), N*tol);
+      LIBMESH_ASSERT_FP_EQUAL(2*N, x.l1_norm(), N*tol);
+      LIBMESH_ASSERT_FP_EQUAL(std::sqrt(N), u.l2_norm(), tol);
+      LIBMESH_ASSERT_FP_EQUAL(2, x.linfty_norm(), tol);
+      LIBMESH_ASSERT_FP_EQUAL(2*N, libMesh::libmesh_real(u.dot(x)), N*tol);
+
+      // u = 1 + 3*2 = 7, then 3.5, then 7 again
+      u.add(3, x);
+      u.scale(0.5);
+      u *= x;
+      u.close();
+
+      const libMesh::dof_id_type
+        first = u.first_local_index(),
+        last  = u.last_local_index();
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        LIBMESH_ASSERT_FP_EQUAL(7, libMesh::libmesh_real(u(n)), tol);
+    }
+  }
+
   void testLocalize()
   {
     Localize<DerivedClass,DerivedClass>();
@@ -155,6 +317,21 @@ public:
     Localize<libMesh::NumericVector<libMesh::Number>,DerivedClass>(true);
   }
 
+  void testBeginEndLocalizeBase()
+  {
+    BeginEndLocalize<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
+  }
+
+  void testFusedOperationsBase()
+  {
+    FusedOperations<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
+  }
+
+  void testLargeOperationsBase()
+  {
+    LargeOperations<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
+  }
+
   void testLocalizeIndices()
   {
     LocalizeIndices<DerivedClass,DerivedClass >();